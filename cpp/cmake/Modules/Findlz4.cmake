@@ -0,0 +1,82 @@
+# =============================================================================
+# Copyright (c) 2023, NVIDIA CORPORATION.
+#
+# Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except
+# in compliance with the License. You may obtain a copy of the License at
+#
+# http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software distributed under the License
+# is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+# or implied. See the License for the specific language governing permissions and limitations under
+# the License.
+
+#[=======================================================================[.rst:
+Findlz4
+-------
+
+Find LZ4 headers and libraries.
+
+Imported Targets
+^^^^^^^^^^^^^^^^
+
+``lz4::lz4``
+  The LZ4 library, if found.
+
+Result Variables
+^^^^^^^^^^^^^^^^
+
+This will define the following variables in your project:
+
+``lz4_FOUND``
+  true if (the requested version of) LZ4 is available.
+``lz4_VERSION``
+  the version of LZ4.
+``lz4_LIBRARIES``
+  the libraries to link against to use LZ4.
+``lz4_INCLUDE_DIRS``
+  where to find the LZ4 headers.
+
+#]=======================================================================]
+
+# use pkg-config to get the directories and then use these values in the FIND_PATH() and
+# FIND_LIBRARY() calls
+find_package(PkgConfig QUIET)
+pkg_check_modules(PKG_lz4 QUIET liblz4)
+
+set(lz4_VERSION ${PKG_lz4_VERSION})
+
+find_path(
+  lz4_INCLUDE_DIR
+  NAMES lz4frame.h
+  HINTS ${PKG_lz4_INCLUDE_DIRS}
+)
+
+find_library(
+  lz4_LIBRARY
+  NAMES lz4
+  HINTS ${PKG_lz4_LIBRARY_DIRS}
+)
+
+include(FindPackageHandleStandardArgs)
+find_package_handle_standard_args(
+  lz4
+  FOUND_VAR lz4_FOUND
+  REQUIRED_VARS lz4_LIBRARY lz4_INCLUDE_DIR
+  VERSION_VAR lz4_VERSION
+)
+
+if(lz4_FOUND AND NOT TARGET lz4::lz4)
+  add_library(lz4::lz4 UNKNOWN IMPORTED GLOBAL)
+  set_target_properties(
+    lz4::lz4 PROPERTIES IMPORTED_LOCATION "${lz4_LIBRARY}" INTERFACE_INCLUDE_DIRECTORIES
+                        "${lz4_INCLUDE_DIR}"
+  )
+endif()
+
+mark_as_advanced(lz4_LIBRARY lz4_INCLUDE_DIR)
+
+if(lz4_FOUND)
+  set(lz4_LIBRARIES ${lz4_LIBRARY})
+  set(lz4_INCLUDE_DIRS ${lz4_INCLUDE_DIR})
+endif()
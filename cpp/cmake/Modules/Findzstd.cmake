@@ -0,0 +1,82 @@
+# =============================================================================
+# Copyright (c) 2023, NVIDIA CORPORATION.
+#
+# Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except
+# in compliance with the License. You may obtain a copy of the License at
+#
+# http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software distributed under the License
+# is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+# or implied. See the License for the specific language governing permissions and limitations under
+# the License.
+
+#[=======================================================================[.rst:
+Findzstd
+--------
+
+Find Zstandard headers and libraries.
+
+Imported Targets
+^^^^^^^^^^^^^^^^
+
+``zstd::zstd``
+  The Zstandard library, if found.
+
+Result Variables
+^^^^^^^^^^^^^^^^
+
+This will define the following variables in your project:
+
+``zstd_FOUND``
+  true if (the requested version of) Zstandard is available.
+``zstd_VERSION``
+  the version of Zstandard.
+``zstd_LIBRARIES``
+  the libraries to link against to use Zstandard.
+``zstd_INCLUDE_DIRS``
+  where to find the Zstandard headers.
+
+#]=======================================================================]
+
+# use pkg-config to get the directories and then use these values in the FIND_PATH() and
+# FIND_LIBRARY() calls
+find_package(PkgConfig QUIET)
+pkg_check_modules(PKG_zstd QUIET libzstd)
+
+set(zstd_VERSION ${PKG_zstd_VERSION})
+
+find_path(
+  zstd_INCLUDE_DIR
+  NAMES zstd.h
+  HINTS ${PKG_zstd_INCLUDE_DIRS}
+)
+
+find_library(
+  zstd_LIBRARY
+  NAMES zstd
+  HINTS ${PKG_zstd_LIBRARY_DIRS}
+)
+
+include(FindPackageHandleStandardArgs)
+find_package_handle_standard_args(
+  zstd
+  FOUND_VAR zstd_FOUND
+  REQUIRED_VARS zstd_LIBRARY zstd_INCLUDE_DIR
+  VERSION_VAR zstd_VERSION
+)
+
+if(zstd_FOUND AND NOT TARGET zstd::zstd)
+  add_library(zstd::zstd UNKNOWN IMPORTED GLOBAL)
+  set_target_properties(
+    zstd::zstd PROPERTIES IMPORTED_LOCATION "${zstd_LIBRARY}" INTERFACE_INCLUDE_DIRECTORIES
+                          "${zstd_INCLUDE_DIR}"
+  )
+endif()
+
+mark_as_advanced(zstd_LIBRARY zstd_INCLUDE_DIR)
+
+if(zstd_FOUND)
+  set(zstd_LIBRARIES ${zstd_LIBRARY})
+  set(zstd_INCLUDE_DIRS ${zstd_INCLUDE_DIR})
+endif()
@@ -310,6 +310,13 @@ class literal : public expression {
    */
   [[nodiscard]] generic_scalar_device_view get_value() const { return value; }
 
+  /**
+   * @brief Get the scalar object.
+   *
+   * @return The underlying scalar
+   */
+  [[nodiscard]] cudf::scalar const& get_scalar() const { return scalar; }
+
   /**
    * @copydoc expression::accept
    */
@@ -18,6 +18,7 @@
 
 #include <cudf/table/table.hpp>
 #include <cudf/types.hpp>
+#include <cudf/utilities/span.hpp>
 
 #include <memory>
 #include <vector>
@@ -38,6 +39,11 @@ namespace cudf {
  *
  * Contains data from an array of columns in two contiguous buffers: one on host, which contains
  * table metadata and one on device which contains the table data.
+ *
+ * The metadata starts with a header holding a magic number, a format version, the byte order of the
+ * producer and a CRC32C checksum of the column descriptions, followed by the column descriptions.
+ * The metadata can thus be persisted or sent to another process and checked with `validate_packed`
+ * before it is passed to `unpack`.
  */
 struct packed_columns {
   packed_columns()
@@ -341,5 +347,45 @@ table_view unpack(packed_columns const& input);
  */
 table_view unpack(uint8_t const* metadata, uint8_t const* gpu_data);
 
+/**
+ * @brief Validates packed metadata, e.g. after it was received from another process.
+ *
+ * Checks the format version, the byte order and the metadata checksum, and that the column
+ * descriptions form valid column trees that only reference data within the first `data_size`
+ * bytes of the contiguous data buffer. The column descriptions are read in place.
+ *
+ * @throws cudf::logic_error if the metadata is not valid
+ *
+ * @param metadata The host-side metadata buffer
+ * @param data_size The size of the device-side contiguous data buffer
+ */
+void validate_packed(host_span<uint8_t const> metadata, std::size_t data_size);
+
+/**
+ * @brief Validates packed metadata and a host copy of the packed data.
+ *
+ * In addition to the checks of `validate_packed(host_span<uint8_t const>, std::size_t)`, checks
+ * the data against the data checksum, if the metadata holds one.
+ *
+ * @throws cudf::logic_error if the metadata is not valid or the data does not match its checksum
+ *
+ * @param metadata The host-side metadata buffer
+ * @param data Host copy of the contiguous data buffer
+ */
+void validate_packed(host_span<uint8_t const> metadata, host_span<uint8_t const> data);
+
+/**
+ * @brief Stores the CRC32C checksum of a host copy of the packed data in the packed metadata.
+ *
+ * The data is on the device when the metadata is built, so the data checksum is optional and only
+ * set by this function, e.g. after the data has been copied to the host for transfer.
+ *
+ * @throws cudf::logic_error if the metadata is not valid
+ *
+ * @param metadata The host-side metadata buffer to update
+ * @param data Host copy of the contiguous data buffer
+ */
+void set_packed_data_checksum(host_span<uint8_t> metadata, host_span<uint8_t const> data);
+
 /** @} */
 }  // namespace cudf
@@ -22,6 +22,8 @@
 
 #include <rmm/cuda_stream_view.hpp>
 
+#include <optional>
+
 namespace cudf {
 namespace detail {
 
@@ -101,6 +103,8 @@ class metadata_builder {
   /**
    * @brief Builds the opaque metadata for all added columns.
    *
+   * The metadata starts with a versioned header that holds a checksum of the column descriptions.
+   *
    * @returns A vector containing the serialized column metadata
    */
   std::vector<uint8_t> build() const;
@@ -123,5 +127,28 @@ std::vector<uint8_t> pack_metadata(table_view const& table,
                                    size_t buffer_size,
                                    metadata_builder& builder);
 
+/**
+ * @copydoc cudf::validate_packed(host_span<uint8_t const>, std::size_t)
+ */
+void validate_packed(host_span<uint8_t const> metadata, std::size_t data_size);
+
+/**
+ * @brief Returns the data checksum stored in the packed metadata, if any.
+ *
+ * @param metadata The host-side metadata buffer; must be valid
+ * @return The CRC32C checksum of the contiguous data buffer, if set
+ */
+std::optional<uint32_t> packed_data_checksum(host_span<uint8_t const> metadata);
+
+/**
+ * @brief Stores a CRC32C checksum of the packed data in the packed metadata.
+ *
+ * Allows the checksum to be computed as the data is copied to the host in chunks.
+ *
+ * @param metadata The host-side metadata buffer to update; must be valid
+ * @param data_checksum The CRC32C checksum of the contiguous data buffer
+ */
+void set_packed_data_checksum(host_span<uint8_t> metadata, uint32_t data_checksum);
+
 }  // namespace detail
 }  // namespace cudf
@@ -0,0 +1,38 @@
+/*
+ * Copyright (c) 2023, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/utilities/span.hpp>
+
+#include <cstdint>
+
+namespace cudf::detail {
+
+/**
+ * @brief Computes the CRC32C (Castagnoli) checksum of host data.
+ *
+ * The checksum of data split into several buffers is computed by passing the result for the
+ * preceding buffers as `crc`, e.g. `crc32c(b, crc32c(a))` equals the checksum of `a` followed by
+ * `b`.
+ *
+ * @param data Host data to checksum
+ * @param crc Checksum of the preceding data, or 0 for the first buffer
+ * @return The checksum of the data
+ */
+uint32_t crc32c(host_span<uint8_t const> data, uint32_t crc = 0);
+
+}  // namespace cudf::detail
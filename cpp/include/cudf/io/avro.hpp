@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020-2022, NVIDIA CORPORATION.
+ * Copyright (c) 2020-2023, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -29,6 +29,10 @@
 
 namespace cudf {
 namespace io {
+namespace detail::avro {
+class chunked_reader;
+}  // namespace detail::avro
+
 /**
  * @addtogroup io_readers
  * @{
@@ -218,6 +222,92 @@ table_with_metadata read_avro(
   avro_reader_options const& options,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief The chunked Avro reader class to read an Avro file iteratively into a series of tables,
+ * chunk by chunk.
+ *
+ * Each chunk holds the rows of a range of consecutive blocks of the file, so that very large files
+ * can be read without holding the whole decoded dataset in device memory at once. The size of a
+ * chunk is estimated from the column types and the encoded size of its blocks before they are
+ * decoded; chunks hold at least one block, so a chunk can exceed the limit when a single block
+ * does.
+ *
+ * The chunk limit bounds the output only. The whole file is read into host memory once, when the
+ * reader is constructed, to index its blocks; each chunk then reads its own blocks again. The
+ * rows selected from the file are counted with `size_type`, so all chunks together hold at most
+ * `std::numeric_limits<size_type>::max()` rows; use `skip_rows` and `num_rows` to read larger
+ * files in parts.
+ *
+ * The following code snippet demonstrates how to read a dataset from a file in chunks:
+ * @code
+ *  auto source  = cudf::io::source_info("dataset.avro");
+ *  auto options = cudf::io::avro_reader_options::builder(source);
+ *  auto reader  = cudf::io::chunked_avro_reader(1 << 30, options);
+ *  while (reader.has_next()) {
+ *    auto chunk = reader.read_chunk();
+ *    // Process chunk
+ *  }
+ * @endcode
+ */
+class chunked_avro_reader {
+ public:
+  /**
+   * @brief Default constructor, this should never be used.
+   *
+   * This is added just to satisfy cython.
+   */
+  chunked_avro_reader() = default;
+
+  /**
+   * @brief Constructor for chunked reader.
+   *
+   * This constructor requires the same `avro_reader_option` parameter as in
+   * `cudf::read_avro()`, and an additional parameter to specify the size byte limit of the
+   * output table for each reading.
+   *
+   * @param chunk_read_limit Limit on total number of bytes to be returned per read,
+   *        or `0` if there is no limit
+   * @param options The options used to read Avro file
+   * @param mr Device memory resource to use for device memory allocation
+   */
+  chunked_avro_reader(
+    std::size_t chunk_read_limit,
+    avro_reader_options const& options,
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+  /**
+   * @brief Destructor, destroying the internal reader instance.
+   *
+   * Since the declaration of the internal `reader` object does not exist in this header, this
+   * destructor needs to be defined in a separate source file which can access to that object's
+   * declaration.
+   */
+  ~chunked_avro_reader();
+
+  /**
+   * @brief Check if there is any data in the given file has not yet read.
+   *
+   * @return A boolean value indicating if there is any data left to read
+   */
+  [[nodiscard]] bool has_next() const;
+
+  /**
+   * @brief Read a chunk of rows in the given Avro file.
+   *
+   * The sequence of returned tables, if concatenated by their order, guarantees to form a complete
+   * dataset as reading the entire given file at once.
+   *
+   * An empty table will be returned if the given file is empty, or all the data in the file has
+   * been read and returned by the previous calls.
+   *
+   * @return An output `cudf::table` along with its metadata
+   */
+  [[nodiscard]] table_with_metadata read_chunk() const;
+
+ private:
+  std::unique_ptr<cudf::io::detail::avro::chunked_reader> reader;
+};
+
 /** @} */  // end of group
 }  // namespace io
 }  // namespace cudf
@@ -16,6 +16,7 @@
 
 #pragma once
 
+#include <cudf/io/seek_index.hpp>
 #include <cudf/io/types.hpp>
 #include <cudf/table/table_view.hpp>
 #include <cudf/types.hpp>
@@ -58,6 +59,8 @@ class csv_reader_options {
   std::size_t _byte_range_offset = 0;
   // Bytes to read; always reads complete rows
   std::size_t _byte_range_size = 0;
+  // Seek index of the compressed source, used to read byte ranges of the decompressed data
+  std::shared_ptr<compressed_seek_index const> _seek_index;
   // Names of all the columns; if empty then names are auto-generated
   std::vector<std::string> _names;
   // If there is no header or names, prepend this to the column ID as the name
@@ -200,6 +203,16 @@ class csv_reader_options {
     }
   }
 
+  /**
+   * @brief Returns the seek index of the compressed source.
+   *
+   * @return Seek index; null if not set
+   */
+  [[nodiscard]] std::shared_ptr<compressed_seek_index const> const& get_seek_index() const
+  {
+    return _seek_index;
+  }
+
   /**
    * @brief Returns number of bytes to pad when reading.
    *
@@ -507,6 +520,19 @@ class csv_reader_options {
     _byte_range_size = size;
   }
 
+  /**
+   * @brief Sets the seek index of the compressed source.
+   *
+   * With a seek index, reading a byte range only decompresses the data from the last seek point
+   * before the range; without one, the source is decompressed from the start.
+   *
+   * @param index Seek index built with `build_seek_index`
+   */
+  void set_seek_index(std::shared_ptr<compressed_seek_index const> index)
+  {
+    _seek_index = std::move(index);
+  }
+
   /**
    * @brief Sets names of the column.
    *
@@ -873,6 +899,18 @@ class csv_reader_options_builder {
     return *this;
   }
 
+  /**
+   * @brief Sets the seek index of the compressed source.
+   *
+   * @param index Seek index built with `build_seek_index`
+   * @return this for chaining
+   */
+  csv_reader_options_builder& seek_index(std::shared_ptr<compressed_seek_index const> index)
+  {
+    options._seek_index = std::move(index);
+    return *this;
+  }
+
   /**
    * @brief Sets names of the column.
    *
@@ -111,6 +111,31 @@ class data_sink {
    */
   virtual void host_write(void const* data, size_t size) = 0;
 
+  /**
+   * @brief Asynchronously append the buffer content to the sink
+   *
+   * Writes are appended in the order of the calls, including the calls to `host_write`, so the
+   * caller can fill the next buffer while the previous one is being written. The default
+   * implementation writes synchronously with `host_write`.
+   *
+   * `data` must not be freed or modified until this call is synchronized.
+   * @code{.pseudo}
+   * auto result = host_write_async(data, size);
+   * result.wait(); // OR result.get()
+   * @endcode
+   *
+   * @param data Pointer to the buffer to be written into the sink object
+   * @param size Number of bytes to write
+   * @return a future that can be used to synchronize the call
+   */
+  virtual std::future<void> host_write_async(void const* data, size_t size)
+  {
+    host_write(data, size);
+    std::promise<void> written;
+    written.set_value();
+    return written.get_future();
+  }
+
   /**
    * @brief Whether or not this sink supports writing from gpu memory addresses.
    *
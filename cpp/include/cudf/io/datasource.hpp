@@ -53,6 +53,9 @@
 
 #include <future>
 #include <memory>
+#include <optional>
+#include <string>
+#include <vector>
 
 namespace cudf {
 //! IO interfaces
@@ -111,6 +114,23 @@ class datasource {
     }
   };
 
+  /**
+   * @brief Byte range of the source, used to request multiple reads in a single call.
+   */
+  struct range {
+    size_t offset;  ///< Bytes from the start of the source
+    size_t size;    ///< Number of bytes in the range
+  };
+
+  /**
+   * @brief Identifies the data of a source, used to cache information parsed from it.
+   */
+  struct source_identity {
+    std::string path;           ///< Path of the source
+    size_t size;                ///< Size of the source data in bytes
+    int64_t modification_time;  ///< Time of the last modification, in nanoseconds
+  };
+
   /**
    * @brief Creates a source from a file path.
    *
@@ -209,6 +229,54 @@ class datasource {
    */
   virtual size_t host_read(size_t offset, size_t size, uint8_t* dst) = 0;
 
+  /**
+   * @brief Returns buffers with the data from multiple ranges of the source.
+   *
+   * The default implementation merges ranges that are separated by gaps of up to
+   * `LIBCUDF_HOST_READ_MAX_GAP` bytes (default 64KB) into a single read, and splits merged reads
+   * larger than `LIBCUDF_HOST_READ_SLICE_SIZE` bytes (default 4MB) into multiple `host_read_async`
+   * calls that are all issued before waiting on any of them. This reduces the number of separate
+   * requests for sources where each request is costly, such as remote object stores.
+   *
+   * @param ranges Ranges to read; may be unordered and overlapping
+   *
+   * @return The data buffers, one per range, in the order of `ranges` (can be smaller than the
+   * requested sizes)
+   */
+  virtual std::vector<std::unique_ptr<datasource::buffer>> host_read_ranges(
+    cudf::host_span<range const> ranges);
+
+  /**
+   * @brief Whether or not this source performs `host_read_async` calls asynchronously.
+   *
+   * Readers may issue multiple `host_read_async` calls before waiting on any of them when this
+   * function returns true. Otherwise, `host_read` calls are preferred as they can avoid a copy.
+   *
+   * @return bool Whether this source supports asynchronous host reads
+   */
+  [[nodiscard]] virtual bool supports_host_read_async() const { return false; }
+
+  /**
+   * @brief Asynchronously reads a selected range into a preallocated host buffer.
+   *
+   * Returns a future value that contains the number of bytes read. Calling `get()` method of the
+   * return value synchronizes this function. It is the caller's responsibility to keep `dst` valid
+   * until then.
+   *
+   * The default implementation defers a `host_read` call until the result is requested.
+   *
+   * @param offset Number of bytes from the start
+   * @param size Number of bytes to read
+   * @param dst Address of the existing host memory
+   *
+   * @return The number of bytes read as a future value (can be smaller than size)
+   */
+  virtual std::future<size_t> host_read_async(size_t offset, size_t size, uint8_t* dst)
+  {
+    return std::async(std::launch::deferred,
+                      [this, offset, size, dst] { return host_read(offset, size, dst); });
+  }
+
   /**
    * @brief Whether or not this source supports reading directly into device memory.
    *
@@ -314,6 +382,17 @@ class datasource {
    */
   [[nodiscard]] virtual size_t size() const = 0;
 
+  /**
+   * @brief Returns the identity of the source data, if the source can provide one.
+   *
+   * Readers may cache information parsed from sources with an identity, such as file footers. Data
+   * source implementations that cannot detect changes in their data don't need to override this
+   * function.
+   *
+   * @return The identity of the source data, or an empty value if unknown
+   */
+  [[nodiscard]] virtual std::optional<source_identity> identity() const { return std::nullopt; }
+
   /**
    * @brief Returns whether the source contains any data.
    *
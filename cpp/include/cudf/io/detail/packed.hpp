@@ -0,0 +1,53 @@
+/*
+ * Copyright (c) 2023, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/io/data_sink.hpp>
+#include <cudf/io/datasource.hpp>
+#include <cudf/io/packed.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+
+namespace cudf {
+namespace io {
+namespace detail {
+namespace packed {
+
+/**
+ * @copydoc cudf::io::write_packed
+ *
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ */
+void write_packed(table_view const& input,
+                  data_sink& sink,
+                  std::size_t bounce_buffer_size,
+                  rmm::cuda_stream_view stream,
+                  rmm::mr::device_memory_resource* mr);
+
+/**
+ * @copydoc cudf::io::read_packed
+ *
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ */
+packed_columns read_packed(datasource& source,
+                           rmm::cuda_stream_view stream,
+                           rmm::mr::device_memory_resource* mr);
+
+}  // namespace packed
+}  // namespace detail
+}  // namespace io
+}  // namespace cudf
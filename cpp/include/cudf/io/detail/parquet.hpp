@@ -67,6 +67,24 @@ class reader {
                   rmm::cuda_stream_view stream,
                   rmm::mr::device_memory_resource* mr);
 
+  /**
+   * @brief Constructor from the files of a dataset, whose footers are taken from the summary
+   * metadata of the dataset instead of being read from the files
+   *
+   * @param sources Input `datasource` objects of the files to read
+   * @param dataset Summary metadata of the dataset
+   * @param file_indices Index in `dataset.files()` of the file of each source
+   * @param options Settings for controlling reading behavior
+   * @param stream CUDA stream used for device memory operations and kernel launches.
+   * @param mr Device memory resource to use for device memory allocation
+   */
+  explicit reader(std::vector<std::unique_ptr<cudf::io::datasource>>&& sources,
+                  parquet_dataset_metadata const& dataset,
+                  host_span<size_type const> file_indices,
+                  parquet_reader_options const& options,
+                  rmm::cuda_stream_view stream,
+                  rmm::mr::device_memory_resource* mr);
+
   /**
    * @brief Destructor explicitly-declared to avoid inlined in header
    */
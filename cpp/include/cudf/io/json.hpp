@@ -16,6 +16,7 @@
 
 #pragma once
 
+#include "seek_index.hpp"
 #include "types.hpp"
 
 #include <cudf/table/table_view.hpp>
@@ -24,6 +25,7 @@
 #include <rmm/mr/device/per_device_resource.hpp>
 
 #include <map>
+#include <memory>
 #include <string>
 #include <variant>
 #include <vector>
@@ -103,6 +105,8 @@ class json_reader_options {
   size_t _byte_range_offset = 0;
   // Bytes to read; always reads complete rows
   size_t _byte_range_size = 0;
+  // Seek index of the compressed source, used to read byte ranges of the decompressed data
+  std::shared_ptr<compressed_seek_index const> _seek_index;
 
   // Whether to parse dates as DD/MM versus MM/DD
   bool _dayfirst = false;
@@ -196,6 +200,16 @@ class json_reader_options {
     }
   }
 
+  /**
+   * @brief Returns the seek index of the compressed source.
+   *
+   * @return Seek index; null if not set
+   */
+  std::shared_ptr<compressed_seek_index const> const& get_seek_index() const
+  {
+    return _seek_index;
+  }
+
   /**
    * @brief Returns number of bytes to pad when reading.
    *
@@ -295,6 +309,19 @@ class json_reader_options {
    */
   void set_byte_range_size(size_type size) { _byte_range_size = size; }
 
+  /**
+   * @brief Sets the seek index of the compressed source.
+   *
+   * With a seek index, reading a byte range only decompresses the data from the last seek point
+   * before the range; without one, the source is decompressed from the start.
+   *
+   * @param index Seek index built with `build_seek_index`
+   */
+  void set_seek_index(std::shared_ptr<compressed_seek_index const> index)
+  {
+    _seek_index = std::move(index);
+  }
+
   /**
    * @brief Set whether to read the file as a json object per line.
    *
@@ -425,6 +452,18 @@ class json_reader_options_builder {
     return *this;
   }
 
+  /**
+   * @brief Sets the seek index of the compressed source.
+   *
+   * @param index Seek index built with `build_seek_index`
+   * @return this for chaining
+   */
+  json_reader_options_builder& seek_index(std::shared_ptr<compressed_seek_index const> index)
+  {
+    options._seek_index = std::move(index);
+    return *this;
+  }
+
   /**
    * @brief Set whether to read the file as a json object per line.
    *
@@ -0,0 +1,70 @@
+/*
+ * Copyright (c) 2023, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <string>
+
+namespace cudf {
+namespace io {
+/**
+ * @addtogroup io_readers
+ * @{
+ * @file
+ */
+
+/**
+ * @brief Sets the maximum total size of the process-wide cache of parsed file metadata.
+ *
+ * When the cache is enabled, the Parquet and ORC readers keep the parsed footers of the files they
+ * read, so that repeated reads of the same files skip reading and parsing the footer. Entries are
+ * keyed by the file path, size and modification time; a file that has been modified is parsed
+ * again. The least recently used entries are evicted when the total size of the cached footers
+ * exceeds the limit.
+ *
+ * The cache is disabled by default. The initial limit can also be set through the
+ * `LIBCUDF_METADATA_CACHE_SIZE` environment variable. Reducing the limit evicts entries
+ * immediately.
+ *
+ * @param size_limit Maximum total size of the cached footers, in bytes; zero disables the cache
+ */
+void set_metadata_cache_size_limit(std::size_t size_limit);
+
+/**
+ * @brief Returns the maximum total size of the process-wide cache of parsed file metadata.
+ *
+ * @return The size limit in bytes; zero if the cache is disabled
+ */
+std::size_t get_metadata_cache_size_limit();
+
+/**
+ * @brief Removes the cached metadata of the given file, in all formats.
+ *
+ * Only needed when a file is replaced without changing its size or modification time.
+ *
+ * @param filepath Path of the file, as passed to the reader
+ */
+void invalidate_cached_metadata(std::string const& filepath);
+
+/**
+ * @brief Removes all entries from the process-wide cache of parsed file metadata.
+ */
+void clear_metadata_cache();
+
+/** @} */  // end of group
+}  // namespace io
+}  // namespace cudf
@@ -16,6 +16,7 @@
 
 #pragma once
 
+#include <cudf/ast/expressions.hpp>
 #include <cudf/io/detail/orc.hpp>
 #include <cudf/io/types.hpp>
 #include <cudf/table/table_view.hpp>
@@ -23,6 +24,7 @@
 
 #include <rmm/mr/device/per_device_resource.hpp>
 
+#include <functional>
 #include <memory>
 #include <optional>
 #include <string>
@@ -62,6 +64,9 @@ class orc_reader_options {
   // Rows to read; `nullopt` is all
   std::optional<size_type> _num_rows;
 
+  // Predicate filter as AST to filter output rows.
+  std::optional<std::reference_wrapper<ast::expression const>> _filter;
+
   // Whether to use row index to speed-up reading
   bool _use_index = true;
 
@@ -134,6 +139,13 @@ class orc_reader_options {
    */
   std::optional<size_type> const& get_num_rows() const { return _num_rows; }
 
+  /**
+   * @brief Returns AST based filter for predicate pushdown.
+   *
+   * @return AST expression to use as filter
+   */
+  [[nodiscard]] auto const& get_filter() const { return _filter; }
+
   /**
    * @brief Whether to use row index to speed-up reading.
    *
@@ -218,6 +230,17 @@ class orc_reader_options {
     _num_rows = nrows;
   }
 
+  /**
+   * @brief Sets AST based filter for predicate pushdown.
+   *
+   * Stripes are pruned using the stripe statistics in the file footer and the row group statistics
+   * in the row index, unless rows are selected with `skip_rows` or `num_rows`. The filter is then
+   * applied to the rows that are read.
+   *
+   * @param filter AST expression to use as filter
+   */
+  void set_filter(ast::expression const& filter) { _filter = filter; }
+
   /**
    * @brief Enable/Disable use of row index to speed-up reading.
    *
@@ -319,6 +342,18 @@ class orc_reader_options_builder {
     return *this;
   }
 
+  /**
+   * @brief Sets AST based filter for predicate pushdown.
+   *
+   * @param filter AST expression to use as filter
+   * @return this for chaining
+   */
+  orc_reader_options_builder& filter(ast::expression const& filter)
+  {
+    options.set_filter(filter);
+    return *this;
+  }
+
   /**
    * @brief Enable/Disable use of row index to speed-up reading.
    *
@@ -402,6 +437,94 @@ table_with_metadata read_orc(
   orc_reader_options const& options,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief The chunked ORC reader class to read an ORC dataset iteratively into a series of tables,
+ * chunk by chunk.
+ *
+ * Each chunk holds the rows of a range of consecutive stripes, so that very large datasets can be
+ * read without materializing the streams and the output columns of all selected stripes at once.
+ * The stripes of a chunk are selected so that the estimated size of the output table stays within
+ * the chunk read limit and the estimated size of the stripe data, compressed and decompressed,
+ * stays within the pass read limit. Sizes are estimated before decoding, from the column types and
+ * the stream sizes in the stripe footers, scaled by the compression ratio observed in the previous
+ * chunks. Each chunk holds at least one stripe, so a chunk exceeds the limits when a single stripe
+ * does.
+ */
+class chunked_orc_reader {
+ public:
+  /**
+   * @brief Default constructor, this should never be used.
+   *
+   * This is added just to satisfy cython.
+   */
+  chunked_orc_reader() = default;
+
+  /**
+   * @brief Constructor for chunked reader.
+   *
+   * This constructor requires the same `orc_reader_option` parameter as in `cudf::read_orc()`,
+   * and an additional parameter to specify the size byte limit of the output table for each
+   * reading.
+   *
+   * @param chunk_read_limit Limit on total number of bytes to be returned per read,
+   *        or `0` if there is no limit
+   * @param options The options used to read ORC file
+   * @param mr Device memory resource to use for device memory allocation
+   */
+  chunked_orc_reader(
+    std::size_t chunk_read_limit,
+    orc_reader_options const& options,
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+  /**
+   * @brief Constructor for chunked reader with a limit on the memory used to read the stripes.
+   *
+   * @param chunk_read_limit Limit on total number of bytes to be returned per read,
+   *        or `0` if there is no limit
+   * @param pass_read_limit Limit on the memory used to read and decompress the stripe data of
+   *        each read, or `0` if there is no limit
+   * @param options The options used to read ORC file
+   * @param mr Device memory resource to use for device memory allocation
+   */
+  chunked_orc_reader(
+    std::size_t chunk_read_limit,
+    std::size_t pass_read_limit,
+    orc_reader_options const& options,
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+  /**
+   * @brief Destructor, destroying the internal reader instance.
+   *
+   * Since the declaration of the internal `reader` object does not exist in this header, this
+   * destructor needs to be defined in a separate source file which can access to that object's
+   * declaration.
+   */
+  ~chunked_orc_reader();
+
+  /**
+   * @brief Check if there is any data in the given dataset has not yet read.
+   *
+   * @return A boolean value indicating if there is any data left to read
+   */
+  [[nodiscard]] bool has_next() const;
+
+  /**
+   * @brief Read a chunk of rows in the given ORC dataset.
+   *
+   * The sequence of returned tables, if concatenated by their order, guarantees to form a complete
+   * dataset as reading the entire given dataset at once.
+   *
+   * An empty table will be returned if the given dataset is empty, or all the data in the dataset
+   * has been read and returned by the previous calls.
+   *
+   * @return An output `cudf::table` along with its metadata
+   */
+  [[nodiscard]] table_with_metadata read_chunk() const;
+
+ private:
+  std::unique_ptr<cudf::io::detail::orc::chunked_reader> reader;
+};
+
 /** @} */  // end of group
 /**
  * @addtogroup io_writers
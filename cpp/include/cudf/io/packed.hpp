@@ -0,0 +1,85 @@
+/*
+ * Copyright (c) 2023, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/contiguous_split.hpp>
+#include <cudf/io/types.hpp>
+#include <cudf/table/table_view.hpp>
+
+#include <rmm/mr/device/per_device_resource.hpp>
+
+#include <cstddef>
+
+namespace cudf {
+namespace io {
+
+/**
+ * @brief Writes a table to a sink in the packed format of `cudf::pack`, e.g. to spill it from
+ * device memory to a local file or to host memory.
+ *
+ * @ingroup io_writers
+ *
+ * The data of the table is packed with `cudf::chunked_pack` into a device bounce buffer, a chunk at
+ * a time, so that no device memory of the size of the table is needed. Each chunk is copied to
+ * page-locked host memory and written to the sink while the next chunk is packed.
+ *
+ * The output holds a fixed-size header (the "CUPK" magic number, a format version, and the sizes
+ * of the metadata and of the data), followed by the packed data and the packed metadata. Integers
+ * in the header are little-endian. When the data is written from host memory, the CRC32C checksum
+ * of the data is stored in the metadata (see `cudf::set_packed_data_checksum`). Use `read_packed`
+ * to restore the table.
+ *
+ * @code
+ *  cudf::io::write_packed(table, cudf::io::sink_info{"spill.bin"});
+ *  auto const packed = cudf::io::read_packed(cudf::io::source_info{"spill.bin"});
+ *  auto const restored = cudf::unpack(packed);
+ * @endcode
+ *
+ * @param input View of the table to write
+ * @param sink Sink to write to
+ * @param bounce_buffer_size Size of the device bounce buffer (in bytes); must be at least 1MB
+ * @param mr Device memory resource to use for the bounce buffer and the temporary allocations
+ */
+void write_packed(table_view const& input,
+                  sink_info const& sink,
+                  std::size_t bounce_buffer_size = 64 * 1024 * 1024,
+                  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Reads a table written by `write_packed` into device memory.
+ *
+ * @ingroup io_readers
+ *
+ * The data is copied to a single device buffer a chunk at a time. Local files are memory mapped,
+ * so the chunks are copied to the device directly from the mapping.
+ *
+ * The metadata is checked with `cudf::validate_packed`, and the data is checked against its
+ * checksum when the metadata holds one and the data is read through host memory.
+ *
+ * @throws cudf::logic_error if the source does not hold a table in a supported packed format
+ * @throws cudf::logic_error if the data does not match its checksum
+ *
+ * @param source Source to read from
+ * @param mr Device memory resource to use for the device memory allocation of the returned data
+ * @return The packed metadata and data; pass to `cudf::unpack` to get the `table_view`
+ */
+packed_columns read_packed(
+  source_info const& source,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+}  // namespace io
+}  // namespace cudf
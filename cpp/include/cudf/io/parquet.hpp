@@ -410,6 +410,66 @@ table_with_metadata read_parquet(
   parquet_reader_options const& options,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Reads a Parquet dataset through its summary metadata.
+ *
+ * The footers of the data files are taken from the summary instead of being read from each file,
+ * and the data files are opened only if they hold row groups to read. The path of each file is
+ * resolved against `dataset_path`, unless it is absolute.
+ *
+ * The source of `options` is not used. The row groups, if set, are given per file of the dataset,
+ * in the order of `dataset.files()`; files without row groups to read are not opened. Otherwise,
+ * `skip_rows` and `num_rows` count rows from the start of the dataset, and the files outside of
+ * this range are not opened. With a filter, files whose row groups are all filtered out by their
+ * statistics are not opened either.
+ *
+ * @code
+ *  auto summary = cudf::io::source_info{"dataset/_metadata"};
+ *  auto dataset = cudf::io::parquet_dataset_metadata(summary);
+ *  auto options = cudf::io::parquet_reader_options::builder(summary).skip_rows(1000).num_rows(100);
+ *  auto result  = cudf::io::read_parquet_dataset(dataset, "dataset", options);
+ * @endcode
+ *
+ * @throw cudf::logic_error if the row groups are not given for each file of the dataset
+ *
+ * @param dataset Summary metadata of the dataset
+ * @param dataset_path Directory of the dataset
+ * @param options Settings for controlling reading behavior
+ * @param mr Device memory resource used to allocate device memory of the table in the returned
+ * table_with_metadata
+ *
+ * @return The set of columns along with metadata
+ */
+table_with_metadata read_parquet_dataset(
+  parquet_dataset_metadata const& dataset,
+  std::string const& dataset_path,
+  parquet_reader_options const& options,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Reads a Parquet dataset through its `_metadata` file.
+ *
+ * The source of `options` is the path of the `_metadata` file, and the dataset directory is the
+ * directory of this file. See the overload above for how the rows to read are selected.
+ *
+ * @code
+ *  auto source  = cudf::io::source_info("dataset/_metadata");
+ *  auto options = cudf::io::parquet_reader_options::builder(source);
+ *  auto result  = cudf::io::read_parquet_dataset(options);
+ * @endcode
+ *
+ * @throw cudf::logic_error if the source is not a single file path
+ *
+ * @param options Settings for controlling reading behavior
+ * @param mr Device memory resource used to allocate device memory of the table in the returned
+ * table_with_metadata
+ *
+ * @return The set of columns along with metadata
+ */
+table_with_metadata read_parquet_dataset(
+  parquet_reader_options const& options,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 /**
  * @brief The chunked parquet reader class to read Parquet file iteratively in to a series of
  * tables, chunk by chunk.
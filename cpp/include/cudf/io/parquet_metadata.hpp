@@ -22,8 +22,11 @@
 #pragma once
 
 #include <cudf/io/types.hpp>
+#include <cudf/utilities/span.hpp>
 
+#include <memory>
 #include <optional>
+#include <string>
 #include <string_view>
 #include <variant>
 #include <vector>
@@ -227,5 +230,128 @@ class parquet_metadata {
  */
 parquet_metadata read_parquet_metadata(source_info const& src_info);
 
+namespace detail::parquet {
+class dataset_metadata;
+class reader;
+}  // namespace detail::parquet
+
+/**
+ * @brief Information about a file of a parquet dataset, as recorded in its summary metadata.
+ */
+struct parquet_dataset_file {
+  std::string path;         ///< Path of the file, as recorded in its column chunks
+  size_type num_rowgroups;  ///< Number of row groups in the file
+  int64_t num_rows;         ///< Number of rows in the file
+};
+
+/**
+ * @brief Summary metadata of a dataset of parquet files, in the form of the Hive/Spark
+ * `_metadata` and `_common_metadata` files.
+ *
+ * `_metadata` holds the schema and the row groups of all files of the dataset, with the column
+ * chunks pointing to their file through `file_path`, so that readers that support summary files
+ * can plan reads of the dataset from this file alone instead of opening the footer of each file.
+ * `_common_metadata` only holds the schema and the key-value metadata.
+ *
+ * `read_parquet_dataset` reads a dataset through its summary: the footers of the data files are
+ * taken from the summary, and only the data files that hold the selected rows are opened.
+ * `read_parquet`, instead, parses the footer of each data file it reads.
+ *
+ * The summary is built incrementally: the row groups are kept encoded, so appending a file only
+ * encodes the row groups of that file, and loading an existing `_metadata` file does not decode
+ * the column chunk metadata. All files must have the same schema; the key-value metadata and the
+ * `created_by` field are taken from the first file.
+ *
+ * @code
+ *  auto summary = cudf::io::parquet_dataset_metadata(cudf::io::source_info{"dataset/_metadata"});
+ *  summary.append_file("part-0042.parquet", cudf::io::source_info{"dataset/part-0042.parquet"});
+ *  summary.write_metadata(cudf::io::sink_info{"dataset/_metadata"});
+ * @endcode
+ */
+class parquet_dataset_metadata {
+ public:
+  /**
+   * @brief Constructs the summary of an empty dataset.
+   */
+  parquet_dataset_metadata();
+
+  /**
+   * @brief Loads an existing `_metadata` file.
+   *
+   * @param summary Source of the `_metadata` file
+   */
+  explicit parquet_dataset_metadata(source_info const& summary);
+
+  /**
+   * @brief Destructor, destroys internal summary.
+   */
+  ~parquet_dataset_metadata();
+
+  /**
+   * @brief Move constructor.
+   */
+  parquet_dataset_metadata(parquet_dataset_metadata&&) noexcept;
+
+  /**
+   * @brief Move assignment operator.
+   *
+   * @return Reference to this object
+   */
+  parquet_dataset_metadata& operator=(parquet_dataset_metadata&&) noexcept;
+
+  /**
+   * @brief Appends the row groups of a file, given the metadata blob returned by `write_parquet`.
+   *
+   * @throw cudf::logic_error if the schema of the file does not match the schema of the dataset
+   *
+   * @param file_path Path of the file, relative to the dataset directory
+   * @param file_metadata Metadata blob of the file
+   */
+  void append_file_metadata(std::string const& file_path, host_span<uint8_t const> file_metadata);
+
+  /**
+   * @brief Appends the row groups of a file, read from its footer.
+   *
+   * @throw cudf::logic_error if the schema of the file does not match the schema of the dataset
+   *
+   * @param file_path Path of the file, relative to the dataset directory
+   * @param file Source of the parquet file
+   */
+  void append_file(std::string const& file_path, source_info const& file);
+
+  /**
+   * @brief Returns the total number of rows in the dataset.
+   *
+   * @return Number of rows
+   */
+  [[nodiscard]] int64_t num_rows() const;
+
+  /**
+   * @brief Returns the files of the dataset, in the order of their row groups.
+   *
+   * @return The files of the dataset
+   */
+  [[nodiscard]] std::vector<parquet_dataset_file> const& files() const;
+
+  /**
+   * @brief Writes the `_metadata` file.
+   *
+   * @param sink Sink of the `_metadata` file
+   */
+  void write_metadata(sink_info const& sink) const;
+
+  /**
+   * @brief Writes the `_common_metadata` file.
+   *
+   * @param sink Sink of the `_common_metadata` file
+   */
+  void write_common_metadata(sink_info const& sink) const;
+
+ private:
+  friend class detail::parquet::reader;
+
+  std::unique_ptr<detail::parquet::dataset_metadata> _impl;
+};
+
 }  // namespace io
 }  // namespace cudf
@@ -0,0 +1,161 @@
+/*
+ * Copyright (c) 2023, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/io/types.hpp>
+#include <cudf/utilities/span.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace cudf {
+namespace io {
+/**
+ * @addtogroup io_readers
+ * @{
+ * @file
+ */
+
+/**
+ * @brief Position in a compressed source from which decompression can start.
+ */
+struct seek_point {
+  /// Offset of the first compressed byte to read
+  uint64_t compressed_offset = 0;
+  /// Offset of the data decompressed from this point, in the decompressed data
+  uint64_t uncompressed_offset = 0;
+  /// Number of bits of the byte before `compressed_offset` that belong to the next DEFLATE block
+  uint8_t bit_offset = 0;
+  /// Decompressed data preceding the point (up to 32KB) that DEFLATE blocks may refer to; empty if
+  /// the point is the start of a GZIP member or of a ZSTD frame
+  std::vector<uint8_t> window;
+};
+
+/**
+ * @brief Index of the positions in a compressed source from which decompression can start.
+ *
+ * The index lets readers decompress only the data in a byte range of the decompressed data, so
+ * that `byte_range_offset` and `byte_range_size` can be used with compressed CSV and JSON inputs.
+ * Building the index requires a pass over the whole source; the index can then be stored next to
+ * the source with `write_seek_index` and shared by all the readers of the source.
+ */
+class compressed_seek_index {
+ public:
+  compressed_seek_index() = default;
+
+  /**
+   * @brief Constructor from the seek points.
+   *
+   * @param compression Compression type of the source
+   * @param points Seek points, sorted by offset; the first one must be at the start of the source
+   * @param uncompressed_size Size of the decompressed data
+   */
+  compressed_seek_index(compression_type compression,
+                        std::vector<seek_point> points,
+                        uint64_t uncompressed_size);
+
+  /**
+   * @brief Returns the compression type of the indexed source.
+   *
+   * @return Compression type
+   */
+  [[nodiscard]] compression_type compression() const { return _compression; }
+
+  /**
+   * @brief Returns the seek points, sorted by offset.
+   *
+   * @return Seek points
+   */
+  [[nodiscard]] host_span<seek_point const> points() const { return _points; }
+
+  /**
+   * @brief Returns the size of the decompressed data.
+   *
+   * @return Size in bytes
+   */
+  [[nodiscard]] uint64_t uncompressed_size() const { return _uncompressed_size; }
+
+  /**
+   * @brief Returns the last seek point at or before the given offset in the decompressed data.
+   *
+   * @param uncompressed_offset Offset in the decompressed data
+   * @return The seek point
+   */
+  [[nodiscard]] seek_point const& find(uint64_t uncompressed_offset) const;
+
+  /**
+   * @brief Serializes the index, to be stored in a sidecar file.
+   *
+   * @return Serialized index
+   */
+  [[nodiscard]] std::vector<uint8_t> serialize() const;
+
+  /**
+   * @brief Deserializes an index produced by `serialize`.
+   *
+   * @param data Serialized index
+   * @return The index
+   */
+  static compressed_seek_index deserialize(host_span<uint8_t const> data);
+
+ private:
+  compression_type _compression = compression_type::NONE;
+  std::vector<seek_point> _points;
+  uint64_t _uncompressed_size = 0;
+};
+
+/**
+ * @brief Builds the seek index of a compressed source.
+ *
+ * Supports GZIP and ZSTD files. For BGZF files, seek points are placed at the start of blocks,
+ * whose offsets are read from the block headers without decompressing the data. For other GZIP
+ * files, building the index decompresses the whole file; seek points are placed at the start of
+ * GZIP members and at DEFLATE block boundaries, where they store the preceding 32KB of
+ * decompressed data. For ZSTD files, building the index decompresses the whole file; seek points
+ * are placed at the start of frames, so a file written as a single frame can only be read from
+ * its start.
+ *
+ * @param info Compressed source; only a single source is supported
+ * @param compression Compression type of the source; `AUTO` to detect it from the contents
+ * @param spacing Minimum distance between seek points, in bytes of decompressed data
+ *
+ * @return The seek index
+ */
+compressed_seek_index build_seek_index(source_info const& info,
+                                       compression_type compression = compression_type::AUTO,
+                                       std::size_t spacing          = 1024 * 1024);
+
+/**
+ * @brief Writes a seek index to a sidecar file or buffer.
+ *
+ * @param index Seek index
+ * @param sink Destination; only a single sink is supported
+ */
+void write_seek_index(compressed_seek_index const& index, sink_info const& sink);
+
+/**
+ * @brief Reads a seek index written with `write_seek_index`.
+ *
+ * @param info Source of the index; only a single source is supported
+ * @return The seek index
+ */
+compressed_seek_index read_seek_index(source_info const& info);
+
+/** @} */  // end of group
+}  // namespace io
+}  // namespace cudf
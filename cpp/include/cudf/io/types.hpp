@@ -578,6 +578,7 @@ class column_in_metadata {
   bool _list_column_is_map  = false;
   bool _use_int96_timestamp = false;
   bool _output_as_binary    = false;
+  bool _bloom_filter        = false;
   std::optional<uint8_t> _decimal_precision;
   std::optional<int32_t> _parquet_field_id;
   std::vector<column_in_metadata> children;
@@ -692,6 +693,28 @@ class column_in_metadata {
     return *this;
   }
 
+  /**
+   * @brief Specifies whether a Bloom filter should be written for each chunk of this column
+   * Only valid for the following column types:
+   * Parquet: integral (except bool), floating point, decimal32, decimal64, string, and timestamp
+   * and duration types stored without unit conversion
+   * ORC: integral (except bool), floating point, string and timestamp_D
+   *
+   * Bloom filters are used by readers to skip row groups (Parquet) or stripes (ORC) when filtering
+   * for equality with values that are not present, e.g. lookups of keys in a high-cardinality
+   * column. The Parquet reader only uses the filters of integral (except bool), floating point and
+   * string columns; the filters of the other types are only useful to other readers. The ORC
+   * writer writes a filter for each row group, in BLOOM_FILTER_UTF8 streams.
+   *
+   * @param enabled True = write Bloom filters. False = do not write Bloom filters
+   * @return this for chaining
+   */
+  column_in_metadata& set_bloom_filter(bool enabled) noexcept
+  {
+    _bloom_filter = enabled;
+    return *this;
+  }
+
   /**
    * @brief Get reference to a child of this column
    *
@@ -797,6 +820,13 @@ class column_in_metadata {
    * @return Boolean indicating whether to encode this column as binary data
    */
   [[nodiscard]] bool is_enabled_output_as_binary() const noexcept { return _output_as_binary; }
+
+  /**
+   * @brief Get whether to write Bloom filters for this column
+   *
+   * @return Boolean indicating whether to write Bloom filters for this column
+   */
+  [[nodiscard]] bool is_enabled_bloom_filter() const noexcept { return _bloom_filter; }
 };
 
 /**
@@ -17,10 +17,16 @@
 #include <cudf/contiguous_split.hpp>
 #include <cudf/detail/contiguous_split.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/utilities/crc32c.hpp>
+#include <cudf/null_mask.hpp>
 #include <cudf/utilities/default_stream.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/traits.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
 
+#include <cstring>
+
 namespace cudf {
 namespace detail {
 
@@ -64,6 +70,63 @@ struct serialized_column {
   int pad;
 };
 
+static_assert(sizeof(serialized_column) == 40, "Unexpected packed metadata entry size");
+
+/**
+ * @brief Header at the start of the `packed_columns` metadata.
+ *
+ * The header is followed by `num_entries` serialized columns: a stub whose size is the number of
+ * top level columns, then all columns and their children in depth-first order.
+ */
+struct metadata_header {
+  uint32_t magic;
+  uint16_t version;
+  uint16_t flags;
+  uint32_t byte_order;         // `native_byte_order` as written by the producer
+  uint32_t num_entries;        // Number of serialized columns, including the stub
+  uint32_t metadata_checksum;  // CRC32C of the serialized columns
+  uint32_t data_checksum;      // CRC32C of the contiguous data, if `has_data_checksum` is set
+};
+
+// Keeps the serialized columns aligned, so that they can be read in place
+static_assert(sizeof(metadata_header) % alignof(serialized_column) == 0,
+              "Unaligned packed metadata entries");
+
+constexpr uint32_t metadata_magic         = 0x4d4b5043;  // "CPKM"
+constexpr uint32_t swapped_metadata_magic = 0x43504b4d;
+constexpr uint16_t metadata_version       = 1;
+constexpr uint32_t native_byte_order      = 0x01020304;
+constexpr uint16_t has_data_checksum      = 0x1;
+
+/**
+ * @brief Reads and checks the header of the packed metadata.
+ */
+metadata_header read_header(uint8_t const* metadata)
+{
+  metadata_header header;
+  std::memcpy(&header, metadata, sizeof(header));
+  CUDF_EXPECTS(header.magic == metadata_magic || header.magic == swapped_metadata_magic,
+               "Invalid packed column metadata");
+  CUDF_EXPECTS(header.byte_order == native_byte_order,
+               "Packed column metadata was produced on a host with a different byte order");
+  CUDF_EXPECTS(header.version == metadata_version, "Unsupported packed column metadata version");
+  return header;
+}
+
+/**
+ * @brief Reads a serialized column of the packed metadata.
+ *
+ * The metadata buffer is not required to be aligned, e.g. when it is part of a received message.
+ */
+serialized_column read_entry(uint8_t const* metadata, size_t index)
+{
+  serialized_column entry;
+  std::memcpy(&entry,
+              metadata + sizeof(metadata_header) + index * sizeof(serialized_column),
+              sizeof(serialized_column));
+  return entry;
+}
+
 /**
  * @brief Deserialize a single column into a column_view
  *
@@ -182,8 +245,19 @@ class metadata_builder_impl {
 
   std::vector<uint8_t> build() const
   {
-    auto output = std::vector<uint8_t>(metadata.size() * sizeof(detail::serialized_column));
-    std::memcpy(output.data(), metadata.data(), output.size());
+    auto const entries_size = metadata.size() * sizeof(detail::serialized_column);
+    auto output             = std::vector<uint8_t>(sizeof(metadata_header) + entries_size);
+    std::memcpy(output.data() + sizeof(metadata_header), metadata.data(), entries_size);
+
+    metadata_header const header{
+      metadata_magic,
+      metadata_version,
+      0,
+      native_byte_order,
+      static_cast<uint32_t>(metadata.size()),
+      crc32c(host_span<uint8_t const>(output.data() + sizeof(metadata_header), entries_size)),
+      0};
+    std::memcpy(output.data(), &header, sizeof(header));
     return output;
   }
 
@@ -205,17 +279,18 @@ table_view unpack(uint8_t const* metadata, uint8_t const* gpu_data)
 {
   // gpu data can be null if everything is empty but the metadata must always be valid
   CUDF_EXPECTS(metadata != nullptr, "Encountered invalid packed column input");
-  auto serialized_columns = reinterpret_cast<serialized_column const*>(metadata);
+  auto const header       = read_header(metadata);
   uint8_t const* base_ptr = gpu_data;
   // first entry is a stub where size == the total # of top level columns (see pack_metadata above)
-  auto const num_columns = serialized_columns[0].size;
+  auto const num_columns = read_entry(metadata, 0).size;
   size_t current_index   = 1;
 
   std::function<std::vector<column_view>(size_type)> get_columns;
-  get_columns = [&serialized_columns, &current_index, base_ptr, &get_columns](size_t num_columns) {
+  get_columns = [metadata, &header, &current_index, base_ptr, &get_columns](size_t num_columns) {
     std::vector<column_view> cols;
     for (size_t i = 0; i < num_columns; i++) {
-      auto serial_column = serialized_columns[current_index];
+      CUDF_EXPECTS(current_index < header.num_entries, "Encountered invalid packed column input");
+      auto serial_column = read_entry(metadata, current_index);
       current_index++;
 
       std::vector<column_view> children = get_columns(serial_column.num_children);
@@ -229,6 +304,64 @@ table_view unpack(uint8_t const* metadata, uint8_t const* gpu_data)
   return table_view{get_columns(num_columns)};
 }
 
+void validate_packed(host_span<uint8_t const> metadata, std::size_t data_size)
+{
+  CUDF_EXPECTS(metadata.size() >= sizeof(metadata_header), "Truncated packed column metadata");
+  auto const header       = read_header(metadata.data());
+  auto const entries_size = metadata.size() - sizeof(metadata_header);
+  CUDF_EXPECTS(header.num_entries >= 1 &&
+                 entries_size == header.num_entries * sizeof(serialized_column),
+               "Incorrect packed column metadata size");
+  CUDF_EXPECTS(crc32c(metadata.subspan(sizeof(metadata_header), entries_size)) ==
+                 header.metadata_checksum,
+               "Packed column metadata checksum mismatch");
+
+  // Buffers of `size` bytes at `offset` must be within the data buffer
+  auto const is_valid_buffer = [data_size](int64_t offset, std::size_t size) {
+    return offset == -1 || (offset >= 0 && static_cast<std::size_t>(offset) < data_size &&
+                            size <= data_size - static_cast<std::size_t>(offset));
+  };
+
+  // Each column adds its children to the number of columns that remain to be read
+  auto const stub = read_entry(metadata.data(), 0);
+  CUDF_EXPECTS(stub.type.id() == type_id::EMPTY && stub.size >= 0,
+               "Invalid packed column metadata");
+  int64_t remaining_columns = stub.size;
+  for (size_t i = 1; i < header.num_entries; ++i) {
+    CUDF_EXPECTS(remaining_columns > 0, "Packed column metadata has extra columns");
+    auto const col = read_entry(metadata.data(), i);
+    auto const id  = static_cast<int32_t>(col.type.id());
+    CUDF_EXPECTS(id >= 0 && id < static_cast<int32_t>(type_id::NUM_TYPE_IDS),
+                 "Invalid column type in packed column metadata");
+    CUDF_EXPECTS(col.size >= 0 && col.null_count >= 0 && col.null_count <= col.size &&
+                   col.num_children >= 0,
+                 "Invalid column in packed column metadata");
+    // Only fixed-width columns read their own data buffer; the data of other types is in children
+    auto const data_bytes =
+      is_fixed_width(col.type) ? size_of(col.type) * static_cast<std::size_t>(col.size) : 0;
+    auto const null_mask_bytes = num_bitmask_words(col.size) * sizeof(bitmask_type);
+    CUDF_EXPECTS(is_valid_buffer(col.data_offset, data_bytes) &&
+                   is_valid_buffer(col.null_mask_offset, null_mask_bytes),
+                 "Packed column metadata references data outside of the data buffer");
+    remaining_columns += col.num_children - 1;
+  }
+  CUDF_EXPECTS(remaining_columns == 0, "Packed column metadata has missing columns");
+}
+
+std::optional<uint32_t> packed_data_checksum(host_span<uint8_t const> metadata)
+{
+  auto const header = read_header(metadata.data());
+  return (header.flags & has_data_checksum) ? std::optional{header.data_checksum} : std::nullopt;
+}
+
+void set_packed_data_checksum(host_span<uint8_t> metadata, uint32_t data_checksum)
+{
+  auto header = read_header(metadata.data());
+  header.flags |= has_data_checksum;
+  header.data_checksum = data_checksum;
+  std::memcpy(metadata.data(), &header, sizeof(header));
+}
+
 metadata_builder::metadata_builder(size_type const num_root_columns)
   : impl(std::make_unique<metadata_builder_impl>(num_root_columns +
                                                  1 /*one more extra metadata entry as below*/))
@@ -301,4 +434,35 @@ table_view unpack(uint8_t const* metadata, uint8_t const* gpu_data)
   return detail::unpack(metadata, gpu_data);
 }
 
+/**
+ * @copydoc cudf::validate_packed(host_span<uint8_t const>, std::size_t)
+ */
+void validate_packed(host_span<uint8_t const> metadata, std::size_t data_size)
+{
+  CUDF_FUNC_RANGE();
+  detail::validate_packed(metadata, data_size);
+}
+
+/**
+ * @copydoc cudf::validate_packed(host_span<uint8_t const>, host_span<uint8_t const>)
+ */
+void validate_packed(host_span<uint8_t const> metadata, host_span<uint8_t const> data)
+{
+  CUDF_FUNC_RANGE();
+  detail::validate_packed(metadata, data.size());
+  auto const data_checksum = detail::packed_data_checksum(metadata);
+  CUDF_EXPECTS(not data_checksum.has_value() || detail::crc32c(data) == data_checksum.value(),
+               "Packed data checksum mismatch");
+}
+
+/**
+ * @copydoc cudf::set_packed_data_checksum
+ */
+void set_packed_data_checksum(host_span<uint8_t> metadata, host_span<uint8_t const> data)
+{
+  CUDF_FUNC_RANGE();
+  detail::validate_packed(metadata, data.size());
+  detail::set_packed_data_checksum(metadata, detail::crc32c(data));
+}
+
 }  // namespace cudf
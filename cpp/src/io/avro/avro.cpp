@@ -16,13 +16,37 @@
 
 #include "avro.hpp"
 
+#include <io/comp/io_uncomp.hpp>
+
+#include <algorithm>
+#include <array>
 #include <cstring>
+#include <functional>
+#include <future>
+#include <limits>
 #include <unordered_map>
 
 namespace cudf {
 namespace io {
 namespace avro {
 
+namespace {
+// Number of blocks that are walked serially before the rest of the file is indexed in parallel
+constexpr size_t parallel_index_min_blocks = 256;
+
+// Minimum size of the file segments that are searched for sync markers in parallel
+constexpr size_t min_sync_scan_segment_size = 64 * 1024;
+
+// Size of the windows of the file that are searched for sync markers at a time; bounds the part
+// of the file that is scanned past the blocks that hold the requested rows
+constexpr size_t sync_scan_window_size = 64 * 1024 * 1024;
+
+// N.B. The 18 is (presumably) intended to account for the two 64-bit object count and block size
+//      integers (16 bytes total), and then an additional two bytes to represent the smallest
+//      possible row size.
+constexpr size_t min_block_size = 18;
+}  // namespace
+
 template <>
 uint64_t container::get_encoded()
 {
@@ -56,6 +80,131 @@ std::string container::get_encoded()
   return std::string(s, len);
 }
 
+/**
+ * @brief Reads the header of the data block at the given position
+ *
+ * @param[in] pos start of the block
+ *
+ * @returns the block header, or nothing if the header is invalid or if the block and the sync
+ * marker that follows it extend past the end of the file
+ */
+std::optional<block_header> container::read_block_header(uint8_t const* pos) const
+{
+  container block(pos, m_end - pos);
+  auto const object_count = static_cast<uint32_t>(block.get_encoded<int64_t>());
+  auto const block_size   = static_cast<uint32_t>(block.get_encoded<int64_t>());
+  auto const data_offset  = static_cast<size_t>(pos + block.bytecount() - m_base);
+  if (block_size == 0 || object_count == 0) { return std::nullopt; }
+  if (m_base + data_offset + block_size + 2 * sizeof(uint64_t) > m_end) { return std::nullopt; }
+  return block_header{data_offset, object_count, block_size};
+}
+
+/**
+ * @brief Enumerates the data blocks that follow the current position
+ *
+ * Blocks are walked one at a time, from the size recorded in each block header. Once a file is
+ * found to have many blocks, the rest of the file is instead searched for sync markers in windows,
+ * each split into segments that are searched in parallel, and the headers of the blocks that
+ * follow the markers are read in parallel as well. Blocks are then chained from the size of the
+ * previous block, so that marker bytes that occur within the block data are ignored. Windows are
+ * only searched until the blocks hold `max_num_rows` rows.
+ *
+ * @param[in] sync_marker sync marker that ends each block
+ * @param[in] max_num_rows number of rows after which no more blocks are needed
+ *
+ * @returns the blocks, and whether the blocks were indexed without errors
+ */
+std::pair<std::vector<block_header>, bool> container::index_blocks(uint64_t const sync_marker[2],
+                                                                   size_t max_num_rows) const
+{
+  std::array<uint8_t, 2 * sizeof(uint64_t)> marker;
+  std::memcpy(marker.data(), sync_marker, marker.size());
+  // Only called with positions where the marker is within the file, see `read_block_header`
+  auto const is_marker_at = [&](uint8_t const* pos) {
+    return std::equal(marker.begin(), marker.end(), pos);
+  };
+
+  std::vector<block_header> blocks;
+  size_t num_rows = 0;
+  auto pos        = m_cur;
+  while (pos + min_block_size < m_end && num_rows < max_num_rows &&
+         blocks.size() < parallel_index_min_blocks) {
+    auto const block = read_block_header(pos);
+    if (!block.has_value()) { return {std::move(blocks), false}; }
+    auto const block_end = m_base + block->offset + block->size;
+    if (!is_marker_at(block_end)) { return {std::move(blocks), false}; }
+    blocks.push_back(*block);
+    num_rows += block->object_count;
+    pos = block_end + marker.size();
+  }
+  if (pos + min_block_size >= m_end || num_rows >= max_num_rows) {
+    return {std::move(blocks), true};
+  }
+
+  // Finds the sync markers that start in [begin, end), along with the header of the following
+  // block, searching segments of the range in parallel
+  struct marked_block {
+    uint8_t const* marker;
+    std::optional<block_header> next;
+  };
+  auto const find_markers = [&](uint8_t const* begin, uint8_t const* end) {
+    auto const scan_size    = static_cast<size_t>(end - begin);
+    auto const num_segments = std::clamp<size_t>(scan_size / min_sync_scan_segment_size,
+                                                 1,
+                                                 2 * host_decompression_pool().get_thread_count());
+    std::vector<std::future<std::vector<marked_block>>> tasks;
+    tasks.reserve(num_segments);
+    for (size_t i = 0; i < num_segments; ++i) {
+      auto const seg_begin = begin + scan_size * i / num_segments;
+      auto const seg_end   = begin + scan_size * (i + 1) / num_segments;
+      tasks.emplace_back(submit_decompression_task([&, seg_begin, seg_end]() {
+        std::vector<marked_block> found;
+        std::boyer_moore_horspool_searcher const searcher(marker.begin(), marker.end());
+        // Markers that start in this segment can end in the next one
+        auto const search_end = std::min(seg_end + marker.size() - 1, m_end);
+        for (auto it = std::search(seg_begin, search_end, searcher); it != search_end;
+             it      = std::search(it + 1, search_end, searcher)) {
+          auto const next = it + marker.size();
+          found.push_back(
+            {it, next + min_block_size < m_end ? read_block_header(next) : std::nullopt});
+        }
+        return found;
+      }));
+    }
+    std::vector<marked_block> markers;
+    for (auto& task : tasks) {
+      auto const found = task.get();
+      markers.insert(markers.end(), found.begin(), found.end());
+    }
+    return markers;
+  };
+
+  // Chain the blocks, starting from the first one that was not walked. The file is searched a
+  // window at a time, each window starting at the end of the last chained block, so that only the
+  // part of the file that holds the requested rows is scanned.
+  std::vector<marked_block> markers;
+  auto scan_end = pos;  // End of the searched part of the file
+  auto block    = read_block_header(pos);
+  while (num_rows < max_num_rows) {
+    if (!block.has_value()) { return {std::move(blocks), false}; }
+    auto const block_end = m_base + block->offset + block->size;
+    if (block_end >= scan_end) {
+      scan_end = block_end + std::min<size_t>(sync_scan_window_size, m_end - block_end);
+      markers  = find_markers(block_end, scan_end);
+    }
+    auto const it = std::lower_bound(
+      markers.cbegin(), markers.cend(), block_end, [](auto const& m, auto const* p) {
+        return m.marker < p;
+      });
+    if (it == markers.cend() || it->marker != block_end) { return {std::move(blocks), false}; }
+    blocks.push_back(*block);
+    num_rows += block->object_count;
+    if (block_end + marker.size() + min_block_size >= m_end) { break; }
+    block = it->next;
+  }
+  return {std::move(blocks), true};
+}
+
 /**
  * @brief AVRO file metadata parser
  *
@@ -102,13 +251,15 @@ bool container::parse(file_metadata* md, size_t max_num_rows, size_t first_row)
   md->skip_rows      = first_row;
   md->total_num_rows = 0;
 
-  // Enumerate the blocks in this file.  Each block starts with a count of
-  // objects (rows) in the block (uint64_t), and then the total size in bytes
-  // of the block (uint64_t).  We walk each block and do the following:
+  // Enumerate the blocks in this file (see `index_blocks`).  Each block starts
+  // with a count of objects (rows) in the block (uint64_t), and then the total
+  // size in bytes of the block (uint64_t).  We then walk each block and do the
+  // following:
   //    1. Capture the total number of rows present across all blocks.
   //    2. Add each block to the metadata's list of blocks.
   //    3. Handle the case where we've been asked to skip or limit rows.
-  //    4. Verify sync markers at the end of each block.
+  //
+  // Sync markers at the end of each block are verified by `index_blocks`.
   //
   // A row offset is also maintained, and added to each block.  This reflects
   // the absolute offset that needs to be added to any given row in order to
@@ -122,6 +273,9 @@ bool container::parse(file_metadata* md, size_t max_num_rows, size_t first_row)
   //      md->block_list) that precede the block containing the first row
   //      we're interested in.
   //
+  auto const num_rows_needed =
+    first_row + std::min(max_num_rows, std::numeric_limits<size_t>::max() - first_row);
+  auto const [blocks, is_valid] = index_blocks(md->sync_marker, num_rows_needed);
 
   // Number of rows in the current block.
   uint32_t num_rows = 0;
@@ -141,19 +295,11 @@ bool container::parse(file_metadata* md, size_t max_num_rows, size_t first_row)
   // all blocks.
   size_t total_object_count = 0;
 
-  // N.B. The 18 below is (presumably) intended to account for the two 64-bit
-  //      object count and block size integers (16 bytes total), and then an
-  //      additional two bytes to represent the smallest possible row size.
-  while (m_cur + 18 < m_end && total_object_count < max_num_rows) {
-    auto const object_count = static_cast<uint32_t>(get_encoded<int64_t>());
-    auto const block_size   = static_cast<uint32_t>(get_encoded<int64_t>());
-    auto const next_end     = m_cur + block_size + 16;
-    // Abort on terminal conditions.  We keep these as separate lines instead of
-    // combining them into a single if in order to facilitate setting specific
-    // line breakpoints in the debugger.
-    if (block_size <= 0) { return false; }
-    if (object_count <= 0) { return false; }
-    if (next_end > m_end) { return false; }
+  for (auto const& block : blocks) {
+    if (total_object_count >= max_num_rows) { break; }
+    auto const object_count = block.object_count;
+    auto const block_size   = block.size;
+    m_cur                   = m_base + block.offset;
 
     // Update our total row count.  This is only captured for information
     // purposes.
@@ -195,16 +341,16 @@ bool container::parse(file_metadata* md, size_t max_num_rows, size_t first_row)
         row_offset += num_rows;
       }
     }
-    m_cur += block_size;
-    // Read the next sync markers and ensure they match the first ones we
-    // encountered.  If they don't, we have to assume the data is corrupted,
-    // and thus, we terminate processing immediately.
-    uint64_t const sync_marker[] = {get_raw<uint64_t>(), get_raw<uint64_t>()};
-    bool valid_sync_markers =
-      ((sync_marker[0] == md->sync_marker[0]) && (sync_marker[1] == md->sync_marker[1]));
-    if (!valid_sync_markers) { return false; }
+    // Skip the block data and the sync markers that follow it
+    m_cur += block_size + sizeof(md->sync_marker);
   }
+  // The blocks that were indexed before an error may be enough for the requested rows
+  if (!is_valid && total_object_count < max_num_rows) { return false; }
   md->max_block_size = max_block_size;
+  // Row counts are `size_type`, which also bounds the rows the chunked reader returns in total
+  CUDF_EXPECTS(std::min(total_object_count, max_num_rows) <=
+                 static_cast<size_t>(std::numeric_limits<size_type>::max()),
+               "Too many rows selected from the Avro file; select fewer with num_rows");
   // N.B. `total_object_count` has skip_rows applied to it at this point, i.e.
   //      it represents the number of rows that will be returned *after* rows
   //      have been skipped (if requested).
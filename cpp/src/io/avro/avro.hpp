@@ -24,7 +24,9 @@
 #include <cstdio>
 #include <cstring>
 #include <map>
+#include <optional>
 #include <string>
+#include <utility>
 #include <vector>
 
 namespace cudf {
@@ -57,6 +59,15 @@ struct column_desc {
   std::string name         = "";
 };
 
+/**
+ * @brief Location and row count of an AVRO data block, as recorded in its header
+ */
+struct block_header {
+  size_t offset;          // Offset of the block data, in bytes, from the start of the file
+  uint32_t object_count;  // Number of rows in the block
+  uint32_t size;          // Size of the block data, in bytes
+};
+
 /**
  * @brief AVRO file metadata struct
  *
@@ -163,6 +174,11 @@ class container {
  public:
   bool parse(file_metadata* md, size_t max_num_rows = 0x7fff'ffff, size_t first_row = 0);
 
+ protected:
+  std::pair<std::vector<block_header>, bool> index_blocks(uint64_t const sync_marker[2],
+                                                          size_t max_num_rows) const;
+  std::optional<block_header> read_block_header(uint8_t const* pos) const;
+
  protected:
   // Base address of the file data.  This will always point to the file's metadata.
   uint8_t const* m_base;
@@ -18,7 +18,9 @@
 #include "avro_gpu.hpp"
 
 #include <io/comp/gpuinflate.hpp>
+#include <io/comp/io_uncomp.hpp>
 #include <io/utilities/column_buffer.hpp>
+#include <io/utilities/config_utils.hpp>
 #include <io/utilities/hostdevice_vector.hpp>
 
 #include <cudf/detail/null_mask.hpp>
@@ -43,8 +45,11 @@
 
 #include <nvcomp/snappy.h>
 
+#include <future>
+#include <limits>
 #include <memory>
 #include <numeric>
+#include <optional>
 #include <string>
 #include <utility>
 #include <vector>
@@ -184,6 +189,79 @@ class metadata : public file_metadata {
   datasource* const source;
 };
 
+/**
+ * @brief Returns the compression type of the codec if its blocks are decompressed on the host
+ *
+ * The `zstandard`, `bzip2` and `xz` codecs are only supported on the host. `deflate` blocks are
+ * decompressed on the host if enabled with the `LIBCUDF_HOST_DECOMPRESSION_POLICY` environment
+ * variable.
+ */
+std::optional<compression_type> host_compression_type(std::string const& codec)
+{
+  if (codec == "zstandard") { return compression_type::ZSTD; }
+  if (codec == "bzip2") { return compression_type::BZIP2; }
+  if (codec == "xz") { return compression_type::XZ; }
+  // Blocks of the deflate codec hold raw DEFLATE data
+  if (codec == "deflate" && host_decompression_integration::is_enabled()) {
+    return compression_type::ZLIB;
+  }
+  return std::nullopt;
+}
+
+/**
+ * @brief Decompresses the blocks on the host, in parallel, and copies the result to the device
+ *
+ * @param meta File metadata; block offsets and sizes are updated to refer to uncompressed data
+ * @param compression Compression type of the blocks
+ * @param comp_block_data Contents of the file starting from the first block
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ */
+rmm::device_buffer host_decompress_data(metadata& meta,
+                                        compression_type compression,
+                                        host_span<uint8_t const> comp_block_data,
+                                        rmm::cuda_stream_view stream)
+{
+  auto const num_blocks  = meta.block_list.size();
+  auto const base_offset = meta.block_list[0].offset;
+  std::vector<std::vector<uint8_t>> uncomp_blocks(num_blocks);
+
+  // Blocks are often small, so each task decompresses a range of blocks
+  auto const num_tasks =
+    std::min<size_t>(num_blocks, 2 * host_decompression_pool().get_thread_count());
+  std::vector<std::future<void>> tasks;
+  tasks.reserve(num_tasks);
+  for (size_t t = 0; t < num_tasks; ++t) {
+    auto const first = num_blocks * t / num_tasks;
+    auto const last  = num_blocks * (t + 1) / num_tasks;
+    tasks.emplace_back(submit_decompression_task([&, first, last]() {
+      for (auto i = first; i < last; ++i) {
+        auto const& block = meta.block_list[i];
+        uncomp_blocks[i] =
+          decompress(compression, comp_block_data.subspan(block.offset - base_offset, block.size));
+      }
+    }));
+  }
+  wait_for_all(tasks);
+
+  // Update blocks offsets & sizes to refer to uncompressed data
+  size_t uncomp_size = 0;
+  for (size_t i = 0; i < num_blocks; i++) {
+    CUDF_EXPECTS(uncomp_blocks[i].size() <= std::numeric_limits<uint32_t>::max(),
+                 "Decompressed block size exceeds the size limit");
+    meta.block_list[i].offset = uncomp_size;
+    meta.block_list[i].size   = static_cast<uint32_t>(uncomp_blocks[i].size());
+    uncomp_size += uncomp_blocks[i].size();
+  }
+  std::vector<uint8_t> uncomp_data(uncomp_size);
+  for (size_t i = 0; i < num_blocks; i++) {
+    std::copy(uncomp_blocks[i].cbegin(),
+              uncomp_blocks[i].cend(),
+              uncomp_data.begin() + meta.block_list[i].offset);
+    uncomp_blocks[i] = {};
+  }
+  return rmm::device_buffer{uncomp_data.data(), uncomp_data.size(), stream};
+}
+
 rmm::device_buffer decompress_data(datasource& source,
                                    metadata& meta,
                                    rmm::device_buffer const& comp_block_data,
@@ -481,143 +559,320 @@ std::vector<column_buffer> decode_data(metadata& meta,
   return out_buffers;
 }
 
-table_with_metadata read_avro(std::unique_ptr<cudf::io::datasource>&& source,
-                              avro_reader_options const& options,
-                              rmm::cuda_stream_view stream,
-                              rmm::mr::device_memory_resource* mr)
+/**
+ * @brief Implementation of the Avro reader; reads the selected blocks of the file in chunks of
+ * consecutive blocks
+ */
+class reader_impl {
+ public:
+  reader_impl(std::size_t chunk_read_limit,
+              std::unique_ptr<cudf::io::datasource>&& source,
+              avro_reader_options const& options,
+              rmm::cuda_stream_view stream,
+              rmm::mr::device_memory_resource* mr);
+
+  [[nodiscard]] bool has_next() const
+  {
+    return not _has_read_chunk or _next_block < _blocks.size();
+  }
+
+  table_with_metadata read_chunk();
+
+ private:
+  /**
+   * @brief Returns the estimated size of the decoded output of a block
+   */
+  [[nodiscard]] size_t estimated_output_size(block_desc_s const& block) const;
+
+  /**
+   * @brief Returns the index of the block after the last block of the next chunk
+   */
+  [[nodiscard]] size_t next_chunk_end() const;
+
+  /**
+   * @brief Reads, decompresses and decodes a range of the selected blocks
+   */
+  std::vector<std::unique_ptr<column>> read_blocks(size_t begin, size_t end);
+
+  std::unique_ptr<cudf::io::datasource> _source;
+  metadata _meta;
+  std::size_t _chunk_read_limit;
+  rmm::cuda_stream_view _stream;
+  rmm::mr::device_memory_resource* _mr;
+
+  std::vector<std::pair<int, std::string>> _selected_columns;
+  std::vector<data_type> _column_types;
+  // All the selected blocks; `_meta.block_list` holds the blocks of the current chunk
+  std::vector<block_desc_s> _blocks;
+  size_t _next_block   = 0;
+  bool _has_read_chunk = false;
+
+  // Enum symbols of the selected columns
+  std::vector<std::pair<uint32_t, uint32_t>> _dict;
+  rmm::device_uvector<string_index_pair> _global_dict;
+  rmm::device_uvector<char> _global_dict_data;
+
+  // Estimated decoded size of the fixed-width data of a row, in bits
+  size_t _row_fixed_width_bits = 0;
+  bool _has_string_columns     = false;
+  // Total sizes of the blocks read so far, used to estimate the decompressed size of the blocks
+  size_t _total_comp_size   = 0;
+  size_t _total_uncomp_size = 0;
+};
+
+reader_impl::reader_impl(std::size_t chunk_read_limit,
+                         std::unique_ptr<cudf::io::datasource>&& source,
+                         avro_reader_options const& options,
+                         rmm::cuda_stream_view stream,
+                         rmm::mr::device_memory_resource* mr)
+  : _source(std::move(source)),
+    _meta(_source.get()),
+    _chunk_read_limit(chunk_read_limit),
+    _stream(stream),
+    _mr(mr),
+    _global_dict(0, stream),
+    _global_dict_data(0, stream)
 {
   auto skip_rows = options.get_skip_rows();
   auto num_rows  = options.get_num_rows();
-  std::vector<std::unique_ptr<column>> out_columns;
-  table_metadata metadata_out;
-
-  // Open the source Avro dataset metadata
-  auto meta = metadata(source.get());
 
   // Select and read partial metadata / schema within the subset of rows
-  meta.init_and_select_rows(skip_rows, num_rows);
+  _meta.init_and_select_rows(skip_rows, num_rows);
 
   // Select only columns required by the options
-  auto selected_columns = meta.select_columns(options.get_columns());
-  if (selected_columns.size() != 0) {
-    // Get a list of column data types
-    std::vector<data_type> column_types;
-    for (auto const& col : selected_columns) {
-      auto& col_schema = meta.schema[meta.columns[col.first].schema_data_idx];
-
-      auto col_type = to_type_id(&col_schema);
-      CUDF_EXPECTS(col_type != type_id::EMPTY, "Unknown type");
-      column_types.emplace_back(col_type);
+  _selected_columns = _meta.select_columns(options.get_columns());
+  if (_selected_columns.empty()) { return; }
+
+  // Get a list of column data types
+  for (auto const& col : _selected_columns) {
+    auto& col_schema = _meta.schema[_meta.columns[col.first].schema_data_idx];
+
+    auto col_type = to_type_id(&col_schema);
+    CUDF_EXPECTS(col_type != type_id::EMPTY, "Unknown type");
+    _column_types.emplace_back(col_type);
+
+    auto const is_nullable = _meta.columns[col.first].schema_null_idx >= 0;
+    if (col_type == type_id::STRING) {
+      _has_string_columns = true;
+      _row_fixed_width_bits += sizeof(size_type) * 8;
+    } else {
+      _row_fixed_width_bits += size_of(data_type{col_type}) * 8;
     }
+    if (is_nullable) { _row_fixed_width_bits += 1; }
+  }
 
-    if (meta.num_rows > 0) {
-      rmm::device_buffer block_data;
-      if (source->is_device_read_preferred(meta.selected_data_size)) {
-        block_data      = rmm::device_buffer{meta.selected_data_size, stream};
-        auto read_bytes = source->device_read(meta.block_list[0].offset,
-                                              meta.selected_data_size,
-                                              static_cast<uint8_t*>(block_data.data()),
-                                              stream);
-        block_data.resize(read_bytes, stream);
-      } else {
-        auto const buffer = source->host_read(meta.block_list[0].offset, meta.selected_data_size);
-        block_data        = rmm::device_buffer{buffer->data(), buffer->size(), stream};
-      }
+  if (_meta.num_rows <= 0) { return; }
+  _blocks = std::move(_meta.block_list);
 
-      if (meta.codec != "" && meta.codec != "null") {
-        auto decomp_block_data = decompress_data(*source, meta, block_data, stream);
-        block_data             = std::move(decomp_block_data);
-      } else {
-        auto dst_ofs = meta.block_list[0].offset;
-        for (size_t i = 0; i < meta.block_list.size(); i++) {
-          meta.block_list[i].offset -= dst_ofs;
-        }
-      }
+  size_t total_dictionary_entries = 0;
+  size_t dictionary_data_size     = 0;
 
-      size_t total_dictionary_entries = 0;
-      size_t dictionary_data_size     = 0;
+  _dict = std::vector<std::pair<uint32_t, uint32_t>>(_column_types.size());
 
-      auto dict = std::vector<std::pair<uint32_t, uint32_t>>(column_types.size());
+  for (size_t i = 0; i < _column_types.size(); ++i) {
+    auto col_idx     = _selected_columns[i].first;
+    auto& col_schema = _meta.schema[_meta.columns[col_idx].schema_data_idx];
+    _dict[i].first   = static_cast<uint32_t>(total_dictionary_entries);
+    _dict[i].second  = static_cast<uint32_t>(col_schema.symbols.size());
+    total_dictionary_entries += _dict[i].second;
+    for (auto const& sym : col_schema.symbols) {
+      dictionary_data_size += sym.length();
+    }
+  }
 
-      for (size_t i = 0; i < column_types.size(); ++i) {
-        auto col_idx     = selected_columns[i].first;
-        auto& col_schema = meta.schema[meta.columns[col_idx].schema_data_idx];
-        dict[i].first    = static_cast<uint32_t>(total_dictionary_entries);
-        dict[i].second   = static_cast<uint32_t>(col_schema.symbols.size());
-        total_dictionary_entries += dict[i].second;
-        for (auto const& sym : col_schema.symbols) {
-          dictionary_data_size += sym.length();
-        }
+  if (total_dictionary_entries > 0) {
+    auto h_global_dict      = std::vector<string_index_pair>(total_dictionary_entries);
+    auto h_global_dict_data = std::vector<char>(dictionary_data_size);
+    size_t dict_pos         = 0;
+
+    for (size_t i = 0; i < _column_types.size(); ++i) {
+      auto const col_idx          = _selected_columns[i].first;
+      auto const& col_schema      = _meta.schema[_meta.columns[col_idx].schema_data_idx];
+      auto const col_dict_entries = &(h_global_dict[_dict[i].first]);
+      for (size_t j = 0; j < _dict[i].second; j++) {
+        auto const& symbols = col_schema.symbols[j];
+
+        auto const data_dst        = h_global_dict_data.data() + dict_pos;
+        auto const len             = symbols.length();
+        col_dict_entries[j].first  = data_dst;
+        col_dict_entries[j].second = len;
+
+        std::copy(symbols.c_str(), symbols.c_str() + len, data_dst);
+        dict_pos += len;
       }
+    }
 
-      auto d_global_dict      = rmm::device_uvector<string_index_pair>(0, stream);
-      auto d_global_dict_data = rmm::device_uvector<char>(0, stream);
+    _global_dict = cudf::detail::make_device_uvector_async(
+      h_global_dict, stream, rmm::mr::get_current_device_resource());
+    _global_dict_data = cudf::detail::make_device_uvector_async(
+      h_global_dict_data, stream, rmm::mr::get_current_device_resource());
 
-      if (total_dictionary_entries > 0) {
-        auto h_global_dict      = std::vector<string_index_pair>(total_dictionary_entries);
-        auto h_global_dict_data = std::vector<char>(dictionary_data_size);
-        size_t dict_pos         = 0;
+    stream.synchronize();
+  }
+}
 
-        for (size_t i = 0; i < column_types.size(); ++i) {
-          auto const col_idx          = selected_columns[i].first;
-          auto const& col_schema      = meta.schema[meta.columns[col_idx].schema_data_idx];
-          auto const col_dict_entries = &(h_global_dict[dict[i].first]);
-          for (size_t j = 0; j < dict[i].second; j++) {
-            auto const& symbols = col_schema.symbols[j];
+size_t reader_impl::estimated_output_size(block_desc_s const& block) const
+{
+  auto const fixed_width_size = (block.num_rows * _row_fixed_width_bits + 7) / 8;
+  if (not _has_string_columns) { return fixed_width_size; }
+
+  // The string data is bounded by the decompressed size of the block; compressed blocks are
+  // scaled by the compression ratio of the blocks read so far
+  auto const compression_ratio =
+    _total_comp_size > 0 ? static_cast<double>(_total_uncomp_size) / _total_comp_size : 1.0;
+  return fixed_width_size + static_cast<size_t>(block.size * compression_ratio);
+}
 
-            auto const data_dst        = h_global_dict_data.data() + dict_pos;
-            auto const len             = symbols.length();
-            col_dict_entries[j].first  = data_dst;
-            col_dict_entries[j].second = len;
+size_t reader_impl::next_chunk_end() const
+{
+  if (_chunk_read_limit == 0) { return _blocks.size(); }
+
+  // Until a block has been decompressed, the decoded size of compressed blocks with string data
+  // cannot be estimated, so the first chunk is a single block
+  auto const is_compressed = _meta.codec != "" && _meta.codec != "null";
+  if (is_compressed and _has_string_columns and _total_comp_size == 0) { return _next_block + 1; }
+
+  size_t chunk_size     = 0;
+  size_t chunk_num_rows = 0;
+  auto end              = _next_block;
+  // Each chunk holds at least one block
+  do {
+    chunk_size += estimated_output_size(_blocks[end]);
+    chunk_num_rows += _blocks[end].num_rows;
+    ++end;
+  } while (end < _blocks.size() and
+           chunk_size + estimated_output_size(_blocks[end]) <= _chunk_read_limit and
+           chunk_num_rows + _blocks[end].num_rows <=
+             static_cast<size_t>(std::numeric_limits<size_type>::max()));
+  return end;
+}
 
-            std::copy(symbols.c_str(), symbols.c_str() + len, data_dst);
-            dict_pos += len;
-          }
-        }
+std::vector<std::unique_ptr<column>> reader_impl::read_blocks(size_t begin, size_t end)
+{
+  // Select the blocks of the chunk, with row offsets relative to the first row of the chunk
+  _meta.block_list.assign(_blocks.begin() + begin, _blocks.begin() + end);
+  auto const first_row_offset = _meta.block_list.front().row_offset;
+  size_t num_rows             = 0;
+  size_t comp_size            = 0;
+  _meta.max_block_size        = 0;
+  for (auto& block : _meta.block_list) {
+    block.row_offset -= first_row_offset;
+    num_rows += block.num_rows;
+    comp_size += block.size;
+    _meta.max_block_size = std::max(_meta.max_block_size, block.size);
+  }
+  auto const& last_block = _meta.block_list.back();
+  _meta.selected_data_size =
+    last_block.offset + last_block.size - _meta.block_list.front().offset;
+
+  auto const host_compression = host_compression_type(_meta.codec);
+  rmm::device_buffer block_data;
+  if (host_compression.has_value()) {
+    auto const buffer =
+      _source->host_read(_meta.block_list[0].offset, _meta.selected_data_size);
+    block_data = host_decompress_data(
+      _meta, host_compression.value(), {buffer->data(), buffer->size()}, _stream);
+  } else if (_source->is_device_read_preferred(_meta.selected_data_size)) {
+    block_data      = rmm::device_buffer{_meta.selected_data_size, _stream};
+    auto read_bytes = _source->device_read(_meta.block_list[0].offset,
+                                           _meta.selected_data_size,
+                                           static_cast<uint8_t*>(block_data.data()),
+                                           _stream);
+    block_data.resize(read_bytes, _stream);
+  } else {
+    auto const buffer =
+      _source->host_read(_meta.block_list[0].offset, _meta.selected_data_size);
+    block_data = rmm::device_buffer{buffer->data(), buffer->size(), _stream};
+  }
 
-        d_global_dict = cudf::detail::make_device_uvector_async(
-          h_global_dict, stream, rmm::mr::get_current_device_resource());
-        d_global_dict_data = cudf::detail::make_device_uvector_async(
-          h_global_dict_data, stream, rmm::mr::get_current_device_resource());
+  if (host_compression.has_value()) {
+    // Block offsets and sizes already refer to the decompressed data
+  } else if (_meta.codec != "" && _meta.codec != "null") {
+    auto decomp_block_data = decompress_data(*_source, _meta, block_data, _stream);
+    block_data             = std::move(decomp_block_data);
+  } else {
+    auto dst_ofs = _meta.block_list[0].offset;
+    for (size_t i = 0; i < _meta.block_list.size(); i++) {
+      _meta.block_list[i].offset -= dst_ofs;
+    }
+  }
+  _total_comp_size += comp_size;
+  for (auto const& block : _meta.block_list) {
+    _total_uncomp_size += block.size;
+  }
 
-        stream.synchronize();
-      }
+  auto out_buffers = decode_data(_meta,
+                                 block_data,
+                                 _dict,
+                                 _global_dict,
+                                 num_rows,
+                                 _selected_columns,
+                                 _column_types,
+                                 _stream,
+                                 _mr);
 
-      auto out_buffers = decode_data(meta,
-                                     block_data,
-                                     dict,
-                                     d_global_dict,
-                                     num_rows,
-                                     selected_columns,
-                                     column_types,
-                                     stream,
-                                     mr);
-
-      for (size_t i = 0; i < column_types.size(); ++i) {
-        out_columns.emplace_back(make_column(out_buffers[i], nullptr, std::nullopt, stream));
-      }
-    } else {
-      // Create empty columns
-      for (size_t i = 0; i < column_types.size(); ++i) {
-        out_columns.emplace_back(make_empty_column(column_types[i]));
-      }
+  std::vector<std::unique_ptr<column>> out_columns;
+  for (size_t i = 0; i < _column_types.size(); ++i) {
+    out_columns.emplace_back(make_column(out_buffers[i], nullptr, std::nullopt, _stream));
+  }
+  return out_columns;
+}
+
+table_with_metadata reader_impl::read_chunk()
+{
+  std::vector<std::unique_ptr<column>> out_columns;
+  table_metadata metadata_out;
+
+  if (_next_block < _blocks.size()) {
+    auto const end_block = next_chunk_end();
+    out_columns          = read_blocks(_next_block, end_block);
+    _next_block          = end_block;
+  } else {
+    // Create empty columns
+    for (size_t i = 0; i < _column_types.size(); ++i) {
+      out_columns.emplace_back(make_empty_column(_column_types[i]));
     }
   }
+  _has_read_chunk = true;
 
   // Return column names
-  metadata_out.schema_info.reserve(selected_columns.size());
-  std::transform(selected_columns.cbegin(),
-                 selected_columns.cend(),
+  metadata_out.schema_info.reserve(_selected_columns.size());
+  std::transform(_selected_columns.cbegin(),
+                 _selected_columns.cend(),
                  std::back_inserter(metadata_out.schema_info),
                  [](auto const& c) { return column_name_info{c.second}; });
 
   // Return user metadata
-  metadata_out.user_data          = meta.user_data;
-  metadata_out.per_file_user_data = {{meta.user_data.begin(), meta.user_data.end()}};
+  metadata_out.user_data          = _meta.user_data;
+  metadata_out.per_file_user_data = {{_meta.user_data.begin(), _meta.user_data.end()}};
 
   return {std::make_unique<table>(std::move(out_columns)), std::move(metadata_out)};
 }
 
+table_with_metadata read_avro(std::unique_ptr<cudf::io::datasource>&& source,
+                              avro_reader_options const& options,
+                              rmm::cuda_stream_view stream,
+                              rmm::mr::device_memory_resource* mr)
+{
+  // Without a size limit, all the selected blocks are read as a single chunk
+  return reader_impl(0, std::move(source), options, stream, mr).read_chunk();
+}
+
+chunked_reader::chunked_reader(std::size_t chunk_read_limit,
+                               std::unique_ptr<cudf::io::datasource>&& source,
+                               avro_reader_options const& options,
+                               rmm::cuda_stream_view stream,
+                               rmm::mr::device_memory_resource* mr)
+  : _impl(std::make_unique<reader_impl>(chunk_read_limit, std::move(source), options, stream, mr))
+{
+}
+
+chunked_reader::~chunked_reader() = default;
+
+bool chunked_reader::has_next() const { return _impl->has_next(); }
+
+table_with_metadata chunked_reader::read_chunk() const { return _impl->read_chunk(); }
+
 }  // namespace avro
 }  // namespace detail
 }  // namespace io
@@ -82,6 +82,7 @@ For more information on these sources, see the manual.
 #include "io_uncomp.hpp"
 #include "unbz2.hpp"
 
+#include <algorithm>
 #include <cstdio>
 #include <cstdlib>
 #include <vector>
@@ -597,5 +598,87 @@ int32_t cpu_bz2_uncompress(
   return ret;
 }
 
+int32_t cpu_bz2_uncompress_block(uint8_t const* source,
+                                 size_t sourceLen,
+                                 uint64_t block_start,
+                                 std::vector<uint8_t>& dest,
+                                 uint64_t* block_end)
+{
+  unbz_state_s s{};
+  uint32_t v;
+  int ret;
+
+  if (source == nullptr || block_end == nullptr || sourceLen < 12) return BZ_PARAM_ERROR;
+
+  s.cur    = source;
+  s.base   = source;
+  s.end    = source + sourceLen - 4;
+  s.bitbuf = __builtin_bswap64(*reinterpret_cast<uint64_t const*>(source));
+  s.bitpos = 0;
+
+  v = getbits(&s, 24);
+  if (v != (('B' << 16) | ('Z' << 8) | 'h')) return BZ_DATA_ERROR_MAGIC;
+
+  v = getbits(&s, 8) - '0';
+  if (v < 1 || v > 9) return BZ_DATA_ERROR_MAGIC;
+  s.blockSize100k = v;
+
+  if (block_start > 32)  // 32-bits are used for the file header
+  {
+    s.cur    = source + (size_t)(block_start >> 3);
+    s.bitpos = (uint32_t)(block_start & 7);
+    if (s.cur + 8 > s.end) return BZ_PARAM_ERROR;
+    s.bitbuf = __builtin_bswap64(*reinterpret_cast<uint64_t const*>(s.cur));
+  }
+
+  s.tt.resize(s.blockSize100k * 100000);
+
+  ret = bz2_decompress_block(&s);
+  if (ret != BZ_OK && ret != BZ_STREAM_END) return ret;
+  *block_end = ((s.cur - s.base) << 3) + (s.bitpos);
+
+  // The size of the block output is only known once the RLE is undone; bzUnRLE keeps counting the
+  // output past the end of the buffer, so the second pass always fits
+  if (dest.size() < static_cast<size_t>(s.save_nblock)) { dest.resize(s.save_nblock); }
+  for (int pass = 0; pass < 2; pass++) {
+    s.out     = dest.data();
+    s.outbase = dest.data();
+    s.outend  = dest.data() + dest.size();
+    bzUnRLE(&s);
+    if (s.nblock_used != s.save_nblock + 1) return BZ_UNEXPECTED_EOF;
+    auto const out_size = static_cast<size_t>(s.out - s.outbase);
+    auto const fits     = out_size <= dest.size();
+    dest.resize(out_size);
+    if (fits) { break; }
+  }
+  return ret;
+}
+
+std::vector<uint64_t> find_bz2_block_starts(uint8_t const* source,
+                                            size_t sourceLen,
+                                            size_t begin,
+                                            size_t end)
+{
+  constexpr uint64_t block_sig = 0x3141'5926'5359;
+  constexpr uint64_t sig_mask  = (1ull << 48) - 1;
+
+  std::vector<uint64_t> block_starts;
+  uint64_t bits = 0;
+  // A signature starting in the last byte of the range ends in the 7th byte after it
+  size_t const scan_end = std::min(sourceLen, end + 7);
+  for (size_t i = begin; i < scan_end; i++) {
+    bits = (bits << 8) | source[i];
+    // Check the signatures ending in this byte, from the earliest start
+    for (int shift = 7; shift >= 0; shift--) {
+      if (((bits >> shift) & sig_mask) == block_sig) {
+        uint64_t const start = (i + 1) * 8 - shift - 48;
+        // Also excludes the signatures that would start before the first byte that was read
+        if (start >= begin * 8 && start < end * 8) { block_starts.push_back(start); }
+      }
+    }
+  }
+  return block_starts;
+}
+
 }  // namespace io
 }  // namespace cudf
@@ -16,11 +16,21 @@
 
 #pragma once
 
+#include <io/utilities/thread_pool.hpp>
+
+#include <cudf/detail/utilities/pinned_host_vector.hpp>
+#include <cudf/io/datasource.hpp>
+#include <cudf/io/seek_index.hpp>
 #include <cudf/io/types.hpp>
 #include <cudf/utilities/span.hpp>
 
+#include <array>
+#include <future>
 #include <memory>
+#include <optional>
 #include <string>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
 using cudf::host_span;
@@ -31,6 +41,11 @@ namespace io {
 /**
  * @brief Decompresses a system memory buffer.
  *
+ * Supports GZIP, ZIP, BZIP2, ZSTD, LZ4 (frame format), XZ and raw DEFLATE (`ZLIB`); `AUTO`
+ * detects the format from the contents of the buffer, except for raw DEFLATE. The members of GZIP
+ * data (e.g. the blocks of BGZF data) are decompressed in parallel, as are the frames of ZSTD data
+ * when their decompressed sizes are recorded.
+ *
  * @param compression Type of compression of the input data
  * @param src Compressed host buffer
  *
@@ -38,11 +53,190 @@ namespace io {
  */
 std::vector<uint8_t> decompress(compression_type compression, host_span<uint8_t const> src);
 
+/**
+ * @brief Returns the thread pool shared by the host decompressors.
+ *
+ * The number of threads can be set with the `LIBCUDF_HOST_DECOMPRESSION_THREAD_COUNT` environment
+ * variable; defaults to the number of hardware threads.
+ */
+cudf::detail::thread_pool& host_decompression_pool();
+
+namespace detail {
+/**
+ * @brief Returns the flag that marks the threads of `host_decompression_pool`.
+ */
+bool& is_host_decompression_thread();
+}  // namespace detail
+
+/**
+ * @brief Runs a task on the host decompression pool.
+ *
+ * Tasks submitted from a task of the pool are instead run by the thread that waits for their
+ * result, so that nested parallel decompression (e.g. of multiple sources) cannot deadlock by
+ * having all the threads of the pool wait for queued tasks.
+ *
+ * @param task The task to run
+ * @return Future of the result of the task
+ */
+template <typename F>
+std::future<std::invoke_result_t<F const&>> submit_decompression_task(F const& task)
+{
+  if (detail::is_host_decompression_thread()) { return std::async(std::launch::deferred, task); }
+  return host_decompression_pool().submit([task]() {
+    detail::is_host_decompression_thread() = true;
+    return task();
+  });
+}
+
+/**
+ * @brief Waits for all the tasks to finish, then rethrows the first error they reported, if any.
+ *
+ * Errors are only reported once all the tasks are done, as the tasks usually write to a shared
+ * output.
+ *
+ * @param tasks Futures of the tasks, e.g. from `submit_decompression_task`
+ */
+void wait_for_all(std::vector<std::future<void>>& tasks);
+
 size_t decompress(compression_type compression,
                   host_span<uint8_t const> src,
                   host_span<uint8_t> dst,
                   rmm::cuda_stream_view stream);
 
+/**
+ * @brief Interface for the incremental decompression of a compressed source.
+ *
+ * The compressed data is read from the source in bounded windows (except for BZIP2, see
+ * `make_host_stream_decompressor`), so the host memory use does not depend on the size of the
+ * decompressed data.
+ */
+class host_stream_decompressor {
+ public:
+  virtual ~host_stream_decompressor() = default;
+
+  /**
+   * @brief Decompresses the next bytes of the stream.
+   *
+   * @param dst Output buffer
+   * @return Number of bytes written to `dst`; less than `dst.size()` only at the end of the stream
+   */
+  virtual size_t decompress_next(host_span<uint8_t> dst) = 0;
+
+  /**
+   * @brief Returns whether all the data in the stream has been decompressed.
+   */
+  [[nodiscard]] virtual bool is_done() const = 0;
+
+  /**
+   * @brief Returns the decompressed size recorded in the compressed format, if any.
+   *
+   * Only meant to size the output buffers; e.g. GZIP only records the size modulo 2^32.
+   */
+  [[nodiscard]] virtual std::optional<size_t> uncompressed_size_hint() const
+  {
+    return std::nullopt;
+  }
+};
+
+/**
+ * @brief Creates a streaming decompressor for the contents of a source.
+ *
+ * Supports GZIP (including concatenated members), ZIP, BZIP2, ZSTD, LZ4 (frame format) and XZ;
+ * `AUTO` detects these from the source contents, in the same order as `decompress`. The blocks of
+ * BGZF data are decompressed in parallel, a batch of input at a time. BZIP2 blocks are not byte
+ * aligned, so a BZIP2 decompressor holds the whole compressed input in memory and decompresses a
+ * batch of blocks at a time, in parallel. `NONE` reads the source as is, so that uncompressed
+ * sources can be read in chunks through the same interface.
+ *
+ * @param compression Type of compression of the source
+ * @param source Compressed source; must outlive the returned decompressor
+ *
+ * @return The decompressor
+ */
+std::unique_ptr<host_stream_decompressor> make_host_stream_decompressor(
+  compression_type compression, datasource& source);
+
+/**
+ * @brief Decompresses a range of the decompressed data of a source.
+ *
+ * Decompression starts from the last seek point of `index` before the range, if an index is
+ * given; otherwise, from the start of the source.
+ *
+ * @param compression Type of compression of the source
+ * @param source Compressed source
+ * @param offset Offset of the range in the decompressed data
+ * @param size Size of the range; zero to read until the end of the data
+ * @param index Seek index of the source, if available
+ *
+ * @return Decompressed data in the range; truncated at the end of the data
+ */
+std::vector<uint8_t> decompress_range(compression_type compression,
+                                      datasource& source,
+                                      size_t offset,
+                                      size_t size,
+                                      compressed_seek_index const* index);
+
+/**
+ * @brief Builds the seek index of a GZIP or ZSTD source.
+ *
+ * @param source Compressed source
+ * @param compression Compression type of the source; `AUTO` to detect it from the contents
+ * @param spacing Minimum distance between seek points, in bytes of decompressed data
+ *
+ * @return The seek index
+ */
+compressed_seek_index build_seek_index(datasource& source,
+                                       compression_type compression,
+                                       size_t spacing);
+
+/**
+ * @brief Produces the decompressed data of a stream in fixed-size chunks, decompressing the next
+ * chunk in a background thread while the current one is consumed.
+ *
+ * Chunks are written to page-locked memory so that they can be copied to the device
+ * asynchronously.
+ */
+class chunked_stream_decompressor {
+ public:
+  /**
+   * @brief Constructor; starts decompressing the first chunk.
+   *
+   * @param decompressor Decompressor of the stream
+   * @param chunk_size Size of the decompressed chunks
+   */
+  chunked_stream_decompressor(std::unique_ptr<host_stream_decompressor> decompressor,
+                              size_t chunk_size);
+
+  /**
+   * @brief Returns the next chunk of decompressed data.
+   *
+   * All chunks but the last one are `chunk_size` bytes long; the returned span is empty once all
+   * data has been returned. The chunk data is only valid until the next call.
+   */
+  host_span<uint8_t const> next_chunk();
+
+  /**
+   * @brief Returns whether the chunk returned by the last `next_chunk` call was the last one.
+   */
+  [[nodiscard]] bool is_done() const { return _is_done; }
+
+  /**
+   * @brief Returns the decompressed size recorded in the compressed format, if any.
+   */
+  [[nodiscard]] std::optional<size_t> uncompressed_size_hint() const { return _size_hint; }
+
+ private:
+  void decompress_next_async();
+
+  std::unique_ptr<host_stream_decompressor> _decompressor;
+  std::optional<size_t> _size_hint;
+  std::array<cudf::detail::pinned_host_vector<uint8_t>, 2> _buffers;
+  int _next_buffer = 0;
+  bool _is_done    = false;
+  // Size of the chunk decompressed in the background, and whether it is the last one
+  std::future<std::pair<size_t, bool>> _next_chunk;
+};
+
 /**
  * @brief GZIP header flags
  * See https://tools.ietf.org/html/rfc1952
@@ -0,0 +1,373 @@
+/*
+ * Copyright (c) 2023, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "io_uncomp.hpp"
+
+#include <cudf/io/seek_index.hpp>
+#include <cudf/io/text/detail/bgzip_utils.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <iterator>
+#include <memory>
+#include <optional>
+#include <sstream>
+#include <string>
+
+#include <zlib.h>
+#include <zstd.h>
+
+namespace cudf {
+namespace io {
+namespace {
+
+// Identifies serialized seek indexes
+constexpr std::array<char, 8> seek_index_magic{{'C', 'U', 'D', 'F', 'S', 'I', 'D', 'X'}};
+constexpr uint32_t seek_index_version = 1;
+
+// DEFLATE blocks can refer to up to 32KB of preceding data
+constexpr size_t deflate_window_size = 32 * 1024;
+
+// Size of the windows in which the compressed input is read while building the index
+constexpr size_t index_input_window_size = 4 * 1024 * 1024;
+
+// BGZF blocks are GZIP members with a "BC" extra subfield
+constexpr std::array<uint8_t, 4> bgzf_magic{{0x1f, 0x8b, 8, GZIPHeaderFlag::fextra}};
+constexpr size_t gzip_fixed_header_size = 12;  // Includes the size of the extra field
+
+// ZSTD frames start with a magic number; skippable frames use 16 magic numbers
+constexpr uint32_t zstd_frame_magic           = 0xFD2F'B528;
+constexpr uint32_t zstd_skippable_frame_magic = 0x184D'2A50;
+
+// Size of the fixed-size fields of a serialized seek point
+constexpr size_t seek_point_min_size = 2 * sizeof(uint64_t) + sizeof(uint8_t) + sizeof(uint32_t);
+
+template <typename T>
+void write_value(std::vector<uint8_t>& out, T value)
+{
+  auto const pos = out.size();
+  out.resize(pos + sizeof(T));
+  std::memcpy(out.data() + pos, &value, sizeof(T));
+}
+
+template <typename T>
+T read_value(host_span<uint8_t const> data, size_t& pos)
+{
+  CUDF_EXPECTS(pos + sizeof(T) <= data.size(), "Truncated seek index");
+  T value;
+  std::memcpy(&value, data.data() + pos, sizeof(T));
+  pos += sizeof(T);
+  return value;
+}
+
+bool is_bgzf(datasource& source, size_t offset = 0)
+{
+  std::array<uint8_t, gzip_fixed_header_size + 2> header{};
+  if (source.size() < offset + header.size()) { return false; }
+  source.host_read(offset, header.size(), header.data());
+  return std::equal(bgzf_magic.begin(), bgzf_magic.end(), header.begin()) and
+         header[gzip_fixed_header_size] == 'B' and header[gzip_fixed_header_size + 1] == 'C';
+}
+
+/**
+ * @brief Builds the index of a BGZF source from its block headers and footers
+ *
+ * @return The index, or an empty optional if a GZIP member that is not a BGZF block follows the
+ * BGZF blocks
+ */
+std::optional<compressed_seek_index> build_bgzf_seek_index(datasource& source, size_t spacing)
+{
+  namespace bgzip = cudf::io::text::detail::bgzip;
+
+  auto const source_size = source.size();
+  std::vector<seek_point> points{seek_point{}};
+  uint64_t compressed_offset   = 0;
+  uint64_t uncompressed_offset = 0;
+  std::string header(gzip_fixed_header_size, '\0');
+  std::string footer(sizeof(bgzip::footer), '\0');
+  while (compressed_offset < source_size) {
+    if (uncompressed_offset - points.back().uncompressed_offset >= spacing) {
+      points.push_back({compressed_offset, uncompressed_offset});
+    }
+    if (not is_bgzf(source, compressed_offset)) { return std::nullopt; }
+    header.resize(gzip_fixed_header_size);
+    source.host_read(compressed_offset, header.size(), reinterpret_cast<uint8_t*>(header.data()));
+    // The fixed header ends with the size of the extra field, which holds the block size
+    uint16_t extra_length = 0;
+    std::memcpy(&extra_length, header.data() + gzip_fixed_header_size - 2, sizeof(extra_length));
+    header.resize(gzip_fixed_header_size + extra_length);
+    CUDF_EXPECTS(compressed_offset + header.size() <= source_size, "Truncated BGZF block");
+    source.host_read(compressed_offset, header.size(), reinterpret_cast<uint8_t*>(header.data()));
+    std::istringstream header_stream(header);
+    auto const block_size = bgzip::read_header(header_stream).block_size;
+
+    CUDF_EXPECTS(compressed_offset + block_size <= source_size, "Truncated BGZF block");
+    source.host_read(compressed_offset + block_size - footer.size(),
+                     footer.size(),
+                     reinterpret_cast<uint8_t*>(footer.data()));
+    std::istringstream footer_stream(footer);
+    uncompressed_offset += bgzip::read_footer(footer_stream).decompressed_size;
+    compressed_offset += block_size;
+  }
+  return {compression_type::GZIP, std::move(points), uncompressed_offset};
+}
+
+bool is_zstd(datasource& source)
+{
+  uint32_t magic = 0;
+  if (source.size() < sizeof(magic)) { return false; }
+  source.host_read(0, sizeof(magic), reinterpret_cast<uint8_t*>(&magic));
+  return magic == zstd_frame_magic or (magic & ~0xFu) == zstd_skippable_frame_magic;
+}
+
+/**
+ * @brief Owns a zlib inflate stream
+ */
+struct inflate_stream {
+  z_stream strm{};
+
+  explicit inflate_stream(int window_bits)
+  {
+    CUDF_EXPECTS(inflateInit2(&strm, window_bits) == Z_OK, "Error in DEFLATE stream");
+  }
+  inflate_stream(inflate_stream const&)            = delete;
+  inflate_stream& operator=(inflate_stream const&) = delete;
+  ~inflate_stream() { inflateEnd(&strm); }
+};
+
+/**
+ * @brief Builds the index of a GZIP source by decompressing it, placing seek points at the
+ * DEFLATE block boundaries (as in zlib's zran example) and at the start of GZIP members
+ */
+compressed_seek_index build_deflate_seek_index(datasource& source, size_t spacing)
+{
+  auto const source_size = source.size();
+  inflate_stream stream(15 + 16);
+  auto& strm = stream.strm;
+
+  std::vector<uint8_t> input(index_input_window_size);
+  // Circular buffer of the last decompressed bytes
+  std::vector<uint8_t> window(deflate_window_size);
+  std::vector<seek_point> points{seek_point{}};
+  uint64_t total_in  = 0;  // Input consumed by the decompressor
+  uint64_t total_out = 0;
+
+  // Reads more input, keeping the unconsumed input; returns false at the end of the source
+  auto read_input = [&]() {
+    auto const read_ofs = total_in + strm.avail_in;
+    if (read_ofs == source_size) { return false; }
+    if (strm.avail_in != 0) { std::memmove(input.data(), strm.next_in, strm.avail_in); }
+    auto const read_size = std::min<size_t>(input.size() - strm.avail_in, source_size - read_ofs);
+    source.host_read(read_ofs, read_size, input.data() + strm.avail_in);
+    strm.next_in = input.data();
+    strm.avail_in += read_size;
+    return true;
+  };
+
+  while (true) {
+    if (strm.avail_in == 0) {
+      CUDF_EXPECTS(read_input(), "Error in DEFLATE stream: unexpected end of data");
+    }
+    if (strm.avail_out == 0) {
+      strm.next_out  = window.data();
+      strm.avail_out = window.size();
+    }
+    auto const avail_in  = strm.avail_in;
+    auto const avail_out = strm.avail_out;
+    // Stop at the end of each block
+    auto const zerr = inflate(&strm, Z_BLOCK);
+    total_in += avail_in - strm.avail_in;
+    total_out += avail_out - strm.avail_out;
+
+    auto const is_far_enough = total_out - points.back().uncompressed_offset >= spacing;
+    if (zerr == Z_STREAM_END) {
+      if (strm.avail_in < 2) { read_input(); }
+      if (strm.avail_in < 2 or strm.next_in[0] != 0x1f or strm.next_in[1] != 0x8b) { break; }
+      // Concatenated GZIP member; its start is a seek point that does not need a window
+      CUDF_EXPECTS(inflateReset(&strm) == Z_OK, "Error in DEFLATE stream");
+      if (is_far_enough) { points.push_back({total_in, total_out}); }
+      continue;
+    }
+    CUDF_EXPECTS(zerr == Z_OK or zerr == Z_BUF_ERROR, "Error in DEFLATE stream");
+
+    // At the end of a block that is not the last one of the member
+    auto const is_block_end = (strm.data_type & 128) != 0 and (strm.data_type & 64) == 0;
+    if (is_block_end and is_far_enough) {
+      seek_point point{total_in, total_out, static_cast<uint8_t>(strm.data_type & 7)};
+      // Unroll the circular buffer, keeping the last decompressed bytes
+      auto const window_pos = window.size() - strm.avail_out;
+      point.window.reserve(window.size());
+      point.window.insert(point.window.end(), window.begin() + window_pos, window.end());
+      point.window.insert(point.window.end(), window.begin(), window.begin() + window_pos);
+      auto const num_valid = std::min<size_t>(total_out, window.size());
+      point.window.erase(point.window.begin(), point.window.end() - num_valid);
+      points.push_back(std::move(point));
+    }
+  }
+  return {compression_type::GZIP, std::move(points), total_out};
+}
+
+/**
+ * @brief Builds the index of a ZSTD source by decompressing it, placing seek points at the start
+ * of frames
+ *
+ * Frames are independent, so decompression can start at any frame without a window. The source
+ * is decompressed rather than sized from the frame headers, as the headers do not always record
+ * the decompressed size of the frame.
+ */
+compressed_seek_index build_zstd_seek_index(datasource& source, size_t spacing)
+{
+  auto const source_size = source.size();
+  std::unique_ptr<ZSTD_DCtx, decltype(&ZSTD_freeDCtx)> dctx{ZSTD_createDCtx(), ZSTD_freeDCtx};
+  CUDF_EXPECTS(dctx != nullptr, "Error in ZSTD stream");
+
+  std::vector<uint8_t> input(index_input_window_size);
+  std::vector<uint8_t> output(ZSTD_DStreamOutSize());
+  std::vector<seek_point> points{seek_point{}};
+  uint64_t input_pos = 0;  // Offset of the input window in the source
+  uint64_t total_out = 0;
+  bool is_frame_end  = false;
+  while (input_pos < source_size) {
+    auto const read_size = std::min<size_t>(input.size(), source_size - input_pos);
+    source.host_read(input_pos, read_size, input.data());
+    ZSTD_inBuffer in{input.data(), read_size, 0};
+    while (in.pos < in.size) {
+      if (is_frame_end) {
+        // Start of the next frame
+        uint64_t const frame_offset = input_pos + in.pos;
+        if (total_out - points.back().uncompressed_offset >= spacing) {
+          points.push_back({frame_offset, total_out});
+        }
+      }
+      ZSTD_outBuffer out{output.data(), output.size(), 0};
+      auto const prev_in_pos = in.pos;
+      // Zero once a frame is fully decompressed and flushed
+      auto const ret = ZSTD_decompressStream(dctx.get(), &out, &in);
+      CUDF_EXPECTS(not ZSTD_isError(ret), "Error in ZSTD stream");
+      CUDF_EXPECTS(in.pos != prev_in_pos or out.pos != 0,
+                   "Error in ZSTD stream: unexpected end of data");
+      total_out += out.pos;
+      is_frame_end = ret == 0;
+    }
+    input_pos += read_size;
+  }
+  // Flush the data of the last frame that is still buffered in the decompressor
+  while (not is_frame_end) {
+    ZSTD_inBuffer in{nullptr, 0, 0};
+    ZSTD_outBuffer out{output.data(), output.size(), 0};
+    auto const ret = ZSTD_decompressStream(dctx.get(), &out, &in);
+    CUDF_EXPECTS(not ZSTD_isError(ret) and out.pos != 0,
+                 "Error in ZSTD stream: unexpected end of data");
+    total_out += out.pos;
+    is_frame_end = ret == 0;
+  }
+  return {compression_type::ZSTD, std::move(points), total_out};
+}
+
+}  // namespace
+
+compressed_seek_index::compressed_seek_index(compression_type compression,
+                                             std::vector<seek_point> points,
+                                             uint64_t uncompressed_size)
+  : _compression{compression}, _points{std::move(points)}, _uncompressed_size{uncompressed_size}
+{
+  CUDF_EXPECTS(not _points.empty() and _points.front().compressed_offset == 0 and
+                 _points.front().uncompressed_offset == 0,
+               "The first seek point must be at the start of the source");
+  CUDF_EXPECTS(std::is_sorted(_points.cbegin(),
+                              _points.cend(),
+                              [](auto const& lhs, auto const& rhs) {
+                                return lhs.uncompressed_offset < rhs.uncompressed_offset;
+                              }),
+               "Seek points must be sorted by offset");
+}
+
+seek_point const& compressed_seek_index::find(uint64_t uncompressed_offset) const
+{
+  CUDF_EXPECTS(not _points.empty(), "Empty seek index");
+  auto const it = std::upper_bound(
+    _points.cbegin(), _points.cend(), uncompressed_offset, [](auto offset, auto const& point) {
+      return offset < point.uncompressed_offset;
+    });
+  return *std::prev(it);
+}
+
+std::vector<uint8_t> compressed_seek_index::serialize() const
+{
+  std::vector<uint8_t> out(seek_index_magic.begin(), seek_index_magic.end());
+  write_value(out, seek_index_version);
+  write_value(out, static_cast<int32_t>(_compression));
+  write_value(out, _uncompressed_size);
+  write_value(out, static_cast<uint64_t>(_points.size()));
+  for (auto const& point : _points) {
+    write_value(out, point.compressed_offset);
+    write_value(out, point.uncompressed_offset);
+    write_value(out, point.bit_offset);
+    write_value(out, static_cast<uint32_t>(point.window.size()));
+    out.insert(out.end(), point.window.begin(), point.window.end());
+  }
+  return out;
+}
+
+compressed_seek_index compressed_seek_index::deserialize(host_span<uint8_t const> data)
+{
+  CUDF_EXPECTS(data.size() >= seek_index_magic.size() and
+                 std::equal(seek_index_magic.begin(), seek_index_magic.end(), data.begin()),
+               "Invalid seek index");
+  size_t pos = seek_index_magic.size();
+  CUDF_EXPECTS(read_value<uint32_t>(data, pos) == seek_index_version,
+               "Unsupported seek index version");
+  auto const compression       = static_cast<compression_type>(read_value<int32_t>(data, pos));
+  auto const uncompressed_size = read_value<uint64_t>(data, pos);
+  auto const num_points        = read_value<uint64_t>(data, pos);
+  // Validate the count before allocating, as each point takes at least its fixed-size fields
+  CUDF_EXPECTS(num_points <= (data.size() - pos) / seek_point_min_size, "Truncated seek index");
+  std::vector<seek_point> points;
+  points.reserve(num_points);
+  for (uint64_t i = 0; i < num_points; ++i) {
+    seek_point point;
+    point.compressed_offset   = read_value<uint64_t>(data, pos);
+    point.uncompressed_offset = read_value<uint64_t>(data, pos);
+    point.bit_offset          = read_value<uint8_t>(data, pos);
+    auto const window_size    = read_value<uint32_t>(data, pos);
+    CUDF_EXPECTS(pos + window_size <= data.size(), "Truncated seek index");
+    point.window.assign(data.begin() + pos, data.begin() + pos + window_size);
+    pos += window_size;
+    points.push_back(std::move(point));
+  }
+  return {compression, std::move(points), uncompressed_size};
+}
+
+compressed_seek_index build_seek_index(datasource& source,
+                                       compression_type compression,
+                                       size_t spacing)
+{
+  CUDF_EXPECTS(spacing > 0, "Seek point spacing must be positive");
+  if (compression == compression_type::ZSTD or
+      (compression == compression_type::AUTO and is_zstd(source))) {
+    return build_zstd_seek_index(source, spacing);
+  }
+  if (is_bgzf(source)) {
+    // Sources that only start with BGZF blocks are indexed by decompressing them
+    if (auto index = build_bgzf_seek_index(source, spacing)) { return std::move(*index); }
+  }
+  return build_deflate_seek_index(source, spacing);
+}
+
+}  // namespace io
+}  // namespace cudf
@@ -77,6 +77,10 @@ For more information on these sources, see the manual.
 
 #pragma once
 
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
 namespace cudf {
 namespace io {
 // If BZ_OUTBUFF_FULL is returned and block_start is non-NULL, dstlen will be updated to point to
@@ -102,5 +106,39 @@ int32_t cpu_bz2_uncompress(uint8_t const* input,
                            size_t* dstlen,
                            uint64_t* block_start = nullptr);
 
+/**
+ * @brief Decompresses a single block of a BZIP2 stream.
+ *
+ * @param input BZIP2 stream, starting with the file header
+ * @param inlen Size of the stream
+ * @param block_start Offset in bits of the block
+ * @param dst Output buffer; resized to the size of the decompressed block
+ * @param block_end Set to the offset in bits of the next block
+ *
+ * @return BZ_OK if another block follows, BZ_STREAM_END if this is the last block, or an error code
+ */
+int32_t cpu_bz2_uncompress_block(uint8_t const* input,
+                                 size_t inlen,
+                                 uint64_t block_start,
+                                 std::vector<uint8_t>& dst,
+                                 uint64_t* block_end);
+
+/**
+ * @brief Finds the block signatures of a BZIP2 stream that start in the given byte range.
+ *
+ * The signature can also appear within compressed data, so not all the positions are block starts.
+ *
+ * @param input BZIP2 stream
+ * @param inlen Size of the stream
+ * @param begin First byte of the range
+ * @param end Byte after the range
+ *
+ * @return Offsets in bits of the signatures, in increasing order
+ */
+std::vector<uint64_t> find_bz2_block_starts(uint8_t const* input,
+                                            size_t inlen,
+                                            size_t begin,
+                                            size_t end);
+
 }  // namespace io
 }  // namespace cudf
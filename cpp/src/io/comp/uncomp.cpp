@@ -15,20 +15,33 @@
  */
 
 #include "io_uncomp.hpp"
-#include "nvcomp_adapter.hpp"
 #include "unbz2.hpp"  // bz2 uncompress
 
-#include <io/utilities/hostdevice_vector.hpp>
+#include <io/utilities/config_utils.hpp>
+#include <io/utilities/thread_pool.hpp>
 
-#include <cudf/detail/utilities/vector_factories.hpp>
+#include <cudf/io/text/detail/bgzip_utils.hpp>
 #include <cudf/utilities/error.hpp>
 #include <cudf/utilities/span.hpp>
 
 #include <cuda_runtime.h>
 
+#include <algorithm>
 #include <cstring>  // memset
+#include <exception>
+#include <future>
+#include <iterator>
+#include <limits>
+#include <numeric>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <tuple>
 
-#include <zlib.h>   // uncompress
+#include <lz4frame.h>
+#include <lzma.h>
+#include <zlib.h>  // uncompress
+#include <zstd.h>
 
 using cudf::host_span;
 
@@ -278,6 +291,552 @@ void cpu_inflate_vector(std::vector<uint8_t>& dst, uint8_t const* comp_data, siz
   CUDF_EXPECTS(zerr == Z_STREAM_END, "Error in DEFLATE stream");
 }
 
+cudf::detail::thread_pool& host_decompression_pool()
+{
+  static auto const pool = std::make_unique<cudf::detail::thread_pool>(
+    detail::getenv_or("LIBCUDF_HOST_DECOMPRESSION_THREAD_COUNT",
+                      std::max(1u, std::thread::hardware_concurrency())));
+  return *pool;
+}
+
+bool& detail::is_host_decompression_thread()
+{
+  thread_local bool is_pool_thread = false;
+  return is_pool_thread;
+}
+
+void wait_for_all(std::vector<std::future<void>>& tasks)
+{
+  std::exception_ptr error;
+  for (auto& task : tasks) {
+    try {
+      task.get();
+    } catch (...) {
+      if (not error) { error = std::current_exception(); }
+    }
+  }
+  if (error) { std::rethrow_exception(error); }
+}
+
+namespace {
+
+// Signatures of the formats decompressed with external libraries
+constexpr uint32_t zstd_frame_magic           = 0xFD2F'B528;
+constexpr uint32_t zstd_skippable_frame_magic = 0x184D'2A50;  // Low 4 bits are user defined
+constexpr uint32_t lz4_frame_magic            = 0x184D'2204;
+constexpr size_t zstd_max_frame_header_size   = 18;
+constexpr std::array<uint8_t, 6> xz_magic{{0xFD, '7', 'z', 'X', 'Z', 0x00}};
+
+uint32_t read_le_uint32(host_span<uint8_t const> data)
+{
+  uint32_t value = 0;
+  std::memcpy(&value, data.data(), std::min(sizeof(value), data.size()));
+  return value;
+}
+
+bool is_zstd(host_span<uint8_t const> header)
+{
+  if (header.size() < 4) { return false; }
+  auto const magic = read_le_uint32(header);
+  return magic == zstd_frame_magic or (magic & ~0xFu) == zstd_skippable_frame_magic;
+}
+
+bool is_lz4_frame(host_span<uint8_t const> header)
+{
+  return header.size() >= 4 and read_le_uint32(header) == lz4_frame_magic;
+}
+
+bool is_xz(host_span<uint8_t const> header)
+{
+  return header.size() >= xz_magic.size() and
+         std::equal(xz_magic.begin(), xz_magic.end(), header.begin());
+}
+
+/**
+ * @brief Decompresses a host buffer with the streaming decompressor of the given format
+ */
+std::vector<uint8_t> decompress_as_stream(compression_type compression,
+                                          host_span<uint8_t const> src)
+{
+  auto const source = datasource::create(
+    host_span<std::byte const>{reinterpret_cast<std::byte const*>(src.data()), src.size()});
+  // A range of size zero decompresses the whole source
+  return decompress_range(compression, *source, 0, 0, nullptr);
+}
+
+/**
+ * @brief Decompresses ZSTD data, decompressing the frames in parallel
+ *
+ * Frames are independent, so when the decompressed size of each frame is recorded in its header,
+ * the frames are decompressed concurrently into their place in the output. Otherwise, the frames
+ * are decompressed sequentially as a stream.
+ */
+std::vector<uint8_t> decompress_zstd_frames(host_span<uint8_t const> src)
+{
+  struct frame_info {
+    size_t comp_offset;
+    size_t comp_size;
+    size_t uncomp_offset;
+  };
+  std::vector<frame_info> frames;
+  size_t uncomp_size = 0;
+  for (size_t comp_offset = 0; comp_offset < src.size();) {
+    auto const frame     = src.subspan(comp_offset, src.size() - comp_offset);
+    auto const comp_size = ZSTD_findFrameCompressedSize(frame.data(), frame.size());
+    CUDF_EXPECTS(not ZSTD_isError(comp_size), "Error in ZSTD stream");
+    // Zero for skippable frames
+    auto const content_size = ZSTD_getFrameContentSize(frame.data(), frame.size());
+    if (content_size == ZSTD_CONTENTSIZE_UNKNOWN or content_size == ZSTD_CONTENTSIZE_ERROR) {
+      return decompress_as_stream(compression_type::ZSTD, src);
+    }
+    frames.push_back({comp_offset, comp_size, uncomp_size});
+    comp_offset += comp_size;
+    uncomp_size += content_size;
+  }
+
+  std::vector<uint8_t> dst(uncomp_size);
+  std::vector<std::future<void>> tasks;
+  tasks.reserve(frames.size());
+  for (size_t i = 0; i < frames.size(); ++i) {
+    auto const uncomp_end = i + 1 < frames.size() ? frames[i + 1].uncomp_offset : uncomp_size;
+    tasks.emplace_back(submit_decompression_task([&, i, uncomp_end]() {
+      auto const& frame      = frames[i];
+      auto const frame_size  = uncomp_end - frame.uncomp_offset;
+      auto const num_written = ZSTD_decompress(dst.data() + frame.uncomp_offset,
+                                               frame_size,
+                                               src.data() + frame.comp_offset,
+                                               frame.comp_size);
+      CUDF_EXPECTS(not ZSTD_isError(num_written) and num_written == frame_size,
+                   "Error in ZSTD stream");
+    }));
+  }
+  wait_for_all(tasks);
+  return dst;
+}
+
+// Bit offset of the first BZIP2 block, after the "BZh" signature and the block size
+constexpr uint64_t bz2_first_block_start = 32;
+
+// Unit of the block size recorded in the BZIP2 stream header ("BZh1" to "BZh9")
+constexpr size_t bz2_block_size_unit = 100'000;
+
+// Size of the input segments in which BZIP2 block signatures are searched in parallel
+constexpr size_t bz2_scan_segment_size = 1024 * 1024;
+
+/**
+ * @brief Decodes the blocks of a BZIP2 stream in parallel, in stream order
+ *
+ * Blocks are not byte aligned and their size is not recorded, so the input is first scanned for
+ * the 48-bit block signature. The signature can also appear in the compressed data; such false
+ * positives are decoded along with the actual blocks, and then discarded because blocks are only
+ * accepted where the previous block ends.
+ */
+class bz2_block_decoder {
+ public:
+  explicit bz2_block_decoder(host_span<uint8_t const> input) : _input{input}
+  {
+    auto const num_segments = (_input.size() + bz2_scan_segment_size - 1) / bz2_scan_segment_size;
+    std::vector<std::future<std::vector<uint64_t>>> tasks;
+    tasks.reserve(num_segments);
+    for (size_t i = 0; i < num_segments; ++i) {
+      auto const begin = i * bz2_scan_segment_size;
+      auto const end   = std::min(begin + bz2_scan_segment_size, _input.size());
+      tasks.emplace_back(submit_decompression_task([input = _input, begin, end]() {
+        return find_bz2_block_starts(input.data(), input.size(), begin, end);
+      }));
+    }
+    for (auto& task : tasks) {
+      auto const starts = task.get();
+      _block_starts.insert(_block_starts.end(), starts.begin(), starts.end());
+    }
+  }
+
+  /**
+   * @brief Decodes up to `max_blocks` candidate blocks, starting at the next block
+   *
+   * @return Decompressed blocks, in stream order; may hold fewer blocks than were decoded if the
+   * candidates include false positives
+   */
+  std::vector<std::vector<uint8_t>> decode_next_blocks(size_t max_blocks)
+  {
+    CUDF_EXPECTS(not _is_done, "No BZIP2 blocks left to decode");
+    auto const first = std::lower_bound(_block_starts.cbegin(), _block_starts.cend(), _next_start);
+    CUDF_EXPECTS(first != _block_starts.cend() and *first == _next_start,
+                 "Decompression: error in stream");
+    auto const last = first + std::min<size_t>(max_blocks, _block_starts.cend() - first);
+
+    struct decoded_block {
+      int32_t bz_err;
+      uint64_t end;
+      std::vector<uint8_t> data;
+    };
+    auto const decode = [input = _input](uint64_t start) {
+      decoded_block block{};
+      block.bz_err =
+        cpu_bz2_uncompress_block(input.data(), input.size(), start, block.data, &block.end);
+      return block;
+    };
+    std::vector<std::future<decoded_block>> tasks;
+    tasks.reserve(last - first);
+    std::transform(first, last, std::back_inserter(tasks), [&](auto start) {
+      return submit_decompression_task([&decode, start]() { return decode(start); });
+    });
+    // Wait for all the tasks before processing the results, as they read from the input
+    std::vector<decoded_block> blocks;
+    blocks.reserve(tasks.size());
+    std::transform(tasks.begin(), tasks.end(), std::back_inserter(blocks), [](auto& task) {
+      return task.get();
+    });
+
+    std::vector<std::vector<uint8_t>> output;
+    for (size_t i = 0; i < blocks.size() and not _is_done; ++i) {
+      // Skip the signatures found within the compressed data
+      if (first[i] != _next_start) { continue; }
+      CUDF_EXPECTS(blocks[i].bz_err == BZ_OK or blocks[i].bz_err == BZ_STREAM_END,
+                   "Decompression: error in stream");
+      output.emplace_back(std::move(blocks[i].data));
+      _next_start = blocks[i].end;
+      _is_done    = blocks[i].bz_err == BZ_STREAM_END;
+    }
+    return output;
+  }
+
+  /**
+   * @brief Returns whether the last block of the stream has been decoded
+   */
+  [[nodiscard]] bool is_done() const { return _is_done; }
+
+  /**
+   * @brief Returns the decompressed size of the stream if all its blocks are full
+   *
+   * The block size in the stream header bounds the size of each block before the initial
+   * run-length decoding, so the estimate is exact except for the last block and for data with
+   * long runs of repeated bytes.
+   */
+  [[nodiscard]] size_t uncompressed_size_hint() const
+  {
+    auto const block_size = static_cast<size_t>(_input[3] - '0') * bz2_block_size_unit;
+    return _block_starts.size() * block_size;
+  }
+
+ private:
+  host_span<uint8_t const> _input;
+  std::vector<uint64_t> _block_starts;  // Bit offsets of the block signatures, in increasing order
+  uint64_t _next_start = bz2_first_block_start;
+  bool _is_done        = false;
+};
+
+// Size of the GZIP member trailer (CRC32 and input size)
+constexpr size_t gzip_trailer_size = 8;
+
+// BGZF blocks are GZIP members with a "BC" extra subfield that holds the size of the block
+constexpr std::array<uint8_t, 4> bgzf_magic{{0x1f, 0x8b, 8, GZIPHeaderFlag::fextra}};
+constexpr size_t bgzf_fixed_header_size = 12;  // Includes the size of the extra field
+// BGZF blocks hold at most 64KB of decompressed data
+constexpr size_t bgzf_max_block_size = 64 * 1024;
+
+// Maximum compression ratio of DEFLATE; bounds the trust put in recorded decompressed sizes
+constexpr size_t max_deflate_ratio = 1032;
+
+// Size of the input segments in which GZIP member headers are searched in parallel
+constexpr size_t gzip_scan_segment_size = 1024 * 1024;
+
+uint32_t read_gzip_isize(host_span<uint8_t const> data)
+{
+  // The trailer of the (last) member holds the input size modulo 2^32
+  return read_le_uint32(data.subspan(data.size() - 4, 4));
+}
+
+bool is_bgzf_block(host_span<uint8_t const> data)
+{
+  return data.size() >= bgzf_fixed_header_size + 2 and
+         std::equal(bgzf_magic.begin(), bgzf_magic.end(), data.begin()) and
+         data[bgzf_fixed_header_size] == 'B' and data[bgzf_fixed_header_size + 1] == 'C';
+}
+
+struct bgzf_block {
+  size_t data_offset;    // Offset of the raw DEFLATE data in the input
+  size_t data_size;      // Size of the raw DEFLATE data
+  size_t uncomp_offset;  // Offset of the decompressed block in the output
+  size_t uncomp_size;
+};
+
+/**
+ * @brief Parses the headers and footers of the BGZF blocks at the start of the input
+ *
+ * Parsing stops at the first block that is not fully contained in the input, or at the first
+ * GZIP member that is not a BGZF block.
+ *
+ * @return The blocks, and the size of the input they span
+ */
+std::pair<std::vector<bgzf_block>, size_t> parse_bgzf_blocks(host_span<uint8_t const> input)
+{
+  namespace bgzip = cudf::io::text::detail::bgzip;
+
+  std::vector<bgzf_block> blocks;
+  size_t offset        = 0;
+  size_t uncomp_offset = 0;
+  auto const as_string = [&](size_t pos, size_t size) {
+    return std::string(reinterpret_cast<char const*>(input.data()) + pos, size);
+  };
+  while (is_bgzf_block(input.subspan(offset, input.size() - offset))) {
+    uint16_t extra_length = 0;
+    std::memcpy(&extra_length,
+                input.data() + offset + bgzf_fixed_header_size - sizeof(extra_length),
+                sizeof(extra_length));
+    auto const header_size = bgzf_fixed_header_size + extra_length;
+    if (offset + header_size > input.size()) { break; }
+    std::istringstream header_stream(as_string(offset, header_size));
+    auto const header     = bgzip::read_header(header_stream);
+    auto const block_size = static_cast<size_t>(header.block_size);
+    CUDF_EXPECTS(block_size >= header_size + gzip_trailer_size, "Error in BGZF block header");
+    if (offset + block_size > input.size()) { break; }
+
+    std::istringstream footer_stream(
+      as_string(offset + block_size - gzip_trailer_size, gzip_trailer_size));
+    auto const uncomp_size = bgzip::read_footer(footer_stream).decompressed_size;
+    // Also bounds the output allocated from the recorded sizes
+    CUDF_EXPECTS(uncomp_size <= bgzf_max_block_size, "Error in BGZF block footer");
+    blocks.push_back({offset + header_size,
+                      static_cast<size_t>(header.data_size()),
+                      uncomp_offset,
+                      static_cast<size_t>(uncomp_size)});
+    offset += block_size;
+    uncomp_offset += uncomp_size;
+  }
+  return {std::move(blocks), offset};
+}
+
+/**
+ * @brief Returns the total decompressed size of the parsed BGZF blocks
+ */
+size_t bgzf_uncompressed_size(std::vector<bgzf_block> const& blocks)
+{
+  return blocks.empty() ? 0 : blocks.back().uncomp_offset + blocks.back().uncomp_size;
+}
+
+/**
+ * @brief Decompresses BGZF blocks in parallel, each into its place in the output
+ *
+ * @param input Compressed data the blocks were parsed from
+ * @param blocks Blocks to decompress
+ * @param output Output buffer, of the total decompressed size of the blocks
+ */
+void inflate_bgzf_blocks(host_span<uint8_t const> input,
+                         std::vector<bgzf_block> const& blocks,
+                         host_span<uint8_t> output)
+{
+  // Blocks are small, so each task decompresses a range of blocks
+  auto const num_tasks =
+    std::min<size_t>(blocks.size(), 2 * host_decompression_pool().get_thread_count());
+  std::vector<std::future<void>> tasks;
+  tasks.reserve(num_tasks);
+  for (size_t t = 0; t < num_tasks; ++t) {
+    auto const first = blocks.size() * t / num_tasks;
+    auto const last  = blocks.size() * (t + 1) / num_tasks;
+    tasks.emplace_back(submit_decompression_task([&, first, last]() {
+      for (auto i = first; i < last; ++i) {
+        auto const& block = blocks[i];
+        // Skip empty blocks, such as the end-of-file marker block
+        if (block.uncomp_size == 0) { continue; }
+        auto uncomp_size = block.uncomp_size;
+        auto const zerr  = cpu_inflate(output.data() + block.uncomp_offset,
+                                      &uncomp_size,
+                                      input.data() + block.data_offset,
+                                      block.data_size);
+        CUDF_EXPECTS(zerr == Z_OK and uncomp_size == block.uncomp_size, "Error in BGZF block");
+      }
+    }));
+  }
+  wait_for_all(tasks);
+}
+
+/**
+ * @brief Returns whether the data at the given position looks like the header of a GZIP member
+ */
+bool is_gzip_member_start(host_span<uint8_t const> input, size_t pos)
+{
+  // The reserved flag bits must be zero
+  return pos + sizeof(gz_file_header_s) <= input.size() and input[pos] == 0x1f and
+         input[pos + 1] == 0x8b and input[pos + 2] == 8 and (input[pos + 3] & 0xe0) == 0;
+}
+
+struct inflated_gzip_member {
+  bool is_valid;
+  size_t comp_size;  // Size of the member, including its header and trailer
+  std::vector<uint8_t> data;
+};
+
+/**
+ * @brief Decompresses the GZIP member at the start of the input
+ *
+ * Invalid data is reported through the result rather than with an exception, as members are also
+ * decompressed speculatively, from positions that only look like the start of a member.
+ *
+ * @param input Compressed data that starts with a GZIP member
+ * @param size_hint Expected decompressed size of the member
+ */
+inflated_gzip_member inflate_gzip_member(host_span<uint8_t const> input, size_t size_hint)
+{
+  inflated_gzip_member member{false, 0, std::vector<uint8_t>(size_hint)};
+  z_stream strm{};
+  if (inflateInit2(&strm, 15 + 16) != Z_OK) { return member; }
+  auto zerr = Z_OK;
+  while (zerr == Z_OK) {
+    if (strm.total_out == member.data.size()) {
+      member.data.resize(std::max<size_t>(member.data.size() * 2, 64 * 1024));
+    }
+    // avail_in and avail_out are 32-bit
+    strm.next_in = const_cast<Bytef*>(input.data() + strm.total_in);
+    strm.avail_in =
+      std::min<size_t>(input.size() - strm.total_in, std::numeric_limits<uInt>::max());
+    strm.next_out = member.data.data() + strm.total_out;
+    strm.avail_out =
+      std::min<size_t>(member.data.size() - strm.total_out, std::numeric_limits<uInt>::max());
+    // Returns Z_BUF_ERROR if the input ends before the end of the member
+    zerr = inflate(&strm, Z_NO_FLUSH);
+  }
+  member.is_valid  = zerr == Z_STREAM_END;
+  member.comp_size = strm.total_in;
+  member.data.resize(strm.total_out);
+  inflateEnd(&strm);
+  return member;
+}
+
+/**
+ * @brief Decompresses the members of a GZIP stream in parallel, in stream order
+ *
+ * The size of the members is not recorded, so the input is first scanned for data that looks like
+ * a member header. Members are then decompressed speculatively from these positions; false
+ * positives (headers found within the compressed data) are discarded because members are only
+ * accepted where the previous member ends. Data after the last member is ignored, as with the
+ * sequential decompressor.
+ */
+class gzip_member_decoder {
+ public:
+  explicit gzip_member_decoder(host_span<uint8_t const> input) : _input{input}
+  {
+    auto const num_segments =
+      (_input.size() + gzip_scan_segment_size - 1) / gzip_scan_segment_size;
+    std::vector<std::future<std::vector<size_t>>> tasks;
+    tasks.reserve(num_segments);
+    for (size_t i = 0; i < num_segments; ++i) {
+      auto const begin = i * gzip_scan_segment_size;
+      auto const end   = std::min(begin + gzip_scan_segment_size, _input.size());
+      tasks.emplace_back(submit_decompression_task([input = _input, begin, end]() {
+        std::vector<size_t> starts;
+        for (auto pos = begin; pos < end; ++pos) {
+          if (is_gzip_member_start(input, pos)) { starts.push_back(pos); }
+        }
+        return starts;
+      }));
+    }
+    for (auto& task : tasks) {
+      auto const starts = task.get();
+      _member_starts.insert(_member_starts.end(), starts.begin(), starts.end());
+    }
+    _is_done = _member_starts.empty() or _member_starts.front() != 0;
+    CUDF_EXPECTS(not _is_done, "Error in GZIP stream");
+  }
+
+  /**
+   * @brief Decompresses up to `max_members` candidate members, starting at the next member
+   *
+   * @return Decompressed members, in stream order; may hold fewer members than were decompressed
+   * if the candidates include false positives
+   */
+  std::vector<std::vector<uint8_t>> decode_next_members(size_t max_members)
+  {
+    CUDF_EXPECTS(not _is_done, "No GZIP members left to decompress");
+    auto const first =
+      std::lower_bound(_member_starts.cbegin(), _member_starts.cend(), _next_start);
+    auto const last = first + std::min<size_t>(max_members, _member_starts.cend() - first);
+
+    std::vector<std::future<inflated_gzip_member>> tasks;
+    tasks.reserve(last - first);
+    for (auto it = first; it != last; ++it) {
+      auto const start = *it;
+      auto const next  = std::next(it) == _member_starts.cend() ? _input.size() : *std::next(it);
+      // The last member records its size (modulo 2^32); assume ~4:1 compression otherwise
+      auto const comp_size = next - start;
+      auto const size_hint =
+        next == _input.size()
+          ? std::min<size_t>(read_gzip_isize(_input), comp_size * max_deflate_ratio)
+          : comp_size * 4 + 4096;
+      tasks.emplace_back(submit_decompression_task([input = _input, start, size_hint]() {
+        return inflate_gzip_member(input.subspan(start, input.size() - start), size_hint);
+      }));
+    }
+    // Wait for all the tasks before processing the results, as they read from the input
+    std::vector<inflated_gzip_member> members;
+    members.reserve(tasks.size());
+    std::transform(tasks.begin(), tasks.end(), std::back_inserter(members), [](auto& task) {
+      return task.get();
+    });
+
+    std::vector<std::vector<uint8_t>> output;
+    for (size_t i = 0; i < members.size() and not _is_done; ++i) {
+      // Skip the member headers found within the compressed data
+      if (first[i] != _next_start) { continue; }
+      CUDF_EXPECTS(members[i].is_valid, "Error in GZIP stream");
+      output.emplace_back(std::move(members[i].data));
+      _next_start += members[i].comp_size;
+      _is_done =
+        not std::binary_search(_member_starts.cbegin(), _member_starts.cend(), _next_start);
+    }
+    return output;
+  }
+
+  /**
+   * @brief Returns whether the last member of the stream has been decompressed
+   */
+  [[nodiscard]] bool is_done() const { return _is_done; }
+
+ private:
+  host_span<uint8_t const> _input;
+  std::vector<size_t> _member_starts;  // Offsets of the candidate member headers, in order
+  size_t _next_start = 0;
+  bool _is_done      = false;
+};
+
+/**
+ * @brief Decompresses GZIP data, decompressing its members in parallel
+ *
+ * The blocks of BGZF data record their compressed and decompressed sizes, so they are all
+ * decompressed concurrently into their place in the output. Other multi-member data is decompressed
+ * in batches of members.
+ */
+std::vector<uint8_t> decompress_gzip_members(host_span<uint8_t const> src)
+{
+  if (is_bgzf_block(src)) {
+    auto const [blocks, parsed_size] = parse_bgzf_blocks(src);
+    if (parsed_size == src.size()) {
+      std::vector<uint8_t> dst(bgzf_uncompressed_size(blocks));
+      inflate_bgzf_blocks(src, blocks, dst);
+      return dst;
+    }
+  }
+
+  gzip_member_decoder decoder(src);
+  auto const batch_size = 2 * host_decompression_pool().get_thread_count();
+  std::vector<std::vector<uint8_t>> members;
+  while (not decoder.is_done()) {
+    auto batch = decoder.decode_next_members(batch_size);
+    std::move(batch.begin(), batch.end(), std::back_inserter(members));
+  }
+  if (members.size() == 1) { return std::move(members.front()); }
+  auto const total_size = std::accumulate(
+    members.cbegin(), members.cend(), 0ul, [](auto sum, auto const& m) { return sum + m.size(); });
+  std::vector<uint8_t> dst(total_size);
+  size_t dst_ofs = 0;
+  for (auto const& member : members) {
+    std::memcpy(dst.data() + dst_ofs, member.data(), member.size());
+    dst_ofs += member.size();
+  }
+  return dst;
+}
+}  // namespace
+
 std::vector<uint8_t> decompress(compression_type compression, host_span<uint8_t const> src)
 {
   CUDF_EXPECTS(src.data() != nullptr, "Decompression: Source cannot be nullptr");
@@ -292,12 +851,7 @@ std::vector<uint8_t> decompress(compression_type compression, host_span<uint8_t
     case compression_type::AUTO:
     case compression_type::GZIP: {
       gz_archive_s gz;
-      if (ParseGZArchive(&gz, raw, src.size())) {
-        compression = compression_type::GZIP;
-        comp_data   = gz.comp_data;
-        comp_len    = gz.comp_len;
-        uncomp_len  = gz.isize;
-      }
+      if (ParseGZArchive(&gz, raw, src.size())) { return decompress_gzip_members(src); }
       if (compression != compression_type::AUTO) break;
       [[fallthrough]];
     }
@@ -353,49 +907,829 @@ std::vector<uint8_t> decompress(compression_type compression, host_span<uint8_t
       }
       if (compression != compression_type::AUTO) break;
       [[fallthrough]];
+    case compression_type::ZSTD:
+      if (is_zstd(src)) { return decompress_zstd_frames(src); }
+      if (compression != compression_type::AUTO) break;
+      [[fallthrough]];
+    case compression_type::LZ4:
+      if (is_lz4_frame(src)) { return decompress_as_stream(compression_type::LZ4, src); }
+      if (compression != compression_type::AUTO) break;
+      [[fallthrough]];
+    case compression_type::XZ:
+      if (is_xz(src)) { return decompress_as_stream(compression_type::XZ, src); }
+      // Raw DEFLATE cannot be detected, so `AUTO` fails if none of the formats above matched
+      break;
+    case compression_type::ZLIB:
+      // Raw DEFLATE data, as in the 4-argument overload; cannot be detected
+      comp_data = raw;
+      comp_len  = src.size();
+      break;
     default: CUDF_FAIL("Unsupported compressed stream type");
   }
 
   CUDF_EXPECTS(comp_data != nullptr and comp_len > 0, "Unsupported compressed stream type");
 
+  if (compression == compression_type::BZIP2) {
+    // Decode the blocks in parallel, appending each batch to the output as soon as it is decoded
+    // so that only one batch of blocks is held in addition to the output
+    bz2_block_decoder decoder({comp_data, comp_len});
+    auto const batch_size = 2 * host_decompression_pool().get_thread_count();
+    std::vector<uint8_t> dst;
+    dst.reserve(decoder.uncompressed_size_hint());
+    while (not decoder.is_done()) {
+      auto const batch = decoder.decode_next_blocks(batch_size);
+      for (auto const& block : batch) {
+        dst.insert(dst.end(), block.begin(), block.end());
+      }
+    }
+    return dst;
+  }
+
   if (uncomp_len <= 0) {
     uncomp_len = comp_len * 4 + 4096;  // In case uncompressed size isn't known in advance, assume
                                        // ~4:1 compression for initial size
   }
 
-  if (compression == compression_type::GZIP || compression == compression_type::ZIP) {
+  if (compression == compression_type::ZIP || compression == compression_type::ZLIB) {
     // INFLATE
     std::vector<uint8_t> dst(uncomp_len);
     cpu_inflate_vector(dst, comp_data, comp_len);
     return dst;
   }
-  if (compression == compression_type::BZIP2) {
-    size_t src_ofs = 0;
-    size_t dst_ofs = 0;
-    int bz_err     = 0;
-    std::vector<uint8_t> dst(uncomp_len);
-    do {
-      size_t dst_len = uncomp_len - dst_ofs;
-      bz_err = cpu_bz2_uncompress(comp_data, comp_len, dst.data() + dst_ofs, &dst_len, &src_ofs);
-      if (bz_err == BZ_OUTBUFF_FULL) {
-        // TBD: We could infer the compression ratio based on produced/consumed byte counts
-        // in order to minimize realloc events and over-allocation
-        dst_ofs = dst_len;
-        dst_len = uncomp_len + (uncomp_len / 2);
-        dst.resize(dst_len);
-        uncomp_len = dst_len;
-      } else if (bz_err == 0) {
-        uncomp_len = dst_len;
-        dst.resize(uncomp_len);
+
+  CUDF_FAIL("Unsupported compressed stream type");
+}
+
+namespace {
+
+// Size of the windows in which streaming decompressors read the compressed input
+constexpr size_t stream_input_window_size = 4 * 1024 * 1024;
+
+// Size of the batches of input in which BGZF blocks are decompressed in parallel when streaming;
+// BGZF blocks are at most 64KB
+constexpr size_t bgzf_stream_batch_size = 32 * 1024 * 1024;
+
+/**
+ * @brief Streaming DEFLATE decompressor, for raw DEFLATE (ZIP) and GZIP data
+ */
+class inflate_stream_decompressor : public host_stream_decompressor {
+ public:
+  /**
+   * @param source Compressed source
+   * @param offset Offset of the compressed data in the source
+   * @param size Size of the compressed data
+   * @param is_gzip Whether the data is a sequence of GZIP members rather than raw DEFLATE data
+   * @param size_hint Uncompressed size, if known
+   */
+  inflate_stream_decompressor(datasource& source,
+                              size_t offset,
+                              size_t size,
+                              bool is_gzip,
+                              std::optional<size_t> size_hint)
+    : _source{source},
+      _input_pos{offset},
+      _input_end{offset + size},
+      _is_gzip{is_gzip},
+      _size_hint{size_hint},
+      _input(stream_input_window_size)
+  {
+    // 15 + 16 for GZIP headers, -15 for raw data without GZIP headers
+    auto const zerr = inflateInit2(&_strm, is_gzip ? 15 + 16 : -15);
+    CUDF_EXPECTS(zerr == Z_OK, "Error in DEFLATE stream");
+  }
+
+  /**
+   * @param source Compressed GZIP source
+   * @param point Seek point to start decompressing from
+   */
+  inflate_stream_decompressor(datasource& source, seek_point const& point)
+    : _source{source},
+      _input_pos{point.compressed_offset - (point.bit_offset != 0 ? 1 : 0)},
+      _input_end{source.size()},
+      _is_gzip{true},
+      _size_hint{std::nullopt},
+      _input(stream_input_window_size),
+      _is_member_body{not point.window.empty()}
+  {
+    // Seek points within a member are in the middle of its DEFLATE data, past the GZIP header
+    auto zerr = inflateInit2(&_strm, _is_member_body ? -15 : 15 + 16);
+    CUDF_EXPECTS(zerr == Z_OK, "Error in DEFLATE stream");
+    if (point.bit_offset != 0) {
+      // The block starts in the middle of the previous byte
+      CUDF_EXPECTS(read_input(), "Error in DEFLATE stream: unexpected end of data");
+      auto const bits = point.bit_offset;
+      zerr            = inflatePrime(&_strm, bits, *_strm.next_in >> (8 - bits));
+      CUDF_EXPECTS(zerr == Z_OK, "Error in DEFLATE stream");
+      ++_strm.next_in;
+      --_strm.avail_in;
+    }
+    if (_is_member_body) {
+      zerr = inflateSetDictionary(&_strm, point.window.data(), point.window.size());
+      CUDF_EXPECTS(zerr == Z_OK, "Error in DEFLATE stream");
+    }
+  }
+
+  ~inflate_stream_decompressor() override { inflateEnd(&_strm); }
+
+  size_t decompress_next(host_span<uint8_t> dst) override
+  {
+    size_t num_written = 0;
+    while (not _is_done and num_written < dst.size()) {
+      if (_strm.avail_in == 0) {
+        CUDF_EXPECTS(read_input(), "Error in DEFLATE stream: unexpected end of data");
       }
-    } while (bz_err == BZ_OUTBUFF_FULL);
-    CUDF_EXPECTS(bz_err == 0, "Decompression: error in stream");
-    return dst;
+      // avail_out is 32-bit
+      auto const out_size =
+        std::min<size_t>(dst.size() - num_written, std::numeric_limits<uInt>::max());
+      _strm.next_out  = dst.data() + num_written;
+      _strm.avail_out = out_size;
+      auto const zerr = inflate(&_strm, Z_NO_FLUSH);
+      num_written += out_size - _strm.avail_out;
+      if (zerr == Z_STREAM_END) {
+        // Raw decompression does not consume the GZIP trailer
+        if (_is_member_body) { skip_input(gzip_trailer_size); }
+        if (has_next_member()) {
+          // Concatenated GZIP members decompress to the concatenation of their contents
+          auto const zerr = _is_member_body ? inflateReset2(&_strm, 15 + 16) : inflateReset(&_strm);
+          CUDF_EXPECTS(zerr == Z_OK, "Error in DEFLATE stream");
+          _is_member_body = false;
+        } else {
+          _is_done = true;
+        }
+      } else {
+        CUDF_EXPECTS(zerr == Z_OK or zerr == Z_BUF_ERROR, "Error in DEFLATE stream");
+      }
+    }
+    return num_written;
+  }
+
+  [[nodiscard]] bool is_done() const override { return _is_done; }
+
+  [[nodiscard]] std::optional<size_t> uncompressed_size_hint() const override
+  {
+    return _size_hint;
+  }
+
+ private:
+  /**
+   * @brief Reads the next window of compressed data, keeping the unconsumed input
+   *
+   * @return False if there is no more input to read
+   */
+  bool read_input()
+  {
+    if (_strm.avail_in != 0) { std::memmove(_input.data(), _strm.next_in, _strm.avail_in); }
+    auto const read_size = std::min(_input.size() - _strm.avail_in, _input_end - _input_pos);
+    if (read_size == 0) { return false; }
+    auto const num_read =
+      _source.host_read(_input_pos, read_size, _input.data() + _strm.avail_in);
+    CUDF_EXPECTS(num_read == read_size, "Unexpected end of compressed source");
+    _input_pos += read_size;
+    _strm.next_in = _input.data();
+    _strm.avail_in += read_size;
+    return true;
   }
 
+  /**
+   * @brief Skips the given number of bytes of compressed data
+   */
+  void skip_input(size_t size)
+  {
+    while (size > 0) {
+      if (_strm.avail_in == 0) {
+        CUDF_EXPECTS(read_input(), "Error in DEFLATE stream: unexpected end of data");
+      }
+      auto const skip_size = std::min<size_t>(size, _strm.avail_in);
+      _strm.next_in += skip_size;
+      _strm.avail_in -= skip_size;
+      size -= skip_size;
+    }
+  }
+
+  /**
+   * @brief Returns whether another GZIP member follows the one that was just decompressed
+   */
+  bool has_next_member()
+  {
+    if (not _is_gzip) { return false; }
+    if (_strm.avail_in < 2) { read_input(); }
+    return _strm.avail_in >= 2 and _strm.next_in[0] == 0x1f and _strm.next_in[1] == 0x8b;
+  }
+
+  datasource& _source;
+  size_t _input_pos;
+  size_t const _input_end;
+  bool const _is_gzip;
+  std::optional<size_t> const _size_hint;
+  std::vector<uint8_t> _input;
+  // Whether the current GZIP member is decompressed as raw DEFLATE data, from a seek point
+  bool _is_member_body = false;
+  z_stream _strm{};
+  bool _is_done = false;
+};
+
+/**
+ * @brief Streaming BZIP2 decompressor; decodes a batch of blocks in parallel at a time
+ */
+class bz2_stream_decompressor : public host_stream_decompressor {
+ public:
+  explicit bz2_stream_decompressor(std::vector<uint8_t>&& input)
+    : _input{std::move(input)},
+      _decoder{_input},
+      _batch_size{host_decompression_pool().get_thread_count()}
+  {
+  }
+
+  size_t decompress_next(host_span<uint8_t> dst) override
+  {
+    size_t num_written = 0;
+    while (num_written < dst.size()) {
+      if (_block_idx == _blocks.size()) {
+        if (_decoder.is_done()) { break; }
+        _blocks    = _decoder.decode_next_blocks(_batch_size);
+        _block_idx = 0;
+        _block_pos = 0;
+        continue;
+      }
+      auto const& block    = _blocks[_block_idx];
+      auto const copy_size = std::min(dst.size() - num_written, block.size() - _block_pos);
+      std::memcpy(dst.data() + num_written, block.data() + _block_pos, copy_size);
+      _block_pos += copy_size;
+      num_written += copy_size;
+      if (_block_pos == block.size()) {
+        ++_block_idx;
+        _block_pos = 0;
+      }
+    }
+    return num_written;
+  }
+
+  [[nodiscard]] bool is_done() const override
+  {
+    return _decoder.is_done() and _block_idx == _blocks.size();
+  }
+
+ private:
+  std::vector<uint8_t> _input;
+  bz2_block_decoder _decoder;
+  size_t const _batch_size;
+  std::vector<std::vector<uint8_t>> _blocks;  // Decompressed blocks of the current batch
+  size_t _block_idx = 0;
+  size_t _block_pos = 0;  // Position in the current block
+};
+
+/**
+ * @brief Streaming BGZF decompressor; decompresses the blocks of a batch of input in parallel
+ *
+ * GZIP members that are not BGZF blocks, and everything after them, are decompressed
+ * sequentially, as their sizes are not recorded.
+ */
+class bgzf_stream_decompressor : public host_stream_decompressor {
+ public:
+  explicit bgzf_stream_decompressor(datasource& source) : _source{source} {}
+
+  size_t decompress_next(host_span<uint8_t> dst) override
+  {
+    size_t num_written = 0;
+    while (num_written < dst.size()) {
+      if (_output_pos == _output.size()) {
+        if (_inflater != nullptr) {
+          auto const remaining = dst.subspan(num_written, dst.size() - num_written);
+          num_written += _inflater->decompress_next(remaining);
+          break;
+        }
+        if (_input_pos == _source.size()) { break; }
+        decompress_next_batch();
+        continue;
+      }
+      auto const copy_size = std::min(dst.size() - num_written, _output.size() - _output_pos);
+      std::memcpy(dst.data() + num_written, _output.data() + _output_pos, copy_size);
+      _output_pos += copy_size;
+      num_written += copy_size;
+    }
+    return num_written;
+  }
+
+  [[nodiscard]] bool is_done() const override
+  {
+    return _input_pos == _source.size() and _output_pos == _output.size() and
+           (_inflater == nullptr or _inflater->is_done());
+  }
+
+ private:
+  /**
+   * @brief Reads the next batch of input and decompresses the blocks it fully contains
+   */
+  void decompress_next_batch()
+  {
+    auto const read_size = std::min(bgzf_stream_batch_size, _source.size() - _input_pos);
+    _input.resize(read_size);
+    auto const num_read = _source.host_read(_input_pos, read_size, _input.data());
+    CUDF_EXPECTS(num_read == read_size, "Unexpected end of compressed source");
+    auto const [blocks, parsed_size] = parse_bgzf_blocks(_input);
+    _output.resize(bgzf_uncompressed_size(blocks));
+    _output_pos = 0;
+    if (parsed_size == 0) {
+      // Not a BGZF block, as blocks are much smaller than a batch
+      _inflater = std::make_unique<inflate_stream_decompressor>(
+        _source, _input_pos, _source.size() - _input_pos, true, std::nullopt);
+      _input_pos = _source.size();
+      return;
+    }
+    inflate_bgzf_blocks(_input, blocks, _output);
+    // The partial block at the end of the batch is read again with the next batch
+    _input_pos += parsed_size;
+  }
+
+  datasource& _source;
+  size_t _input_pos = 0;
+  std::vector<uint8_t> _input;
+  std::vector<uint8_t> _output;  // Decompressed blocks of the current batch
+  size_t _output_pos = 0;
+  // Decompresses the rest of the input once a GZIP member that is not a BGZF block is reached
+  std::unique_ptr<inflate_stream_decompressor> _inflater;
+};
+
+/**
+ * @brief Window of compressed input that is read from a source as it is consumed
+ */
+class stream_input_window {
+ public:
+  /**
+   * @param source Compressed source
+   * @param offset Offset in the source of the first byte to read
+   */
+  explicit stream_input_window(datasource& source, size_t offset = 0)
+    : _source{source},
+      _input_pos{offset},
+      _input_end{source.size()},
+      _input(stream_input_window_size)
+  {
+  }
+
+  /**
+   * @brief Returns the input that was read and not consumed yet
+   */
+  [[nodiscard]] host_span<uint8_t const> available() const
+  {
+    return {_input.data() + _begin, _end - _begin};
+  }
+
+  /**
+   * @brief Marks the first bytes of the available input as consumed
+   */
+  void consume(size_t size) { _begin += std::min(size, _end - _begin); }
+
+  /**
+   * @brief Reads the next window of compressed data, keeping the unconsumed input
+   *
+   * @return False if there is no more input to read
+   */
+  bool read()
+  {
+    auto const num_avail = _end - _begin;
+    if (num_avail != 0) { std::memmove(_input.data(), _input.data() + _begin, num_avail); }
+    _begin = 0;
+    _end   = num_avail;
+    auto const read_size = std::min(_input.size() - _end, _input_end - _input_pos);
+    if (read_size == 0) { return false; }
+    auto const num_read = _source.host_read(_input_pos, read_size, _input.data() + _end);
+    CUDF_EXPECTS(num_read == read_size, "Unexpected end of compressed source");
+    _input_pos += read_size;
+    _end += read_size;
+    return true;
+  }
+
+  /**
+   * @brief Returns whether all the input has been read and consumed
+   */
+  [[nodiscard]] bool is_exhausted() const { return _begin == _end and _input_pos == _input_end; }
+
+ private:
+  datasource& _source;
+  size_t _input_pos;
+  size_t const _input_end;
+  std::vector<uint8_t> _input;
+  size_t _begin = 0;  // Start of the unconsumed input in the window
+  size_t _end   = 0;  // End of the input in the window
+};
+
+/**
+ * @brief Streaming ZSTD decompressor; decompresses a sequence of frames
+ *
+ * Frames are decompressed sequentially, as the input is only read a window at a time; whole
+ * buffers are decompressed with `decompress`, which decompresses the frames in parallel.
+ */
+class zstd_stream_decompressor : public host_stream_decompressor {
+ public:
+  /**
+   * @param source Compressed source
+   * @param offset Offset of the first frame to decompress, e.g. from a seek index
+   */
+  explicit zstd_stream_decompressor(datasource& source, size_t offset = 0)
+    : _input{source, offset}, _dctx{ZSTD_createDCtx()}
+  {
+    CUDF_EXPECTS(_dctx != nullptr, "Error in ZSTD stream");
+    CUDF_EXPECTS(offset < source.size(), "Seek point is past the end of the source");
+    // The size of the first frame, if recorded in its header
+    std::array<uint8_t, zstd_max_frame_header_size> header{};
+    auto const header_size = source.host_read(
+      offset, std::min(header.size(), source.size() - offset), header.data());
+    auto const content_size = ZSTD_getFrameContentSize(header.data(), header_size);
+    if (content_size != ZSTD_CONTENTSIZE_UNKNOWN and content_size != ZSTD_CONTENTSIZE_ERROR) {
+      _size_hint = content_size;
+    }
+  }
+
+  ~zstd_stream_decompressor() override { ZSTD_freeDCtx(_dctx); }
+
+  size_t decompress_next(host_span<uint8_t> dst) override
+  {
+    ZSTD_outBuffer out{dst.data(), dst.size(), 0};
+    while (not _is_done and out.pos < out.size) {
+      if (_input.available().empty() and not _input.read() and _is_frame_end) {
+        _is_done = true;
+        break;
+      }
+      auto const avail = _input.available();
+      ZSTD_inBuffer in{avail.data(), avail.size(), 0};
+      auto const prev_out_pos = out.pos;
+      // Zero once a frame is fully decompressed and flushed
+      auto const ret = ZSTD_decompressStream(_dctx, &out, &in);
+      CUDF_EXPECTS(not ZSTD_isError(ret), "Error in ZSTD stream");
+      _input.consume(in.pos);
+      _is_frame_end = ret == 0;
+      if (_is_frame_end and _input.is_exhausted()) {
+        _is_done = true;
+      } else {
+        CUDF_EXPECTS(in.pos != 0 or out.pos != prev_out_pos,
+                     "Error in ZSTD stream: unexpected end of data");
+      }
+    }
+    return out.pos;
+  }
+
+  [[nodiscard]] bool is_done() const override { return _is_done; }
+
+  [[nodiscard]] std::optional<size_t> uncompressed_size_hint() const override
+  {
+    return _size_hint;
+  }
+
+ private:
+  stream_input_window _input;
+  ZSTD_DCtx* _dctx;
+  std::optional<size_t> _size_hint;
+  bool _is_frame_end = false;  // Whether the last decompressed frame was fully flushed
+  bool _is_done      = false;
+};
+
+/**
+ * @brief Streaming LZ4 frame format decompressor; decompresses a sequence of frames
+ */
+class lz4_stream_decompressor : public host_stream_decompressor {
+ public:
+  explicit lz4_stream_decompressor(datasource& source) : _input{source}
+  {
+    auto const err = LZ4F_createDecompressionContext(&_dctx, LZ4F_VERSION);
+    CUDF_EXPECTS(not LZ4F_isError(err), "Error in LZ4 stream");
+  }
+
+  ~lz4_stream_decompressor() override { LZ4F_freeDecompressionContext(_dctx); }
+
+  size_t decompress_next(host_span<uint8_t> dst) override
+  {
+    size_t num_written = 0;
+    while (not _is_done and num_written < dst.size()) {
+      if (_input.available().empty() and not _input.read() and _is_frame_end) {
+        _is_done = true;
+        break;
+      }
+      auto const avail = _input.available();
+      auto in_size     = avail.size();
+      auto out_size    = dst.size() - num_written;
+      // Zero once a frame is fully decompressed and flushed
+      auto const ret = LZ4F_decompress(
+        _dctx, dst.data() + num_written, &out_size, avail.data(), &in_size, nullptr);
+      CUDF_EXPECTS(not LZ4F_isError(ret), "Error in LZ4 stream");
+      _input.consume(in_size);
+      num_written += out_size;
+      _is_frame_end = ret == 0;
+      if (_is_frame_end and _input.is_exhausted()) {
+        _is_done = true;
+      } else {
+        CUDF_EXPECTS(in_size != 0 or out_size != 0, "Error in LZ4 stream: unexpected end of data");
+      }
+    }
+    return num_written;
+  }
+
+  [[nodiscard]] bool is_done() const override { return _is_done; }
+
+ private:
+  stream_input_window _input;
+  LZ4F_dctx* _dctx   = nullptr;
+  bool _is_frame_end = false;  // Whether the last decompressed frame was fully flushed
+  bool _is_done      = false;
+};
+
+/**
+ * @brief Streaming XZ decompressor; decompresses a sequence of XZ streams
+ */
+class xz_stream_decompressor : public host_stream_decompressor {
+ public:
+  explicit xz_stream_decompressor(datasource& source) : _input{source}
+  {
+    auto const err = lzma_stream_decoder(&_strm, UINT64_MAX, LZMA_CONCATENATED);
+    CUDF_EXPECTS(err == LZMA_OK, "Error in XZ stream");
+  }
+
+  ~xz_stream_decompressor() override { lzma_end(&_strm); }
+
+  size_t decompress_next(host_span<uint8_t> dst) override
+  {
+    _strm.next_out  = dst.data();
+    _strm.avail_out = dst.size();
+    while (not _is_done and _strm.avail_out != 0) {
+      if (_input.available().empty()) { _input.read(); }
+      auto const avail = _input.available();
+      _strm.next_in    = avail.data();
+      _strm.avail_in   = avail.size();
+      // The decoder only checks for the end of the last stream once told that the input ended
+      auto const action = _input.is_exhausted() ? LZMA_FINISH : LZMA_RUN;
+      auto const err    = lzma_code(&_strm, action);
+      _input.consume(avail.size() - _strm.avail_in);
+      if (err == LZMA_STREAM_END) {
+        _is_done = true;
+      } else {
+        CUDF_EXPECTS(err == LZMA_OK, "Error in XZ stream");
+      }
+    }
+    return dst.size() - _strm.avail_out;
+  }
+
+  [[nodiscard]] bool is_done() const override { return _is_done; }
+
+ private:
+  stream_input_window _input;
+  lzma_stream _strm = LZMA_STREAM_INIT;
+  bool _is_done     = false;
+};
+
+/**
+ * @brief Finds the compressed data of the first non-empty DEFLATE file in a ZIP archive
+ *
+ * Only reads the end of central directory, the central directory and the local file header from
+ * the source.
+ *
+ * @return Offset and size of the compressed data, and the uncompressed size, if found
+ */
+std::optional<std::tuple<size_t, size_t, size_t>> find_zip_file(datasource& source)
+{
+  auto const source_size = source.size();
+  if (source_size < sizeof(zip_eocd_s) + 2) { return std::nullopt; }
+  // The end of central directory is followed by a comment of up to 64KB
+  auto const tail_size = std::min(source_size, sizeof(zip_eocd_s) + 2 + 0xffff);
+  auto const tail_ofs  = source_size - tail_size;
+  auto const tail      = source.host_read(tail_ofs, tail_size);
+
+  zip_eocd_s const* eocd = nullptr;
+  for (ptrdiff_t i = tail_size - sizeof(zip_eocd_s) - 2; i >= 0 and eocd == nullptr; i--) {
+    auto const* candidate  = reinterpret_cast<zip_eocd_s const*>(tail->data() + i);
+    auto const comment_len = *reinterpret_cast<uint16_t const*>(candidate + 1);
+    if (candidate->sig == 0x0605'4b50 &&
+        candidate->disk_id == candidate->start_disk  // multi-file archives not supported
+        && candidate->num_entries == candidate->total_entries &&
+        candidate->cdir_size >= sizeof(zip_cdfh_s) * candidate->num_entries &&
+        candidate->cdir_offset + size_t{candidate->cdir_size} <= source_size &&
+        i + comment_len <= static_cast<ptrdiff_t>(tail_size)) {
+      eocd = candidate;
+    }
+  }
+  if (eocd == nullptr) { return std::nullopt; }
+
+  auto const cdir = source.host_read(eocd->cdir_offset, eocd->cdir_size);
+  size_t cdfh_ofs = 0;
+  for (int i = 0; i < eocd->num_entries; i++) {
+    if (cdfh_ofs + sizeof(zip_cdfh_s) > cdir->size()) { break; }
+    auto const* cdfh = reinterpret_cast<zip_cdfh_s const*>(cdir->data() + cdfh_ofs);
+    size_t const cdfh_len =
+      sizeof(zip_cdfh_s) + cdfh->fname_len + cdfh->extra_len + cdfh->comment_len;
+    if (cdfh_ofs + cdfh_len > cdir->size() || cdfh->sig != 0x0201'4b50) {
+      // Bad cdir
+      break;
+    }
+    // For now, only accept with non-zero file sizes and DEFLATE
+    if (cdfh->comp_method == 8 && cdfh->comp_size > 0 && cdfh->uncomp_size > 0 &&
+        cdfh->hdr_ofs + sizeof(zip_lfh_s) <= source_size) {
+      size_t const lfh_ofs = cdfh->hdr_ofs;
+      zip_lfh_s lfh;
+      source.host_read(lfh_ofs, sizeof(zip_lfh_s), reinterpret_cast<uint8_t*>(&lfh));
+      if (lfh.sig == 0x0403'4b50 && lfh.comp_method == 8 && lfh.comp_size > 0 &&
+          lfh.uncomp_size > 0) {
+        size_t const file_start = lfh_ofs + sizeof(zip_lfh_s) + lfh.fname_len + lfh.extra_len;
+        // Pick the first valid file of non-zero size (only 1 file expected in archive)
+        if (file_start + lfh.comp_size <= source_size) {
+          return std::tuple{file_start, size_t{lfh.comp_size}, size_t{lfh.uncomp_size}};
+        }
+      }
+    }
+    cdfh_ofs += cdfh_len;
+  }
+  return std::nullopt;
+}
+
+/**
+ * @brief Reads the contents of an uncompressed source, so that it can be read in chunks in the
+ * same way as compressed sources.
+ */
+class uncompressed_stream_reader : public host_stream_decompressor {
+ public:
+  explicit uncompressed_stream_reader(datasource& source) : _source{source} {}
+
+  size_t decompress_next(host_span<uint8_t> dst) override
+  {
+    auto const size = std::min(dst.size(), _source.size() - _offset);
+    if (size == 0) { return 0; }
+    CUDF_EXPECTS(_source.host_read(_offset, size, dst.data()) == size,
+                 "Unexpected discrepancy in bytes read.");
+    _offset += size;
+    return size;
+  }
+
+  [[nodiscard]] bool is_done() const override { return _offset >= _source.size(); }
+
+  [[nodiscard]] std::optional<size_t> uncompressed_size_hint() const override
+  {
+    return _source.size();
+  }
+
+ private:
+  datasource& _source;
+  size_t _offset = 0;
+};
+
+}  // namespace
+
+std::unique_ptr<host_stream_decompressor> make_host_stream_decompressor(
+  compression_type compression, datasource& source)
+{
+  auto const source_size = source.size();
+  CUDF_EXPECTS(source_size != 0, "Decompression: Source size cannot be 0");
+  if (compression == compression_type::NONE) {
+    return std::make_unique<uncompressed_stream_reader>(source);
+  }
+
+  // Large enough to identify BGZF data
+  std::array<uint8_t, bgzf_fixed_header_size + 2> header{};
+  source.host_read(0, std::min(header.size(), source_size), header.data());
+
+  switch (compression) {
+    case compression_type::AUTO:
+    case compression_type::GZIP: {
+      auto const fhdr = reinterpret_cast<gz_file_header_s const*>(header.data());
+      if (source_size >= sizeof(gz_file_header_s) + 8 && fhdr->id1 == 0x1f && fhdr->id2 == 0x8b &&
+          fhdr->comp_mthd == 8) {
+        if (is_bgzf_block(header)) { return std::make_unique<bgzf_stream_decompressor>(source); }
+        // The trailer of the (last) member holds the input size modulo 2^32
+        std::array<uint8_t, 4> isize{};
+        source.host_read(source_size - isize.size(), isize.size(), isize.data());
+        auto const size_hint = static_cast<size_t>(read_gzip_isize(isize));
+        return std::make_unique<inflate_stream_decompressor>(
+          source, 0, source_size, true, size_hint);
+      }
+      if (compression != compression_type::AUTO) break;
+      [[fallthrough]];
+    }
+    case compression_type::ZIP: {
+      if (auto const file = find_zip_file(source); file.has_value()) {
+        auto const [file_start, comp_size, uncomp_size] = file.value();
+        return std::make_unique<inflate_stream_decompressor>(
+          source, file_start, comp_size, false, uncomp_size);
+      }
+      if (compression != compression_type::AUTO) break;
+      [[fallthrough]];
+    }
+    case compression_type::BZIP2: {
+      auto const fhdr = reinterpret_cast<bz2_file_header_s const*>(header.data());
+      // Check for BZIP2 file signature "BZh1" to "BZh9"
+      if (source_size > 4 && fhdr->sig[0] == 'B' && fhdr->sig[1] == 'Z' && fhdr->sig[2] == 'h' &&
+          fhdr->blksz >= '1' && fhdr->blksz <= '9') {
+        std::vector<uint8_t> input(source_size);
+        source.host_read(0, source_size, input.data());
+        return std::make_unique<bz2_stream_decompressor>(std::move(input));
+      }
+      if (compression != compression_type::AUTO) break;
+      [[fallthrough]];
+    }
+    case compression_type::ZSTD:
+      if (is_zstd(header)) { return std::make_unique<zstd_stream_decompressor>(source); }
+      if (compression != compression_type::AUTO) break;
+      [[fallthrough]];
+    case compression_type::LZ4:
+      if (is_lz4_frame(header)) { return std::make_unique<lz4_stream_decompressor>(source); }
+      if (compression != compression_type::AUTO) break;
+      [[fallthrough]];
+    case compression_type::XZ:
+      if (is_xz(header)) { return std::make_unique<xz_stream_decompressor>(source); }
+      if (compression != compression_type::AUTO) break;
+      [[fallthrough]];
+    default: CUDF_FAIL("Unsupported compressed stream type");
+  }
   CUDF_FAIL("Unsupported compressed stream type");
 }
 
+std::vector<uint8_t> decompress_range(compression_type compression,
+                                      datasource& source,
+                                      size_t offset,
+                                      size_t size,
+                                      compressed_seek_index const* index)
+{
+  std::unique_ptr<host_stream_decompressor> decompressor;
+  size_t skip_size = offset;
+  if (index != nullptr) {
+    CUDF_EXPECTS(compression == compression_type::AUTO or compression == index->compression(),
+                 "Seek index does not match the compression type of the source");
+    auto const& point = index->find(offset);
+    switch (index->compression()) {
+      case compression_type::GZIP:
+        decompressor = std::make_unique<inflate_stream_decompressor>(source, point);
+        break;
+      case compression_type::ZSTD:
+        // ZSTD seek points are at the start of frames, which are independent
+        decompressor =
+          std::make_unique<zstd_stream_decompressor>(source, point.compressed_offset);
+        break;
+      default: CUDF_FAIL("Seek index is only supported for GZIP and ZSTD sources");
+    }
+    skip_size -= point.uncompressed_offset;
+    if (size == 0) {
+      size = index->uncompressed_size() - std::min<size_t>(index->uncompressed_size(), offset);
+    }
+  } else {
+    decompressor = make_host_stream_decompressor(compression, source);
+  }
+
+  // Decompress and discard the data between the start point and the range
+  std::vector<uint8_t> dst(std::min(skip_size, stream_input_window_size));
+  while (skip_size > 0 and not decompressor->is_done()) {
+    skip_size -= decompressor->decompress_next(
+      {dst.data(), std::min(skip_size, stream_input_window_size)});
+  }
+
+  if (size != 0) {
+    dst.resize(size);
+    dst.resize(decompressor->decompress_next(dst));
+    return dst;
+  }
+  // Size unknown, decompress until the end of the data; the size recorded in the compressed format
+  // usually lets small sources be decompressed into a single allocation
+  auto const size_hint = decompressor->uncompressed_size_hint();
+  auto const initial_size =
+    size_hint.has_value() ? size_hint.value() - std::min(size_hint.value(), offset) + 1
+                          : stream_input_window_size;
+  dst.clear();
+  while (not decompressor->is_done()) {
+    auto const dst_ofs = dst.size();
+    dst.resize(std::max(dst_ofs * 2, initial_size));
+    dst.resize(dst_ofs +
+               decompressor->decompress_next({dst.data() + dst_ofs, dst.size() - dst_ofs}));
+  }
+  return dst;
+}
+
+chunked_stream_decompressor::chunked_stream_decompressor(
+  std::unique_ptr<host_stream_decompressor> decompressor, size_t chunk_size)
+  : _decompressor{std::move(decompressor)},
+    _size_hint{_decompressor->uncompressed_size_hint()},
+    _buffers{cudf::detail::pinned_host_vector<uint8_t>(chunk_size),
+             cudf::detail::pinned_host_vector<uint8_t>(chunk_size)}
+{
+  decompress_next_async();
+}
+
+void chunked_stream_decompressor::decompress_next_async()
+{
+  _next_chunk = std::async(std::launch::async, [this, &buffer = _buffers[_next_buffer]] {
+    auto const size = _decompressor->decompress_next({buffer.data(), buffer.size()});
+    return std::pair{size, _decompressor->is_done()};
+  });
+}
+
+host_span<uint8_t const> chunked_stream_decompressor::next_chunk()
+{
+  if (_is_done) { return {}; }
+  auto const [size, is_done] = _next_chunk.get();
+  auto const& chunk          = _buffers[_next_buffer];
+  _is_done                   = is_done;
+  if (not _is_done) {
+    // Decompress the next chunk into the other buffer while this one is consumed
+    _next_buffer ^= 1;
+    decompress_next_async();
+  }
+  return {chunk.data(), size};
+}
+
 /**
  * @brief ZLIB host decompressor (no header)
  */
@@ -503,45 +1837,13 @@ size_t decompress_snappy(host_span<uint8_t const> src, host_span<uint8_t> dst)
 }
 
 /**
- * @brief ZSTD decompressor that uses nvcomp
+ * @brief ZSTD decompressor; decompresses on the host, without a round trip to the device
  */
-size_t decompress_zstd(host_span<uint8_t const> src,
-                       host_span<uint8_t> dst,
-                       rmm::cuda_stream_view stream)
-{
-  // Init device span of spans (source)
-  auto const d_src =
-    cudf::detail::make_device_uvector_async(src, stream, rmm::mr::get_current_device_resource());
-  auto hd_srcs = cudf::detail::hostdevice_vector<device_span<uint8_t const>>(1, stream);
-  hd_srcs[0]   = d_src;
-  hd_srcs.host_to_device_async(stream);
-
-  // Init device span of spans (temporary destination)
-  auto d_dst   = rmm::device_uvector<uint8_t>(dst.size(), stream);
-  auto hd_dsts = cudf::detail::hostdevice_vector<device_span<uint8_t>>(1, stream);
-  hd_dsts[0]   = d_dst;
-  hd_dsts.host_to_device_async(stream);
-
-  auto hd_stats = cudf::detail::hostdevice_vector<compression_result>(1, stream);
-  hd_stats[0]   = compression_result{0, compression_status::FAILURE};
-  hd_stats.host_to_device_async(stream);
-  auto const max_uncomp_page_size = dst.size();
-  nvcomp::batched_decompress(nvcomp::compression_type::ZSTD,
-                             hd_srcs,
-                             hd_dsts,
-                             hd_stats,
-                             max_uncomp_page_size,
-                             max_uncomp_page_size,
-                             stream);
-
-  hd_stats.device_to_host_sync(stream);
-  CUDF_EXPECTS(hd_stats[0].status == compression_status::SUCCESS, "ZSTD decompression failed");
-
-  // Copy temporary output to `dst`
-  CUDF_CUDA_TRY(cudaMemcpyAsync(
-    dst.data(), d_dst.data(), hd_stats[0].bytes_written, cudaMemcpyDefault, stream.value()));
-
-  return hd_stats[0].bytes_written;
+size_t decompress_zstd(host_span<uint8_t const> src, host_span<uint8_t> dst)
+{
+  auto const num_written = ZSTD_decompress(dst.data(), dst.size(), src.data(), src.size());
+  CUDF_EXPECTS(not ZSTD_isError(num_written), "ZSTD decompression failed");
+  return num_written;
 }
 
 size_t decompress(compression_type compression,
@@ -553,7 +1855,7 @@ size_t decompress(compression_type compression,
     case compression_type::GZIP: return decompress_gzip(src, dst);
     case compression_type::ZLIB: return decompress_zlib(src, dst);
     case compression_type::SNAPPY: return decompress_snappy(src, dst);
-    case compression_type::ZSTD: return decompress_zstd(src, dst, stream);
+    case compression_type::ZSTD: return decompress_zstd(src, dst);
     default: CUDF_FAIL("Unsupported compression type");
   }
 }
@@ -24,6 +24,7 @@
 
 #include <io/comp/io_uncomp.hpp>
 #include <io/utilities/column_buffer.hpp>
+#include <io/utilities/config_utils.hpp>
 #include <io/utilities/hostdevice_vector.hpp>
 #include <io/utilities/parsing_utils.cuh>
 
@@ -46,8 +47,10 @@
 
 #include <algorithm>
 #include <iostream>
+#include <limits>
 #include <memory>
 #include <numeric>
+#include <optional>
 #include <string>
 #include <tuple>
 #include <unordered_map>
@@ -195,6 +198,131 @@ void erase_except_last(C& container, rmm::cuda_stream_view stream)
   container.resize(1, stream);
 }
 
+constexpr size_t max_chunk_bytes = 64 * 1024 * 1024;  // 64MB
+
+/**
+ * @brief Returns the size of the chunks in which the input is read and parsed.
+ *
+ * `max_chunk_bytes` by default; LIBCUDF_CSV_CHUNK_SIZE sets a smaller size, so that tests can read
+ * small inputs in many chunks.
+ */
+size_t chunk_bytes()
+{
+  static auto const size =
+    std::clamp<size_t>(getenv_or<size_t>("LIBCUDF_CSV_CHUNK_SIZE", max_chunk_bytes),
+                       cudf::io::csv::gpu::rowofs_block_bytes,
+                       max_chunk_bytes);
+  return size;
+}
+
+/**
+ * @brief Returns the size of the UTF-8 BOM at the start of the data; zero if there is none.
+ */
+size_t utf8_bom_size(host_span<uint8_t const> data)
+{
+  uint8_t const UTF8_BOM[] = {0xEF, 0xBB, 0xBF};
+  return (data.size() > sizeof(UTF8_BOM) && memcmp(data.data(), UTF8_BOM, sizeof(UTF8_BOM)) == 0)
+           ? sizeof(UTF8_BOM)
+           : 0;
+}
+
+/**
+ * @brief Sequential reader of the input data, either from a host buffer or from the chunks of a
+ * source that is read, and decompressed if needed, on the fly.
+ *
+ * When reading a source in chunks, the next chunk is read in the background while the current one
+ * is processed, and host memory use is bounded by the chunk size. A UTF-8 BOM at the start of the
+ * source is skipped.
+ */
+class input_reader {
+ public:
+  /**
+   * @brief Constructor for reading a host buffer.
+   *
+   * @param data Input data
+   * @param chunk_size Size of the chunks in which the data is parsed
+   */
+  input_reader(host_span<char const> data, size_t chunk_size)
+    : _data{data}, _chunk_size{chunk_size}
+  {
+  }
+
+  /**
+   * @brief Constructor for reading a source in chunks.
+   *
+   * @param decompressor Reader of the (decompressed) contents of the source
+   * @param chunk_size Size of the chunks
+   */
+  input_reader(std::unique_ptr<host_stream_decompressor> decompressor, size_t chunk_size)
+    : _decompressor{
+        std::make_unique<chunked_stream_decompressor>(std::move(decompressor), chunk_size)},
+      _chunk_size{chunk_size}
+  {
+  }
+
+  /**
+   * @brief Returns the size of the chunks in which the input is read.
+   */
+  [[nodiscard]] size_t chunk_size() const { return _chunk_size; }
+
+  /**
+   * @brief Returns the input data in the [begin, end) range, truncated to the end of the input.
+   *
+   * Calls must read consecutive ranges of `chunk_size()` at most. Data read in chunks is only valid
+   * until the next call.
+   */
+  host_span<char const> read(size_t begin, size_t end)
+  {
+    if (_decompressor == nullptr) {
+      return _data.subspan(std::min(begin, _data.size()),
+                           std::min(end, _data.size()) - std::min(begin, _data.size()));
+    }
+    CUDF_EXPECTS(begin == _num_read and end - begin <= _chunk_size,
+                 "Chunked input must be read sequentially");
+    auto chunk = _decompressor->next_chunk();
+    if (_num_read == 0) {
+      auto const bom_size = utf8_bom_size(chunk);
+      chunk               = chunk.subspan(bom_size, chunk.size() - bom_size);
+    }
+    _num_read += chunk.size();
+    return {reinterpret_cast<char const*>(chunk.data()), chunk.size()};
+  }
+
+  /**
+   * @brief Returns the size of the input data, if known.
+   *
+   * The size of decompressed data is only known once all of it has been read.
+   */
+  [[nodiscard]] std::optional<size_t> size() const
+  {
+    if (_decompressor == nullptr) { return _data.size(); }
+    return _decompressor->is_done() ? std::optional{_num_read} : std::nullopt;
+  }
+
+  /**
+   * @brief Returns the expected size of the input data, for preallocation.
+   */
+  [[nodiscard]] size_t size_hint() const
+  {
+    if (_decompressor == nullptr) { return _data.size(); }
+    return std::max(_decompressor->uncompressed_size_hint().value_or(0), _num_read);
+  }
+
+  /**
+   * @brief Returns whether all of the input data before the given position has been read.
+   */
+  [[nodiscard]] bool is_done(size_t pos) const
+  {
+    return _decompressor == nullptr ? pos >= _data.size() : _decompressor->is_done();
+  }
+
+ private:
+  host_span<char const> _data;
+  std::unique_ptr<chunked_stream_decompressor> _decompressor;
+  size_t _chunk_size;
+  size_t _num_read = 0;
+};
+
 size_t find_first_row_start(char row_terminator, host_span<char const> data)
 {
   // For now, look for the first terminator (assume the first terminator isn't within a quote)
@@ -212,7 +340,7 @@ size_t find_first_row_start(char row_terminator, host_span<char const> data)
  * This function scans the input data to record the row offsets (relative to the start of the
  * input data). A row is actually the data/offset between two termination symbols.
  *
- * @param data Uncompressed input data in host memory
+ * @param input Input data, read in chunks
  * @param range_begin Only include rows starting after this position
  * @param range_end Only include rows starting before this position
  * @param skip_rows Number of rows to skip from the start
@@ -225,7 +353,7 @@ std::pair<rmm::device_uvector<char>, selected_rows_offsets> load_data_and_gather
   csv_reader_options const& reader_opts,
   parse_options const& parse_opts,
   std::vector<char>& header,
-  host_span<char const> data,
+  input_reader& input,
   size_t range_begin,
   size_t range_end,
   size_t skip_rows,
@@ -233,34 +361,44 @@ std::pair<rmm::device_uvector<char>, selected_rows_offsets> load_data_and_gather
   bool load_whole_file,
   rmm::cuda_stream_view stream)
 {
-  constexpr size_t max_chunk_bytes = 64 * 1024 * 1024;  // 64MB
-  size_t buffer_size               = std::min(max_chunk_bytes, data.size());
+  // Unknown until all decompressed data has been read
+  auto const max_data_size = input.size().value_or(std::numeric_limits<size_t>::max());
+  size_t buffer_size       = std::min(input.chunk_size(), max_data_size);
   size_t max_blocks =
     std::max<size_t>((buffer_size / cudf::io::csv::gpu::rowofs_block_bytes) + 1, 2);
   cudf::detail::hostdevice_vector<uint64_t> row_ctx(max_blocks, stream);
-  size_t buffer_pos  = std::min(range_begin - std::min(range_begin, sizeof(char)), data.size());
-  size_t pos         = std::min(range_begin, data.size());
+  size_t buffer_pos = std::min(range_begin - std::min(range_begin, sizeof(char)), max_data_size);
+  size_t pos        = std::min(range_begin, max_data_size);
   size_t header_rows = (reader_opts.get_header() >= 0) ? reader_opts.get_header() + 1 : 0;
   uint64_t ctx       = 0;
 
   // For compatibility with the previous parser, a row is considered in-range if the
   // previous row terminator is within the given range
-  range_end += (range_end < data.size());
+  range_end += (range_end < max_data_size);
 
   // Reserve memory by allocating and then resetting the size
   rmm::device_uvector<char> d_data{
-    (load_whole_file) ? data.size() : std::min(buffer_size * 2, data.size()), stream};
+    (load_whole_file) ? input.size_hint() : std::min(buffer_size * 2, input.size_hint()), stream};
   d_data.resize(0, stream);
   rmm::device_uvector<uint64_t> all_row_offsets{0, stream};
   do {
-    size_t target_pos = std::min(pos + max_chunk_bytes, data.size());
+    auto const previous_data_size = d_data.size();
+    auto const new_data = input.read(buffer_pos + previous_data_size, pos + input.chunk_size());
+    size_t target_pos = buffer_pos + previous_data_size + new_data.size();
     size_t chunk_size = target_pos - pos;
+    // Known at the end of the input; otherwise, the kernels only need it to be past the chunk
+    auto const data_size = input.size().value_or(target_pos + 1);
 
-    auto const previous_data_size = d_data.size();
-    d_data.resize(target_pos - buffer_pos, stream);
+    // Grow geometrically, as the size of decompressed data is not known in advance
+    auto const new_data_size = target_pos - buffer_pos;
+    if (new_data_size > d_data.capacity()) {
+      d_data.reserve(std::min(std::max(new_data_size, d_data.capacity() * 2), max_data_size),
+                     stream);
+    }
+    d_data.resize(new_data_size, stream);
     CUDF_CUDA_TRY(cudaMemcpyAsync(d_data.begin() + previous_data_size,
-                                  data.begin() + buffer_pos + previous_data_size,
-                                  target_pos - buffer_pos - previous_data_size,
+                                  new_data.data(),
+                                  new_data.size(),
                                   cudaMemcpyDefault,
                                   stream.value()));
 
@@ -273,7 +411,7 @@ std::pair<rmm::device_uvector<char>, selected_rows_offsets> load_data_and_gather
                                                                  chunk_size,
                                                                  pos,
                                                                  buffer_pos,
-                                                                 data.size(),
+                                                                 data_size,
                                                                  range_begin,
                                                                  range_end,
                                                                  skip_rows,
@@ -312,13 +450,13 @@ std::pair<rmm::device_uvector<char>, selected_rows_offsets> load_data_and_gather
                                              chunk_size,
                                              pos,
                                              buffer_pos,
-                                             data.size(),
+                                             data_size,
                                              range_begin,
                                              range_end,
                                              skip_rows,
                                              stream);
       // With byte range, we want to keep only one row out of the specified range
-      if (range_end < data.size()) {
+      if (range_end < data_size) {
         CUDF_CUDA_TRY(cudaMemcpyAsync(row_ctx.host_ptr(),
                                       row_ctx.device_ptr(),
                                       num_blocks * sizeof(uint64_t),
@@ -359,7 +497,7 @@ std::pair<rmm::device_uvector<char>, selected_rows_offsets> load_data_and_gather
       }
     }
     pos = target_pos;
-  } while (pos < data.size());
+  } while (not input.is_done(pos));
 
   auto const non_blank_row_offsets =
     io::csv::gpu::remove_blank_rows(parse_opts.view(), d_data, all_row_offsets, stream);
@@ -377,9 +515,16 @@ std::pair<rmm::device_uvector<char>, selected_rows_offsets> load_data_and_gather
 
     auto const header_start = buffer_pos + row_ctx[0];
     auto const header_end   = buffer_pos + row_ctx[1];
-    CUDF_EXPECTS(header_start <= header_end && header_end <= data.size(),
+    CUDF_EXPECTS(header_start <= header_end && header_end <= buffer_pos + d_data.size(),
                  "Invalid csv header location");
-    header.assign(data.begin() + header_start, data.begin() + header_end);
+    // The input data may not be in host memory anymore
+    header.resize(header_end - header_start);
+    CUDF_CUDA_TRY(cudaMemcpyAsync(header.data(),
+                                  d_data.data() + (header_start - buffer_pos),
+                                  header.size(),
+                                  cudaMemcpyDefault,
+                                  stream.value()));
+    stream.synchronize();
     if (header_rows > 0) { row_offsets.erase_first_n(header_rows); }
   }
   // Apply num_rows limit
@@ -403,59 +548,68 @@ std::pair<rmm::device_uvector<char>, selected_rows_offsets> select_data_and_row_
   auto skip_end_rows     = reader_opts.get_skipfooter();
   auto num_rows          = reader_opts.get_nrows();
 
-  if (range_offset > 0 || range_size > 0) {
-    CUDF_EXPECTS(reader_opts.get_compression() == compression_type::NONE,
-                 "Reading compressed data using `byte range` is unsupported");
-  }
-
   // Transfer source data to GPU
   if (!source->is_empty()) {
-    auto data_size = (range_size_padded != 0) ? range_size_padded : source->size();
-    auto buffer    = source->host_read(range_offset, data_size);
-
-    // check for and skip UTF-8 BOM
-    auto buffer_data         = buffer->data();
-    auto buffer_size         = buffer->size();
-    uint8_t const UTF8_BOM[] = {0xEF, 0xBB, 0xBF};
-    if (buffer_size > sizeof(UTF8_BOM) && memcmp(buffer_data, UTF8_BOM, sizeof(UTF8_BOM)) == 0) {
-      buffer_data += sizeof(UTF8_BOM);
-      buffer_size -= sizeof(UTF8_BOM);
-    }
-
-    auto h_data = host_span<char const>(reinterpret_cast<char const*>(buffer_data), buffer_size);
-
-    std::vector<uint8_t> h_uncomp_data_owner;
-
-    if (reader_opts.get_compression() != compression_type::NONE) {
-      h_uncomp_data_owner =
-        decompress(reader_opts.get_compression(), {buffer->data(), buffer->size()});
-      h_data = {reinterpret_cast<char const*>(h_uncomp_data_owner.data()),
-                h_uncomp_data_owner.size()};
-    }
     // None of the parameters for row selection is used, we are parsing the entire file
     bool const load_whole_file = range_offset == 0 && range_size == 0 && skip_rows <= 0 &&
                                  skip_end_rows <= 0 && num_rows == -1;
 
-    // With byte range, find the start of the first data row
-    size_t const data_start_offset =
-      (range_offset != 0) ? find_first_row_start(parse_opts.terminator, h_data) : 0;
-
     // TODO: Allow parsing the header outside the mapped range
     CUDF_EXPECTS((range_offset == 0 || reader_opts.get_header() < 0),
                  "byte_range offset with header not supported");
 
+    std::unique_ptr<datasource::buffer> buffer;
+    std::optional<input_reader> input;
+    size_t data_start_offset = 0;
+    size_t data_end_offset   = std::numeric_limits<size_t>::max();
+    auto const is_compressed = reader_opts.get_compression() != compression_type::NONE;
+    auto const chunk_size    = chunk_bytes();
+    if (range_offset == 0 and range_size == 0 and
+        (is_compressed or source->size() > chunk_size)) {
+      // Read (and decompress) the source in chunks while gathering the row offsets, so that the
+      // next chunk is read in the background while the current one is parsed, and the whole input
+      // is never held in host memory. Uncompressed sources that fit in a single chunk are read at
+      // once, as there is no parsing to overlap with.
+      input.emplace(make_host_stream_decompressor(reader_opts.get_compression(), *source),
+                    chunk_size);
+    } else {
+      if (is_compressed) {
+        // Byte range in the decompressed data; only the range is kept in host memory
+        buffer = datasource::buffer::create(decompress_range(reader_opts.get_compression(),
+                                                             *source,
+                                                             range_offset,
+                                                             range_size_padded,
+                                                             reader_opts.get_seek_index().get()));
+      } else {
+        auto data_size = (range_size_padded != 0) ? range_size_padded : source->size();
+        buffer         = source->host_read(range_offset, data_size);
+      }
+
+      // check for and skip UTF-8 BOM
+      auto const bom_size = utf8_bom_size({buffer->data(), buffer->size()});
+      auto buffer_data    = buffer->data() + bom_size;
+      auto buffer_size    = buffer->size() - bom_size;
+
+      auto h_data = host_span<char const>(reinterpret_cast<char const*>(buffer_data), buffer_size);
+      input.emplace(h_data, chunk_size);
+
+      // With byte range, find the start of the first data row
+      data_start_offset =
+        (range_offset != 0) ? find_first_row_start(parse_opts.terminator, h_data) : 0;
+      data_end_offset = (range_size) ? range_size : h_data.size();
+    }
+
     // Gather row offsets
-    auto data_row_offsets =
-      load_data_and_gather_row_offsets(reader_opts,
-                                       parse_opts,
-                                       header,
-                                       h_data,
-                                       data_start_offset,
-                                       (range_size) ? range_size : h_data.size(),
-                                       (skip_rows > 0) ? skip_rows : 0,
-                                       num_rows,
-                                       load_whole_file,
-                                       stream);
+    auto data_row_offsets = load_data_and_gather_row_offsets(reader_opts,
+                                                             parse_opts,
+                                                             header,
+                                                             *input,
+                                                             data_start_offset,
+                                                             data_end_offset,
+                                                             (skip_rows > 0) ? skip_rows : 0,
+                                                             num_rows,
+                                                             load_whole_file,
+                                                             stream);
     auto& row_offsets = data_row_offsets.second;
     // Exclude the rows that are to be skipped from the end
     if (skip_end_rows > 0 && static_cast<size_t>(skip_end_rows) < row_offsets.size()) {
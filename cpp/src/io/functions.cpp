@@ -14,7 +14,9 @@
  * limitations under the License.
  */
 
+#include <io/comp/io_uncomp.hpp>
 #include <io/orc/orc.hpp>
+#include <io/parquet/dataset_metadata.hpp>
 
 #include <cudf/detail/iterator.cuh>
 #include <cudf/detail/nvtx/ranges.hpp>
@@ -26,17 +28,21 @@
 #include <cudf/io/detail/csv.hpp>
 #include <cudf/io/detail/json.hpp>
 #include <cudf/io/detail/orc.hpp>
+#include <cudf/io/detail/packed.hpp>
 #include <cudf/io/detail/parquet.hpp>
 #include <cudf/io/json.hpp>
 #include <cudf/io/orc.hpp>
 #include <cudf/io/orc_metadata.hpp>
+#include <cudf/io/packed.hpp>
 #include <cudf/io/parquet.hpp>
 #include <cudf/io/parquet_metadata.hpp>
+#include <cudf/io/seek_index.hpp>
 #include <cudf/table/table.hpp>
 #include <cudf/utilities/default_stream.hpp>
 #include <cudf/utilities/error.hpp>
 
 #include <algorithm>
+#include <mutex>
 
 namespace cudf {
 namespace io {
@@ -171,6 +177,48 @@ table_with_metadata read_avro(avro_reader_options const& options,
   return avro::read_avro(std::move(datasources[0]), options, cudf::get_default_stream(), mr);
 }
 
+/**
+ * @copydoc cudf::io::chunked_avro_reader::chunked_avro_reader
+ */
+chunked_avro_reader::chunked_avro_reader(std::size_t chunk_read_limit,
+                                         avro_reader_options const& options,
+                                         rmm::mr::device_memory_resource* mr)
+{
+  namespace avro = cudf::io::detail::avro;
+
+  auto datasources = make_datasources(options.get_source());
+
+  CUDF_EXPECTS(datasources.size() == 1, "Only a single source is currently supported.");
+
+  reader = std::make_unique<avro::chunked_reader>(
+    chunk_read_limit, std::move(datasources[0]), options, cudf::get_default_stream(), mr);
+}
+
+/**
+ * @copydoc cudf::io::chunked_avro_reader::~chunked_avro_reader
+ */
+chunked_avro_reader::~chunked_avro_reader() = default;
+
+/**
+ * @copydoc cudf::io::chunked_avro_reader::has_next
+ */
+bool chunked_avro_reader::has_next() const
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(reader != nullptr, "Reader has not been constructed properly.");
+  return reader->has_next();
+}
+
+/**
+ * @copydoc cudf::io::chunked_avro_reader::read_chunk
+ */
+table_with_metadata chunked_avro_reader::read_chunk() const
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(reader != nullptr, "Reader has not been constructed properly.");
+  return reader->read_chunk();
+}
+
 compression_type infer_compression_type(compression_type compression, source_info const& info)
 {
   if (compression != compression_type::AUTO) { return compression; }
@@ -196,6 +244,8 @@ compression_type infer_compression_type(compression_type compression, source_inf
   if (ext == "zip") { return compression_type::ZIP; }
   if (ext == "bz2") { return compression_type::BZIP2; }
   if (ext == "xz") { return compression_type::XZ; }
+  if (ext == "zst") { return compression_type::ZSTD; }
+  if (ext == "lz4") { return compression_type::LZ4; }
 
   return compression_type::NONE;
 }
@@ -206,9 +256,12 @@ table_with_metadata read_json(json_reader_options options, rmm::mr::device_memor
 
   options.set_compression(infer_compression_type(options.get_compression(), options.get_source()));
 
-  auto datasources = make_datasources(options.get_source(),
-                                      options.get_byte_range_offset(),
-                                      options.get_byte_range_size_with_padding());
+  // The byte range of compressed sources is in the decompressed data
+  auto const is_compressed = options.get_compression() != compression_type::NONE;
+  auto datasources =
+    make_datasources(options.get_source(),
+                     is_compressed ? 0 : options.get_byte_range_offset(),
+                     is_compressed ? 0 : options.get_byte_range_size_with_padding());
 
   return json::detail::read_json(datasources, options, cudf::get_default_stream(), mr);
 }
@@ -232,9 +285,12 @@ table_with_metadata read_csv(csv_reader_options options, rmm::mr::device_memory_
 
   options.set_compression(infer_compression_type(options.get_compression(), options.get_source()));
 
-  auto datasources = make_datasources(options.get_source(),
-                                      options.get_byte_range_offset(),
-                                      options.get_byte_range_size_with_padding());
+  // The byte range of compressed sources is in the decompressed data
+  auto const is_compressed = options.get_compression() != compression_type::NONE;
+  auto datasources =
+    make_datasources(options.get_source(),
+                     is_compressed ? 0 : options.get_byte_range_offset(),
+                     is_compressed ? 0 : options.get_byte_range_size_with_padding());
 
   CUDF_EXPECTS(datasources.size() == 1, "Only a single source is currently supported.");
 
@@ -262,6 +318,41 @@ void write_csv(csv_writer_options const& options, rmm::mr::device_memory_resourc
     mr);
 }
 
+compressed_seek_index build_seek_index(source_info const& info,
+                                       compression_type compression,
+                                       std::size_t spacing)
+{
+  CUDF_FUNC_RANGE();
+
+  CUDF_EXPECTS(compression == compression_type::AUTO or compression == compression_type::GZIP or
+                 compression == compression_type::ZSTD,
+               "Seek indexes are only supported for GZIP and ZSTD sources");
+
+  auto datasources = make_datasources(info);
+  CUDF_EXPECTS(datasources.size() == 1, "Only a single source is currently supported.");
+
+  return build_seek_index(*datasources[0], compression, spacing);
+}
+
+void write_seek_index(compressed_seek_index const& index, sink_info const& sink)
+{
+  auto sinks = make_datasinks(sink);
+  CUDF_EXPECTS(sinks.size() == 1, "Multiple sinks not supported for seek index writing");
+
+  auto const data = index.serialize();
+  sinks[0]->host_write(data.data(), data.size());
+  sinks[0]->flush();
+}
+
+compressed_seek_index read_seek_index(source_info const& info)
+{
+  auto datasources = make_datasources(info);
+  CUDF_EXPECTS(datasources.size() == 1, "Only a single source is currently supported.");
+
+  auto const buffer = datasources[0]->host_read(0, datasources[0]->size());
+  return compressed_seek_index::deserialize({buffer->data(), buffer->size()});
+}
+
 namespace detail_orc = cudf::io::detail::orc;
 
 raw_orc_statistics read_raw_orc_statistics(source_info const& src_info)
@@ -416,6 +507,59 @@ table_with_metadata read_orc(orc_reader_options const& options, rmm::mr::device_
   return reader->read(options);
 }
 
+/**
+ * @copydoc cudf::io::chunked_orc_reader::chunked_orc_reader(std::size_t, orc_reader_options
+ * const&, rmm::mr::device_memory_resource*)
+ */
+chunked_orc_reader::chunked_orc_reader(std::size_t chunk_read_limit,
+                                       orc_reader_options const& options,
+                                       rmm::mr::device_memory_resource* mr)
+  : chunked_orc_reader(chunk_read_limit, 0, options, mr)
+{
+}
+
+/**
+ * @copydoc cudf::io::chunked_orc_reader::chunked_orc_reader(std::size_t, std::size_t,
+ * orc_reader_options const&, rmm::mr::device_memory_resource*)
+ */
+chunked_orc_reader::chunked_orc_reader(std::size_t chunk_read_limit,
+                                       std::size_t pass_read_limit,
+                                       orc_reader_options const& options,
+                                       rmm::mr::device_memory_resource* mr)
+  : reader{std::make_unique<detail_orc::chunked_reader>(chunk_read_limit,
+                                                        pass_read_limit,
+                                                        make_datasources(options.get_source()),
+                                                        options,
+                                                        cudf::get_default_stream(),
+                                                        mr)}
+{
+}
+
+/**
+ * @copydoc cudf::io::chunked_orc_reader::~chunked_orc_reader
+ */
+chunked_orc_reader::~chunked_orc_reader() = default;
+
+/**
+ * @copydoc cudf::io::chunked_orc_reader::has_next
+ */
+bool chunked_orc_reader::has_next() const
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(reader != nullptr, "Reader has not been constructed properly.");
+  return reader->has_next();
+}
+
+/**
+ * @copydoc cudf::io::chunked_orc_reader::read_chunk
+ */
+table_with_metadata chunked_orc_reader::read_chunk() const
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(reader != nullptr, "Reader has not been constructed properly.");
+  return reader->read_chunk();
+}
+
 /**
  * @copydoc cudf::io::write_orc
  */
@@ -485,6 +629,188 @@ table_with_metadata read_parquet(parquet_reader_options const& options,
   return reader->read(options);
 }
 
+namespace {
+
+/**
+ * @brief Source of a file that is opened on its first access, so that the files of a dataset
+ * that hold no row groups to read are never opened.
+ */
+class deferred_file_source : public datasource {
+ public:
+  explicit deferred_file_source(std::string path) : _path{std::move(path)} {}
+
+  std::unique_ptr<buffer> host_read(size_t offset, size_t size) override
+  {
+    return source().host_read(offset, size);
+  }
+
+  size_t host_read(size_t offset, size_t size, uint8_t* dst) override
+  {
+    return source().host_read(offset, size, dst);
+  }
+
+  std::vector<std::unique_ptr<buffer>> host_read_ranges(host_span<range const> ranges) override
+  {
+    return source().host_read_ranges(ranges);
+  }
+
+  [[nodiscard]] bool supports_host_read_async() const override
+  {
+    return source().supports_host_read_async();
+  }
+
+  std::future<size_t> host_read_async(size_t offset, size_t size, uint8_t* dst) override
+  {
+    return source().host_read_async(offset, size, dst);
+  }
+
+  [[nodiscard]] bool supports_device_read() const override
+  {
+    return source().supports_device_read();
+  }
+
+  [[nodiscard]] bool is_device_read_preferred(size_t size) const override
+  {
+    return source().is_device_read_preferred(size);
+  }
+
+  std::unique_ptr<buffer> device_read(size_t offset,
+                                      size_t size,
+                                      rmm::cuda_stream_view stream) override
+  {
+    return source().device_read(offset, size, stream);
+  }
+
+  size_t device_read(size_t offset,
+                     size_t size,
+                     uint8_t* dst,
+                     rmm::cuda_stream_view stream) override
+  {
+    return source().device_read(offset, size, dst, stream);
+  }
+
+  std::future<size_t> device_read_async(size_t offset,
+                                        size_t size,
+                                        uint8_t* dst,
+                                        rmm::cuda_stream_view stream) override
+  {
+    return source().device_read_async(offset, size, dst, stream);
+  }
+
+  [[nodiscard]] size_t size() const override { return source().size(); }
+
+  [[nodiscard]] std::optional<source_identity> identity() const override
+  {
+    return source().identity();
+  }
+
+ private:
+  [[nodiscard]] datasource& source() const
+  {
+    std::call_once(_opened, [this] { _source = datasource::create(_path); });
+    return *_source;
+  }
+
+  std::string _path;
+  mutable std::once_flag _opened;
+  mutable std::unique_ptr<datasource> _source;
+};
+
+/**
+ * @brief Returns the path of a file of a dataset, resolved against the dataset directory.
+ */
+std::string dataset_file_path(std::string const& dataset_path, std::string const& file_path)
+{
+  if (dataset_path.empty() or (not file_path.empty() and file_path.front() == '/')) {
+    return file_path;
+  }
+  return dataset_path.back() == '/' ? dataset_path + file_path : dataset_path + '/' + file_path;
+}
+
+}  // namespace
+
+table_with_metadata read_parquet_dataset(parquet_dataset_metadata const& dataset,
+                                         std::string const& dataset_path,
+                                         parquet_reader_options const& options,
+                                         rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+
+  auto const& files = dataset.files();
+  CUDF_EXPECTS(not files.empty(), "The dataset has no files");
+
+  // Select the files that hold the row groups, or the rows, to read; the row selection of the
+  // options is translated to the selected files
+  auto file_options = options;
+  std::vector<size_type> file_indices;
+  if (auto const& row_groups = options.get_row_groups(); not row_groups.empty()) {
+    CUDF_EXPECTS(row_groups.size() == files.size(),
+                 "The row groups must be given for each file of the dataset");
+    std::vector<std::vector<size_type>> file_row_groups;
+    for (size_t file_idx = 0; file_idx < files.size(); ++file_idx) {
+      if (row_groups[file_idx].empty()) { continue; }
+      file_indices.push_back(static_cast<size_type>(file_idx));
+      file_row_groups.push_back(row_groups[file_idx]);
+    }
+    if (file_indices.empty()) {
+      // Read no row groups of the first file, to get the schema of the dataset
+      file_indices.push_back(0);
+      file_row_groups.emplace_back();
+    }
+    file_options.set_row_groups(std::move(file_row_groups));
+  } else {
+    auto const skip_rows     = options.get_skip_rows();
+    auto const& num_rows     = options.get_num_rows();
+    int64_t file_start       = 0;
+    int64_t first_file_start = 0;
+    for (size_t file_idx = 0; file_idx < files.size(); ++file_idx) {
+      auto const file_end = file_start + files[file_idx].num_rows;
+      if (file_end > skip_rows and
+          (not num_rows.has_value() or file_start < skip_rows + num_rows.value())) {
+        if (file_indices.empty()) { first_file_start = file_start; }
+        file_indices.push_back(static_cast<size_type>(file_idx));
+      }
+      file_start = file_end;
+    }
+    if (file_indices.empty()) {
+      // Skip all rows of the first file, to get the schema of the dataset
+      file_indices.push_back(0);
+      file_options.set_skip_rows(files.front().num_rows);
+    } else {
+      file_options.set_skip_rows(skip_rows - first_file_start);
+    }
+  }
+
+  std::vector<std::unique_ptr<datasource>> datasources;
+  datasources.reserve(file_indices.size());
+  for (auto const file_idx : file_indices) {
+    auto const path = dataset_file_path(dataset_path, files[file_idx].path);
+    datasources.push_back(std::make_unique<deferred_file_source>(path));
+  }
+  auto reader = std::make_unique<detail_parquet::reader>(
+    std::move(datasources), dataset, file_indices, file_options, cudf::get_default_stream(), mr);
+
+  return reader->read(file_options);
+}
+
+table_with_metadata read_parquet_dataset(parquet_reader_options const& options,
+                                         rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+
+  auto const& source = options.get_source();
+  CUDF_EXPECTS(source.type() == io_type::FILEPATH and source.filepaths().size() == 1,
+               "The source must be the path of the _metadata file of the dataset");
+
+  // The paths of the files are relative to the directory of the `_metadata` file
+  auto const& summary_path = source.filepaths().front();
+  auto const separator     = summary_path.find_last_of('/');
+  auto const dataset_path  = separator == std::string::npos ? std::string{}
+                                                            : summary_path.substr(0, separator + 1);
+
+  return read_parquet_dataset(parquet_dataset_metadata(source), dataset_path, options, mr);
+}
+
 parquet_metadata read_parquet_metadata(source_info const& src_info)
 {
   CUDF_FUNC_RANGE();
@@ -493,6 +819,68 @@ parquet_metadata read_parquet_metadata(source_info const& src_info)
   return detail_parquet::read_parquet_metadata(datasources);
 }
 
+parquet_dataset_metadata::parquet_dataset_metadata()
+  : _impl{std::make_unique<detail_parquet::dataset_metadata>()}
+{
+}
+
+parquet_dataset_metadata::parquet_dataset_metadata(source_info const& summary)
+{
+  CUDF_FUNC_RANGE();
+
+  auto datasources = make_datasources(summary);
+  CUDF_EXPECTS(datasources.size() == 1, "Only a single source is currently supported.");
+  _impl = std::make_unique<detail_parquet::dataset_metadata>(*datasources[0]);
+}
+
+parquet_dataset_metadata::~parquet_dataset_metadata() = default;
+
+parquet_dataset_metadata::parquet_dataset_metadata(parquet_dataset_metadata&&) noexcept = default;
+
+parquet_dataset_metadata& parquet_dataset_metadata::operator=(parquet_dataset_metadata&&) noexcept =
+  default;
+
+void parquet_dataset_metadata::append_file_metadata(std::string const& file_path,
+                                                    host_span<uint8_t const> file_metadata)
+{
+  CUDF_FUNC_RANGE();
+  _impl->append_file_metadata(file_path, file_metadata);
+}
+
+void parquet_dataset_metadata::append_file(std::string const& file_path, source_info const& file)
+{
+  CUDF_FUNC_RANGE();
+
+  auto datasources = make_datasources(file);
+  CUDF_EXPECTS(datasources.size() == 1, "Only a single source is currently supported.");
+  _impl->append_file(file_path, *datasources[0]);
+}
+
+int64_t parquet_dataset_metadata::num_rows() const { return _impl->num_rows(); }
+
+std::vector<parquet_dataset_file> const& parquet_dataset_metadata::files() const
+{
+  return _impl->files();
+}
+
+void parquet_dataset_metadata::write_metadata(sink_info const& sink) const
+{
+  CUDF_FUNC_RANGE();
+
+  auto sinks = make_datasinks(sink);
+  CUDF_EXPECTS(sinks.size() == 1, "Only a single sink is currently supported.");
+  _impl->write_metadata(*sinks[0]);
+}
+
+void parquet_dataset_metadata::write_common_metadata(sink_info const& sink) const
+{
+  CUDF_FUNC_RANGE();
+
+  auto sinks = make_datasinks(sink);
+  CUDF_EXPECTS(sinks.size() == 1, "Only a single sink is currently supported.");
+  _impl->write_common_metadata(*sinks[0]);
+}
+
 /**
  * @copydoc cudf::io::merge_row_group_metadata
  */
@@ -838,5 +1226,27 @@ chunked_parquet_writer_options_builder::max_page_fragment_size(size_type val)
   return *this;
 }
 
+void write_packed(table_view const& input,
+                  sink_info const& sink,
+                  std::size_t bounce_buffer_size,
+                  rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+
+  auto sinks = make_datasinks(sink);
+  CUDF_EXPECTS(sinks.size() == 1, "Only a single sink is currently supported.");
+  detail::packed::write_packed(
+    input, *sinks[0], bounce_buffer_size, cudf::get_default_stream(), mr);
+}
+
+packed_columns read_packed(source_info const& source, rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+
+  auto datasources = make_datasources(source);
+  CUDF_EXPECTS(datasources.size() == 1, "Only a single source is currently supported.");
+  return detail::packed::read_packed(*datasources[0], cudf::get_default_stream(), mr);
+}
+
 }  // namespace io
 }  // namespace cudf
@@ -29,10 +29,17 @@
 #include <thrust/iterator/constant_iterator.h>
 #include <thrust/scatter.h>
 
+#include <algorithm>
+#include <cstring>
+#include <future>
+#include <limits>
 #include <numeric>
 
 namespace cudf::io::json::detail {
 
+// Size of the chunks in which compressed sources are decompressed
+constexpr size_t decompression_chunk_size = 64 * 1024 * 1024;  // 64MB
+
 size_t sources_size(host_span<std::unique_ptr<datasource>> const sources,
                     size_t range_offset,
                     size_t range_size)
@@ -47,6 +54,7 @@ size_t sources_size(host_span<std::unique_ptr<datasource>> const sources,
 
 rmm::device_uvector<char> ingest_raw_input(host_span<std::unique_ptr<datasource>> sources,
                                            compression_type compression,
+                                           compressed_seek_index const* seek_index,
                                            size_t range_offset,
                                            size_t range_size,
                                            rmm::cuda_stream_view stream)
@@ -105,16 +113,87 @@ rmm::device_uvector<char> ingest_raw_input(host_span<std::unique_ptr<datasource>
     stream.synchronize();
     return d_buffer;
 
-  } else {
-    auto buffer = std::vector<uint8_t>(total_source_size);
-    // Single read because only a single compressed source is supported
-    // Reading to host because decompression of a single block is much faster on the CPU
-    sources[0]->host_read(range_offset, total_source_size, buffer.data());
-    auto const uncomp_data = decompress(compression, buffer);
+  } else if (range_offset != 0 or range_size != 0) {
+    // Byte ranges are only supported for a single source
+    // Byte range in the decompressed data; only the range is kept in host memory
+    auto const uncomp_data =
+      decompress_range(compression, *sources[0], range_offset, range_size, seek_index);
     return cudf::detail::make_device_uvector_sync(
       host_span<char const>{reinterpret_cast<char const*>(uncomp_data.data()), uncomp_data.size()},
       stream,
       rmm::mr::get_current_device_resource());
+  } else if (sources.size() > 1) {
+    // Decompress the sources concurrently on the host; the decompressed size of each source is
+    // only known once it is decompressed
+    std::vector<std::future<std::vector<uint8_t>>> tasks;
+    tasks.reserve(sources.size());
+    for (auto const& source : sources) {
+      // A range of size zero decompresses the whole source
+      tasks.emplace_back(submit_decompression_task([compression, &source]() {
+        return decompress_range(compression, *source, 0, 0, nullptr);
+      }));
+    }
+    std::vector<std::vector<uint8_t>> uncomp_sources;
+    uncomp_sources.reserve(tasks.size());
+    for (auto& task : tasks) {
+      uncomp_sources.emplace_back(task.get());
+    }
+
+    // Gather the sources into a staging buffer, with a line delimiter between non-empty sources
+    static_assert(num_delimiter_chars == 1,
+                  "Currently only single-character delimiters are supported");
+    auto const num_nonempty = std::count_if(
+      uncomp_sources.cbegin(), uncomp_sources.cend(), [](auto const& s) { return not s.empty(); });
+    auto const total_data_size =
+      std::accumulate(uncomp_sources.cbegin(),
+                      uncomp_sources.cend(),
+                      0ul,
+                      [](auto sum, auto const& s) { return sum + s.size(); });
+    auto const total_size =
+      total_data_size + num_delimiter_chars * (std::max<size_t>(num_nonempty, 1) - 1);
+    cudf::detail::pinned_host_vector<char> h_buffer(total_size);
+    size_t bytes_copied = 0;
+    for (auto& uncomp_source : uncomp_sources) {
+      if (uncomp_source.empty()) { continue; }
+      if (bytes_copied != 0) {
+        h_buffer[bytes_copied] = '\n';
+        bytes_copied += num_delimiter_chars;
+      }
+      std::memcpy(h_buffer.data() + bytes_copied, uncomp_source.data(), uncomp_source.size());
+      bytes_copied += uncomp_source.size();
+      // Release the decompressed data of each source as soon as it is staged
+      std::vector<uint8_t>().swap(uncomp_source);
+    }
+
+    auto d_buffer = rmm::device_uvector<char>(total_size, stream);
+    CUDF_CUDA_TRY(cudaMemcpyAsync(
+      d_buffer.data(), h_buffer.data(), total_size, cudaMemcpyDefault, stream.value()));
+    stream.synchronize();
+    return d_buffer;
+  } else {
+    // Decompressing on the host because decompression of a single block is much faster on the CPU;
+    // chunks are copied to the device while the next one is decompressed, so the host memory use
+    // does not depend on the size of the data
+    chunked_stream_decompressor decompressor{
+      make_host_stream_decompressor(compression, *sources[0]), decompression_chunk_size};
+    auto d_buffer =
+      rmm::device_uvector<char>(decompressor.uncompressed_size_hint().value_or(0), stream);
+    d_buffer.resize(0, stream);
+    while (not decompressor.is_done()) {
+      auto const chunk     = decompressor.next_chunk();
+      auto const offset    = d_buffer.size();
+      auto const data_size = offset + chunk.size();
+      // Grow geometrically, as the size hint is only approximate
+      if (data_size > d_buffer.capacity()) {
+        d_buffer.reserve(std::max(data_size, d_buffer.capacity() * 2), stream);
+      }
+      d_buffer.resize(data_size, stream);
+      CUDF_CUDA_TRY(cudaMemcpyAsync(
+        d_buffer.data() + offset, chunk.data(), chunk.size(), cudaMemcpyDefault, stream.value()));
+      // The chunk memory is reused by the next call to `next_chunk`
+      stream.synchronize();
+    }
+    return d_buffer;
   }
 }
 
@@ -125,6 +204,7 @@ size_type find_first_delimiter_in_chunk(host_span<std::unique_ptr<cudf::io::data
 {
   auto const buffer = ingest_raw_input(sources,
                                        reader_opts.get_compression(),
+                                       reader_opts.get_seek_index().get(),
                                        reader_opts.get_byte_range_offset(),
                                        reader_opts.get_byte_range_size(),
                                        stream);
@@ -156,6 +236,7 @@ auto get_record_range_raw_input(host_span<std::unique_ptr<datasource>> sources,
 {
   auto buffer = ingest_raw_input(sources,
                                  reader_opts.get_compression(),
+                                 reader_opts.get_seek_index().get(),
                                  reader_opts.get_byte_range_offset(),
                                  reader_opts.get_byte_range_size(),
                                  stream);
@@ -168,26 +249,37 @@ auto get_record_range_raw_input(host_span<std::unique_ptr<datasource>> sources,
     first_delim_pos = first_delim_pos + reader_opts.get_byte_range_offset();
     // Find next delimiter
     decltype(first_delim_pos) next_delim_pos = -1;
-    auto const total_source_size             = sources_size(sources, 0, 0);
+    auto const is_compressed = reader_opts.get_compression() != compression_type::NONE;
+    auto const& seek_index   = reader_opts.get_seek_index();
+    // The size of decompressed data is only known from the seek index; without one, reading past
+    // the end of the data returns an empty buffer
+    auto const total_source_size =
+      not is_compressed ? sources_size(sources, 0, 0)
+      : seek_index      ? seek_index->uncompressed_size()
+                        : std::numeric_limits<size_t>::max();
     auto current_offset = reader_opts.get_byte_range_offset() + reader_opts.get_byte_range_size();
     while (current_offset < total_source_size and next_delim_pos == -1) {
-      buffer         = ingest_raw_input(sources,
+      buffer = ingest_raw_input(sources,
                                 reader_opts.get_compression(),
+                                seek_index.get(),
                                 current_offset,
                                 reader_opts.get_byte_range_size(),
                                 stream);
+      if (buffer.is_empty()) { break; }
       next_delim_pos = find_first_delimiter(buffer, '\n', stream);
       if (next_delim_pos == -1) { current_offset += reader_opts.get_byte_range_size(); }
     }
-    if (next_delim_pos == -1) {
-      next_delim_pos = total_source_size;
-    } else {
-      next_delim_pos = next_delim_pos + current_offset;
+    size_t range_size = 0;  // Zero reads compressed data until its end
+    if (next_delim_pos != -1) {
+      range_size = next_delim_pos + current_offset - first_delim_pos;
+    } else if (not is_compressed) {
+      range_size = total_source_size - first_delim_pos;
     }
     return ingest_raw_input(sources,
                             reader_opts.get_compression(),
+                            seek_index.get(),
                             first_delim_pos,
-                            next_delim_pos - first_delim_pos,
+                            range_size,
                             stream);
   }
 }
@@ -211,8 +303,6 @@ table_with_metadata read_json(host_span<std::unique_ptr<datasource>> sources,
   }
 
   if (sources.size() > 1) {
-    CUDF_EXPECTS(reader_opts.get_compression() == compression_type::NONE,
-                 "Multiple compressed inputs are not supported");
     CUDF_EXPECTS(reader_opts.is_enabled_lines(),
                  "Multiple inputs are supported only for JSON Lines format");
   }
@@ -16,8 +16,13 @@
 
 #include "orc.hpp"
 
+#include <cudf/ast/expressions.hpp>
+#include <cudf/utilities/span.hpp>
+
+#include <functional>
 #include <map>
 #include <optional>
+#include <set>
 #include <vector>
 
 namespace cudf::io::orc::detail {
@@ -60,6 +65,30 @@ class aggregate_orc_metadata {
    */
   [[nodiscard]] size_type calc_num_stripes() const;
 
+  /**
+   * @brief Filters the required stripes using the row group statistics in their row indexes, and
+   * the row group Bloom filters of the columns compared for equality with literals.
+   *
+   * Stripes are read as a whole, so a stripe is pruned only if none of its row groups may contain
+   * rows matching the filter. Stripes with neither a row index for all filter columns nor Bloom
+   * filters are kept.
+   *
+   * @param stripes Stripes of each source, in the order of `is_stripe_required`
+   * @param output_dtypes Data types of the output columns
+   * @param output_column_ids ORC column IDs of the output columns
+   * @param filter AST expression to filter the row groups
+   * @param filter_columns Indices of the output columns referenced in the filter
+   * @param[in,out] is_stripe_required Whether each stripe may contain rows matching the filter
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   */
+  void filter_stripes_with_row_indexes(host_span<std::vector<size_type> const> stripes,
+                                       host_span<data_type const> output_dtypes,
+                                       host_span<size_type const> output_column_ids,
+                                       std::reference_wrapper<ast::expression const> filter,
+                                       std::set<size_type> const& filter_columns,
+                                       std::vector<bool>& is_stripe_required,
+                                       rmm::cuda_stream_view stream) const;
+
  public:
   std::vector<metadata> per_file_metadata;
   int64_t const num_rows;
@@ -121,6 +150,24 @@ class aggregate_orc_metadata {
     std::optional<size_type> const& num_rows,
     rmm::cuda_stream_view stream);
 
+  /**
+   * @brief Filters the stripes to read using the statistics of the stripes and their row groups.
+   *
+   * @param stripes Stripes to filter for each source; all stripes if empty
+   * @param output_dtypes Data types of the output columns
+   * @param output_column_ids ORC column IDs of the output columns
+   * @param filter AST expression to filter the stripes, referencing the output columns
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   * @return Stripes of each source that may contain rows matching the filter, or `std::nullopt` if
+   * all stripes are required
+   */
+  [[nodiscard]] std::optional<std::vector<std::vector<size_type>>> filter_stripes(
+    std::vector<std::vector<size_type>> const& stripes,
+    host_span<data_type const> output_dtypes,
+    host_span<size_type const> output_column_ids,
+    std::reference_wrapper<ast::expression const> filter,
+    rmm::cuda_stream_view stream) const;
+
   /**
    * @brief Filters ORC file to a selection of columns, based on their paths in the file.
    *
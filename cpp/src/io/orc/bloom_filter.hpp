@@ -0,0 +1,188 @@
+/*
+ * Copyright (c) 2023, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/types.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+/**
+ * @file bloom_filter.hpp
+ * @brief Bloom filters as written by the ORC Java writer in BLOOM_FILTER_UTF8 streams
+ *
+ * Integers, dates and floating point values (widened to double, then bit cast) are hashed with
+ * Thomas Wang's 64-bit integer hash; strings are hashed with the 64-bit Murmur3 variant used by
+ * Hive, with seed 104729. The two halves of the hash are combined into `k` bit positions.
+ */
+
+namespace cudf {
+namespace io {
+namespace orc {
+
+constexpr double bloom_filter_default_fpp = 0.05;
+
+/**
+ * @brief Computes the hash of an integral value (Thomas Wang's 64-bit integer hash)
+ *
+ * Follows the Java `long` arithmetic of the ORC implementations: right shifts are arithmetic, and
+ * additions and left shifts wrap around (computed on the unsigned representation).
+ */
+CUDF_HOST_DEVICE inline uint64_t bloom_filter_long_hash(int64_t value)
+{
+  auto const shl = [](int64_t x, int s) {
+    return static_cast<int64_t>(static_cast<uint64_t>(x) << s);
+  };
+  auto const add = [](int64_t x, int64_t y) {
+    return static_cast<int64_t>(static_cast<uint64_t>(x) + static_cast<uint64_t>(y));
+  };
+  int64_t key = value;
+  key         = add(~key, shl(key, 21));
+  key         = key ^ (key >> 24);
+  key         = add(add(key, shl(key, 3)), shl(key, 8));
+  key         = key ^ (key >> 14);
+  key         = add(add(key, shl(key, 2)), shl(key, 4));
+  key         = key ^ (key >> 28);
+  key         = add(key, shl(key, 31));
+  return static_cast<uint64_t>(key);
+}
+
+/**
+ * @brief Computes the hash of a floating point value, using the bits of its double representation
+ */
+CUDF_HOST_DEVICE inline uint64_t bloom_filter_double_hash(double value)
+{
+  int64_t bits;
+  // Java's Double.doubleToLongBits collapses all NaN values into the canonical one
+  if (value != value) {
+    bits = 0x7ff8000000000000L;
+  } else {
+    std::memcpy(&bits, &value, sizeof(bits));
+  }
+  return bloom_filter_long_hash(bits);
+}
+
+/**
+ * @brief Computes the 64-bit Murmur3 hash of a byte buffer, as implemented in Hive
+ */
+CUDF_HOST_DEVICE inline uint64_t bloom_filter_bytes_hash(uint8_t const* data, size_t size)
+{
+  constexpr uint64_t c1   = 0x87c37b91114253d5ul;
+  constexpr uint64_t c2   = 0x4cf5ad432745937ful;
+  constexpr uint64_t n1   = 0x52dce729ul;
+  constexpr uint64_t seed = 104729;
+
+  auto const rotl = [](uint64_t x, int r) { return (x << r) | (x >> (64 - r)); };
+  auto const mix  = [&](uint64_t k) { return rotl(k * c1, 31) * c2; };
+
+  uint64_t hash = seed;
+  size_t offset = 0;
+  for (; offset + 8 <= size; offset += 8) {
+    uint64_t k = 0;
+    for (int i = 7; i >= 0; --i) {
+      k = (k << 8) | data[offset + i];
+    }
+    hash ^= mix(k);
+    hash = rotl(hash, 27) * 5 + n1;
+  }
+  if (offset < size) {
+    uint64_t k = 0;
+    for (auto i = size; i > offset; --i) {
+      k = (k << 8) | data[i - 1];
+    }
+    hash ^= mix(k);
+  }
+
+  hash ^= size;
+  hash ^= hash >> 33;
+  hash *= 0xff51afd7ed558ccdul;
+  hash ^= hash >> 33;
+  hash *= 0xc4ceb9fe1a85ec53ul;
+  hash ^= hash >> 33;
+  return hash;
+}
+
+/**
+ * @brief Returns the position of the bit set by the given hash function for the hash of a value
+ *
+ * @param hash Hash of the value
+ * @param fn Index of the hash function, starting at 1
+ * @param num_bits Number of bits in the filter
+ */
+CUDF_HOST_DEVICE inline uint32_t bloom_filter_bit(uint64_t hash, uint32_t fn, uint32_t num_bits)
+{
+  // Same as the 32-bit signed arithmetic of the Java implementation
+  auto const hash1 = static_cast<uint32_t>(hash);
+  auto const hash2 = static_cast<uint32_t>(hash >> 32);
+  auto combined    = static_cast<int32_t>(hash1 + fn * hash2);
+  if (combined < 0) { combined = ~combined; }
+  return static_cast<uint32_t>(combined) % num_bits;
+}
+
+/**
+ * @brief Checks whether a value may be present in a filter
+ *
+ * @param bitset Filter bits, as 32-bit little-endian words
+ * @param num_bits Number of bits in the filter
+ * @param num_hash_functions Number of hash functions used to set the bits
+ * @param hash Hash of the value
+ * @return False if the value is definitely absent
+ */
+CUDF_HOST_DEVICE inline bool bloom_filter_check(uint32_t const* bitset,
+                                                uint32_t num_bits,
+                                                uint32_t num_hash_functions,
+                                                uint64_t hash)
+{
+  for (uint32_t fn = 1; fn <= num_hash_functions; ++fn) {
+    auto const bit = bloom_filter_bit(hash, fn, num_bits);
+    if ((bitset[bit / 32] & (1u << (bit % 32))) == 0) { return false; }
+  }
+  return true;
+}
+
+/**
+ * @brief Computes the number of bits of a filter for the given number of values
+ *
+ * @param num_values Expected number of values inserted
+ * @param fpp Target false positive probability
+ * @return Number of bits, a multiple of 64
+ */
+inline uint32_t bloom_filter_num_bits(size_t num_values, double fpp)
+{
+  auto const n        = static_cast<double>(std::max<size_t>(num_values, 1));
+  auto const num_bits = static_cast<uint32_t>(-n * std::log(fpp) / (std::log(2.0) * std::log(2.0)));
+  return num_bits + (64 - num_bits % 64);
+}
+
+/**
+ * @brief Computes the optimal number of hash functions for a filter
+ *
+ * @param num_values Expected number of values inserted
+ * @param num_bits Number of bits in the filter
+ */
+inline uint32_t bloom_filter_num_hash_functions(size_t num_values, uint32_t num_bits)
+{
+  auto const n = static_cast<double>(std::max<size_t>(num_values, 1));
+  return std::max<uint32_t>(1, std::lround(num_bits / n * std::log(2.0)));
+}
+
+}  // namespace orc
+}  // namespace io
+}  // namespace cudf
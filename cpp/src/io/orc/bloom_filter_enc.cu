@@ -0,0 +1,107 @@
+/*
+ * Copyright (c) 2023, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "bloom_filter.hpp"
+#include "orc_gpu.hpp"
+
+#include <cudf/strings/string_view.cuh>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/traits.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+
+namespace cudf::io::orc::gpu {
+
+namespace {
+
+constexpr int bloom_filter_block_size = 256;
+
+/**
+ * @brief Hashes a column value the same way the ORC Java writer does for its Bloom filters
+ */
+struct bloom_filter_hash_fn {
+  template <typename T>
+  __device__ uint64_t operator()(column_device_view const& col, size_type idx) const
+  {
+    if constexpr (std::is_same_v<T, string_view>) {
+      auto const str = col.element<string_view>(idx);
+      return bloom_filter_bytes_hash(reinterpret_cast<uint8_t const*>(str.data()),
+                                     str.size_bytes());
+    } else if constexpr (std::is_floating_point_v<T>) {
+      return bloom_filter_double_hash(col.element<T>(idx));
+    } else if constexpr (cudf::is_integral<T>() and not cudf::is_boolean<T>()) {
+      return bloom_filter_long_hash(static_cast<int64_t>(col.element<T>(idx)));
+    } else if constexpr (std::is_same_v<T, timestamp_D>) {
+      // Dates are stored as the number of days since the epoch
+      return bloom_filter_long_hash(col.element<T>(idx).time_since_epoch().count());
+    } else {
+      CUDF_UNREACHABLE("Unsupported type for Bloom filter");
+    }
+  }
+};
+
+}  // namespace
+
+__global__ void __launch_bounds__(bloom_filter_block_size)
+  rowgroup_bloom_filters_kernel(device_span<uint32_t> bitsets,
+                                uint32_t num_bits,
+                                uint32_t num_hash_functions,
+                                device_span<orc_column_device_view const> orc_columns,
+                                device_2dspan<rowgroup_rows const> rowgroup_bounds,
+                                device_span<uint32_t const> bloom_col_indexes)
+{
+  // Index of the column in the `bloom_col_indexes` array
+  auto const bloom_col_idx = blockIdx.y;
+  // Index of the column in the `orc_columns` array
+  auto const col_idx       = bloom_col_indexes[bloom_col_idx];
+  auto const row_group_idx = blockIdx.x;
+  auto const num_words     = num_bits / 32;
+
+  auto const& col    = orc_columns[col_idx];
+  auto const& bounds = rowgroup_bounds[row_group_idx][col_idx];
+  auto const bitset  =
+    bitsets.data() + (bloom_col_idx * rowgroup_bounds.size().first + row_group_idx) * num_words;
+
+  for (auto row = bounds.begin + static_cast<size_type>(threadIdx.x); row < bounds.end;
+       row += bloom_filter_block_size) {
+    if (not col.is_valid(row)) { continue; }
+    auto const hash = type_dispatcher(col.type(), bloom_filter_hash_fn{}, col, row);
+    for (uint32_t fn = 1; fn <= num_hash_functions; ++fn) {
+      auto const bit = bloom_filter_bit(hash, fn, num_bits);
+      atomicOr(bitset + bit / 32, 1u << (bit % 32));
+    }
+  }
+}
+
+void rowgroup_bloom_filters(device_span<uint32_t> bitsets,
+                            uint32_t num_bits,
+                            uint32_t num_hash_functions,
+                            device_span<orc_column_device_view const> orc_columns,
+                            device_2dspan<rowgroup_rows const> rowgroup_bounds,
+                            device_span<uint32_t const> bloom_col_indexes,
+                            rmm::cuda_stream_view stream)
+{
+  if (rowgroup_bounds.count() == 0 or bloom_col_indexes.empty()) { return; }
+
+  auto const grid_size = dim3(static_cast<unsigned int>(rowgroup_bounds.size().first),
+                              static_cast<unsigned int>(bloom_col_indexes.size()));
+
+  rowgroup_bloom_filters_kernel<<<grid_size, bloom_filter_block_size, 0, stream.value()>>>(
+    bitsets, num_bits, num_hash_functions, orc_columns, rowgroup_bounds, bloom_col_indexes);
+}
+
+}  // namespace cudf::io::orc::gpu
@@ -19,6 +19,7 @@
 #include "orc_field_writer.hpp"
 
 #include <cudf/lists/lists_column_view.hpp>
+#include <io/utilities/metadata_cache.hpp>
 
 #include <thrust/tabulate.h>
 
@@ -209,6 +210,30 @@ void ProtobufReader::read(Metadata& s, size_t maxlen)
   function_builder(s, maxlen, op);
 }
 
+void ProtobufReader::read(RowIndexEntry& s, size_t maxlen)
+{
+  auto op = std::tuple(field_reader(2, s.statistics));
+  function_builder(s, maxlen, op);
+}
+
+void ProtobufReader::read(RowIndex& s, size_t maxlen)
+{
+  auto op = std::tuple(field_reader(1, s.entry));
+  function_builder(s, maxlen, op);
+}
+
+void ProtobufReader::read(BloomFilter& s, size_t maxlen)
+{
+  auto op = std::tuple(field_reader(1, s.numHashFunctions), field_reader(3, s.utf8bitset));
+  function_builder(s, maxlen, op);
+}
+
+void ProtobufReader::read(BloomFilterIndex& s, size_t maxlen)
+{
+  auto op = std::tuple(field_reader(1, s.bloomFilter));
+  function_builder(s, maxlen, op);
+}
+
 /**
  * @brief Add a single rowIndexEntry, negative input values treated as not present
  */
@@ -276,6 +301,23 @@ void ProtobufWriter::put_row_index_entry(int32_t present_blk,
   }
 }
 
+void ProtobufWriter::put_bloom_filter(uint32_t num_hash_functions, host_span<uint8_t const> bitset)
+{
+  auto const filter_size = varint_size(encode_field_number<uint32_t>(1)) +
+                           varint_size(num_hash_functions) +
+                           varint_size(encode_field_number(3, ProtofType::FIXEDLEN)) +
+                           varint_size(bitset.size()) + bitset.size();
+
+  // 1:BloomFilterIndex.bloomFilter
+  put_uint(encode_field_number(1, ProtofType::FIXEDLEN));
+  put_uint(filter_size);
+  put_uint(encode_field_number<uint32_t>(1));  // 1: numHashFunctions
+  put_uint(num_hash_functions);
+  put_uint(encode_field_number(3, ProtofType::FIXEDLEN));  // 3: utf8bitset
+  put_uint(bitset.size());
+  put_bytes<uint8_t>(bitset);
+}
+
 size_t ProtobufWriter::write(PostScript const& s)
 {
   ProtobufFieldWriter w(this);
@@ -451,6 +493,22 @@ host_span<uint8_t const> OrcDecompressor::decompress_blocks(host_span<uint8_t co
 
 metadata::metadata(datasource* const src, rmm::cuda_stream_view stream) : source(src)
 {
+  auto& cache         = detail::metadata_cache::instance();
+  auto const identity = cache.is_enabled() ? source->identity() : std::nullopt;
+  if (identity.has_value()) {
+    auto const cached =
+      cache.get<file_tail>(detail::metadata_cache::file_format::ORC, identity.value());
+    if (cached != nullptr) {
+      ps           = cached->ps;
+      ff           = cached->ff;
+      md           = cached->md;
+      decompressor = std::make_unique<OrcDecompressor>(ps.compression, ps.compressionBlockSize);
+      init_parent_descriptors();
+      init_column_names();
+      return;
+    }
+  }
+
   auto const len         = source->size();
   auto const max_ps_size = std::min(len, static_cast<size_t>(256));
 
@@ -479,6 +537,13 @@ metadata::metadata(datasource* const src, rmm::cuda_stream_view stream) : source
 
   init_parent_descriptors();
   init_column_names();
+
+  if (identity.has_value()) {
+    cache.insert(detail::metadata_cache::file_format::ORC,
+                 identity.value(),
+                 std::make_shared<file_tail>(file_tail{ps, ff, md}),
+                 ps_length + ps.footerLength + ps.metadataLength);
+  }
 }
 
 void metadata::init_column_names()
@@ -133,6 +133,29 @@ struct StripeStatistics {
   std::vector<ColStatsBlob> colStats;  // Column statistics blobs
 };
 
+/**
+ * @brief Entry of the row index of a column; stream positions are not parsed.
+ */
+struct RowIndexEntry {
+  std::optional<column_statistics> statistics;  // statistics of the rows in the row group
+};
+
+struct RowIndex {
+  std::vector<RowIndexEntry> entry;  // one entry per row group of the stripe
+};
+
+/**
+ * @brief Bloom filter of a row group; only the UTF-8 consistent bitset (ORC-101) is parsed.
+ */
+struct BloomFilter {
+  uint32_t numHashFunctions = 0;  // number of hash functions used to set the bits
+  std::string utf8bitset;         // little-endian 64-bit words of the bitset
+};
+
+struct BloomFilterIndex {
+  std::vector<BloomFilter> bloomFilter;  // one filter per row group of the stripe
+};
+
 struct Metadata {
   std::vector<StripeStatistics> stripeStats;
 };
@@ -224,6 +247,10 @@ class ProtobufReader {
   void read(column_statistics&, size_t maxlen);
   void read(StripeStatistics&, size_t maxlen);
   void read(Metadata&, size_t maxlen);
+  void read(RowIndexEntry&, size_t maxlen);
+  void read(RowIndex&, size_t maxlen);
+  void read(BloomFilter&, size_t maxlen);
+  void read(BloomFilterIndex&, size_t maxlen);
 
  private:
   template <int index>
@@ -480,6 +507,8 @@ class ProtobufWriter {
                            TypeKind kind,
                            ColStatsBlob const* stats);
 
+  void put_bloom_filter(uint32_t num_hash_functions, host_span<uint8_t const> bitset);
+
   std::size_t size() const { return m_buff.size(); }
   uint8_t const* data() { return m_buff.data(); }
 
@@ -566,6 +595,15 @@ struct column_validity_info {
   uint32_t null_count;
 };
 
+/**
+ * @brief Parsed sections at the end of an ORC file, shared through the metadata cache.
+ */
+struct file_tail {
+  PostScript ps;
+  FileFooter ff;
+  Metadata md;
+};
+
 /**
  * @brief A helper class for ORC file metadata. Provides some additional
  * convenience methods for initializing and accessing metadata.
@@ -431,6 +431,25 @@ void rowgroup_char_counts(device_2dspan<size_type> counts,
                           device_span<uint32_t const> str_col_indexes,
                           rmm::cuda_stream_view stream);
 
+/**
+ * @brief Sets the bits of the valid values of each rowgroup in the Bloom filters of the columns.
+ *
+ * @param bitsets Zero-initialized filter words [column][rowgroup][word]
+ * @param num_bits Number of bits in each filter
+ * @param num_hash_functions Number of hash functions of each filter
+ * @param orc_columns Pre-order flattened device array of ORC column views
+ * @param rowgroup_bounds Ranges of rows in each rowgroup [rowgroup][column]
+ * @param bloom_col_indexes Indexes of the columns with Bloom filters in orc_columns
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ */
+void rowgroup_bloom_filters(device_span<uint32_t> bitsets,
+                            uint32_t num_bits,
+                            uint32_t num_hash_functions,
+                            device_span<orc_column_device_view const> orc_columns,
+                            device_2dspan<rowgroup_rows const> rowgroup_bounds,
+                            device_span<uint32_t const> bloom_col_indexes,
+                            rmm::cuda_stream_view stream);
+
 /**
  * @brief Launches kernels to initialize statistics collection
  *
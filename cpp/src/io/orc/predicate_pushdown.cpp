@@ -0,0 +1,421 @@
+/*
+ * Copyright (c) 2023, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "aggregate_orc_metadata.hpp"
+#include "bloom_filter.hpp"
+
+#include <io/utilities/stats_expression_converter.hpp>
+#include <io/utilities/stats_filter.hpp>
+
+#include <cudf/scalar/scalar.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/traits.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <map>
+#include <numeric>
+#include <set>
+#include <string>
+#include <string_view>
+
+namespace cudf::io::orc::detail {
+
+namespace {
+
+using cudf::io::detail::stats_min_max;
+using cudf::io::detail::stats_value;
+using cudf::io::detail::to_stats_value;
+
+/**
+ * @brief Converts the minimum and maximum values in the statistics of a column to statistics
+ * values; uses storage type as T
+ *
+ * Only integral, floating point, string and date columns have usable statistics; the values of
+ * other columns are missing.
+ */
+struct stats_converter {
+  template <typename T>
+  stats_min_max operator()(column_statistics const& stats, data_type dtype) const
+  {
+    auto const to_min_max = [](auto const& minmax, auto const& convert) -> stats_min_max {
+      if (not minmax.has_value()) { return {}; }
+      stats_min_max result;
+      if (minmax->minimum.has_value()) { result.min = convert(minmax->minimum.value()); }
+      if (minmax->maximum.has_value()) { result.max = convert(minmax->maximum.value()); }
+      return result;
+    };
+    if constexpr (std::is_same_v<T, string_view>) {
+      // Strings reference the parsed statistics
+      return to_min_max(stats.string_stats, [](std::string const& value) {
+        return stats_value{std::string_view(value)};
+      });
+    } else if constexpr (cudf::is_floating_point<T>()) {
+      return to_min_max(stats.double_stats,
+                        [](double value) { return to_stats_value(static_cast<T>(value)); });
+    } else if constexpr (std::is_same_v<T, timestamp_D>) {
+      // Dates are stored as the number of days since the epoch
+      return to_min_max(stats.date_stats, [](int32_t value) {
+        return to_stats_value(T{typename T::duration{value}});
+      });
+    } else if constexpr (cudf::is_integral<T>() and not cudf::is_boolean<T>()) {
+      // Decimal columns have the same storage types, but do not have integer statistics
+      if (not cudf::is_integral(dtype)) { return {}; }
+      return to_min_max(stats.int_stats,
+                        [](int64_t value) { return to_stats_value(static_cast<T>(value)); });
+    } else {
+      return {};
+    }
+  }
+};
+
+/**
+ * @brief Converts the parsed statistics of the output columns to statistics values
+ *
+ * @param stats Parsed statistics of each range of rows, one list per output column; empty for the
+ * columns that are not referenced by the filter
+ * @param output_dtypes Data types of the output columns
+ * @return Statistics values of each range of rows, one list per output column
+ */
+std::vector<std::vector<stats_min_max>> convert_stats(
+  host_span<std::vector<column_statistics> const> stats, host_span<data_type const> output_dtypes)
+{
+  std::vector<std::vector<stats_min_max>> converted(output_dtypes.size());
+  for (size_t col_idx = 0; col_idx < output_dtypes.size(); ++col_idx) {
+    auto const& dtype = output_dtypes[col_idx];
+    if (cudf::is_compound(dtype) && dtype.id() != type_id::STRING) { continue; }
+    converted[col_idx].reserve(stats[col_idx].size());
+    for (auto const& range_stats : stats[col_idx]) {
+      converted[col_idx].push_back(cudf::type_dispatcher<dispatch_storage_type>(
+        dtype, stats_converter{}, range_stats, dtype));
+    }
+  }
+  return converted;
+}
+
+/**
+ * @brief Computes the Bloom filter hashes of a literal value
+ *
+ * Returns all hashes under which values equal to the literal may have been inserted, i.e. both
+ * signed zeros for floating point literals, or `std::nullopt` if the type is not supported.
+ */
+struct literal_bloom_filter_hashes {
+  template <typename T>
+  std::optional<std::vector<uint64_t>> operator()(cudf::scalar const& value,
+                                                  rmm::cuda_stream_view stream) const
+  {
+    if constexpr (std::is_same_v<T, string_view>) {
+      auto const str = static_cast<cudf::string_scalar const&>(value).to_string(stream);
+      return std::vector<uint64_t>{
+        bloom_filter_bytes_hash(reinterpret_cast<uint8_t const*>(str.data()), str.size())};
+    } else if constexpr (cudf::is_integral<T>() and not cudf::is_boolean<T>()) {
+      auto const val = static_cast<cudf::scalar_type_t<T> const&>(value).value(stream);
+      return std::vector<uint64_t>{bloom_filter_long_hash(static_cast<int64_t>(val))};
+    } else if constexpr (cudf::is_floating_point<T>()) {
+      auto const val = static_cast<double>(
+        static_cast<cudf::scalar_type_t<T> const&>(value).value(stream));
+      // Signed zeros compare equal but have different bit representations
+      return val == 0 ? std::vector<uint64_t>{bloom_filter_double_hash(val),
+                                              bloom_filter_double_hash(-val)}
+                      : std::vector<uint64_t>{bloom_filter_double_hash(val)};
+    } else if constexpr (std::is_same_v<T, timestamp_D>) {
+      auto const val = static_cast<cudf::timestamp_scalar<T> const&>(value).value(stream);
+      return std::vector<uint64_t>{bloom_filter_long_hash(val.time_since_epoch().count())};
+    } else {
+      return std::nullopt;
+    }
+  }
+};
+
+/**
+ * @brief Returns false if none of the hashes of a value are present in a row group Bloom filter
+ */
+bool may_contain(BloomFilter const& bloom_filter, host_span<uint64_t const> hashes)
+{
+  auto const num_bits = bloom_filter.utf8bitset.size() * 8;
+  if (bloom_filter.numHashFunctions == 0 or num_bits == 0 or
+      num_bits > std::numeric_limits<uint32_t>::max()) {
+    return true;
+  }
+  std::vector<uint32_t> bitset(bloom_filter.utf8bitset.size() / sizeof(uint32_t));
+  std::memcpy(bitset.data(), bloom_filter.utf8bitset.data(), bitset.size() * sizeof(uint32_t));
+  return std::any_of(hashes.begin(), hashes.end(), [&](auto hash) {
+    return bloom_filter_check(bitset.data(),
+                              static_cast<uint32_t>(bitset.size() * 32),
+                              bloom_filter.numHashFunctions,
+                              hash);
+  });
+}
+
+}  // namespace
+
+std::optional<std::vector<std::vector<size_type>>> aggregate_orc_metadata::filter_stripes(
+  std::vector<std::vector<size_type>> const& stripes,
+  host_span<data_type const> output_dtypes,
+  host_span<size_type const> output_column_ids,
+  std::reference_wrapper<ast::expression const> filter,
+  rmm::cuda_stream_view stream) const
+{
+  // Stripes to filter, per source
+  std::vector<std::vector<size_type>> input_stripes;
+  if (stripes.empty()) {
+    std::transform(per_file_metadata.cbegin(),
+                   per_file_metadata.cend(),
+                   std::back_inserter(input_stripes),
+                   [](auto const& file_meta) {
+                     std::vector<size_type> stripe_idx(file_meta.ff.stripes.size());
+                     std::iota(stripe_idx.begin(), stripe_idx.end(), 0);
+                     return stripe_idx;
+                   });
+  } else {
+    input_stripes = stripes;
+  }
+
+  std::set<size_type> filter_columns;
+  cudf::io::detail::collect_column_references(filter.get(), filter_columns);
+
+  // Parses the stripe statistics of the columns referenced in the filter
+  std::vector<std::vector<column_statistics>> stripe_stats(output_dtypes.size());
+  size_type num_stripes = 0;
+  for (size_t src_idx = 0; src_idx < input_stripes.size(); ++src_idx) {
+    num_stripes += input_stripes[src_idx].size();
+  }
+  for (auto const col_idx : filter_columns) {
+    if (static_cast<size_t>(col_idx) >= output_dtypes.size()) { continue; }
+    auto const col_id = output_column_ids[col_idx];
+    stripe_stats[col_idx].reserve(num_stripes);
+    for (size_t src_idx = 0; src_idx < input_stripes.size(); ++src_idx) {
+      auto const& md = per_file_metadata[src_idx].md;
+      for (auto const stripe_idx : input_stripes[src_idx]) {
+        auto& stats = stripe_stats[col_idx].emplace_back();
+        if (static_cast<size_t>(stripe_idx) < md.stripeStats.size() and
+            static_cast<size_t>(col_id) < md.stripeStats[stripe_idx].colStats.size()) {
+          auto const& blob = md.stripeStats[stripe_idx].colStats[col_id];
+          ProtobufReader(blob.data(), blob.size()).read(stats);
+        }
+      }
+    }
+  }
+  auto const converted_stats = convert_stats(stripe_stats, output_dtypes);
+  auto is_stripe_required     = cudf::io::detail::evaluate_stats_filter(
+    converted_stats, output_dtypes, filter.get(), num_stripes, stream);
+
+  filter_stripes_with_row_indexes(input_stripes,
+                                  output_dtypes,
+                                  output_column_ids,
+                                  filter,
+                                  filter_columns,
+                                  is_stripe_required,
+                                  stream);
+
+  if (std::all_of(
+        is_stripe_required.cbegin(), is_stripe_required.cend(), [](auto i) { return i; })) {
+    return std::nullopt;
+  }
+  std::vector<std::vector<size_type>> filtered_stripes(input_stripes.size());
+  size_t stripe_offset = 0;
+  for (size_t src_idx = 0; src_idx < input_stripes.size(); ++src_idx) {
+    for (auto const stripe_idx : input_stripes[src_idx]) {
+      if (is_stripe_required[stripe_offset++]) {
+        filtered_stripes[src_idx].push_back(stripe_idx);
+      }
+    }
+  }
+  return {std::move(filtered_stripes)};
+}
+
+void aggregate_orc_metadata::filter_stripes_with_row_indexes(
+  host_span<std::vector<size_type> const> stripes,
+  host_span<data_type const> output_dtypes,
+  host_span<size_type const> output_column_ids,
+  std::reference_wrapper<ast::expression const> filter,
+  std::set<size_type> const& filter_columns,
+  std::vector<bool>& is_stripe_required,
+  rmm::cuda_stream_view stream) const
+{
+  auto const row_index_stride = get_row_index_stride();
+  if (row_index_stride <= 0) { return; }
+
+  // Bloom filter hashes of the literals compared for equality with a column
+  std::map<std::pair<size_type, ast::literal const*>, std::optional<std::vector<uint64_t>>>
+    literal_hashes;
+  std::set<size_type> bloom_filter_columns;
+  cudf::io::detail::for_each_column_literal_equality(
+    filter.get(), [&](size_type col_idx, ast::literal const& lit) {
+      auto [it, inserted] = literal_hashes.try_emplace({col_idx, &lit});
+      if (not inserted or static_cast<size_t>(col_idx) >= output_dtypes.size()) { return; }
+      auto const& scalar = lit.get_scalar();
+      auto& hashes       = it->second;
+      if (scalar.type() != output_dtypes[col_idx] or not scalar.is_valid(stream)) { return; }
+      hashes =
+        cudf::type_dispatcher(scalar.type(), literal_bloom_filter_hashes{}, scalar, stream);
+      if (hashes.has_value()) { bloom_filter_columns.insert(col_idx); }
+    });
+
+  // Row group statistics of the columns referenced in the filter, per row group of the stripes
+  // with a row index
+  std::vector<std::vector<column_statistics>> rowgroup_stats(output_dtypes.size());
+  // Index of the stripe (in `is_stripe_required`) of each row group
+  std::vector<size_t> rowgroup_stripes;
+  // Whether the Bloom filters of each row group allow rows to match the filter
+  std::vector<bool> rowgroup_bloom_match;
+
+  size_t stripe_offset = 0;
+  for (size_t src_idx = 0; src_idx < stripes.size(); ++src_idx) {
+    auto& file_meta = per_file_metadata[src_idx];
+
+    // Read the footers of the stripes that are still required and have a row index
+    std::vector<size_t> candidate_stripes;
+    std::vector<datasource::range> footer_ranges;
+    for (size_t i = 0; i < stripes[src_idx].size(); ++i) {
+      auto const& stripe = file_meta.ff.stripes[stripes[src_idx][i]];
+      if (not is_stripe_required[stripe_offset + i] or stripe.indexLength == 0) { continue; }
+      candidate_stripes.push_back(i);
+      footer_ranges.push_back(
+        {stripe.offset + stripe.indexLength + stripe.dataLength, stripe.footerLength});
+    }
+    if (footer_ranges.empty()) {
+      stripe_offset += stripes[src_idx].size();
+      continue;
+    }
+    auto const footer_buffers = file_meta.source->host_read_ranges(footer_ranges);
+
+    // Locate the row index and Bloom filter streams of the filter columns
+    std::vector<std::vector<std::optional<datasource::range>>> index_ranges;
+    std::vector<std::vector<std::optional<datasource::range>>> bloom_ranges;
+    std::vector<datasource::range> ranges;
+    for (size_t c = 0; c < candidate_stripes.size(); ++c) {
+      auto const& stripe = file_meta.ff.stripes[stripes[src_idx][candidate_stripes[c]]];
+      auto const sf_data = file_meta.decompressor->decompress_blocks(
+        {footer_buffers[c]->data(), footer_buffers[c]->size()}, stream);
+      StripeFooter footer;
+      ProtobufReader(sf_data.data(), sf_data.size()).read(footer);
+
+      auto& stripe_index_ranges = index_ranges.emplace_back(output_dtypes.size());
+      auto& stripe_bloom_ranges = bloom_ranges.emplace_back(output_dtypes.size());
+      auto offset               = stripe.offset;
+      for (auto const& stream_desc : footer.streams) {
+        if (stream_desc.kind == ROW_INDEX and stream_desc.column_id.has_value()) {
+          for (auto const col_idx : filter_columns) {
+            if (static_cast<size_t>(col_idx) < output_column_ids.size() and
+                output_column_ids[col_idx] == static_cast<size_type>(*stream_desc.column_id)) {
+              stripe_index_ranges[col_idx] = datasource::range{offset, stream_desc.length};
+            }
+          }
+        } else if (stream_desc.kind == BLOOM_FILTER_UTF8 and stream_desc.column_id.has_value()) {
+          for (auto const col_idx : bloom_filter_columns) {
+            if (output_column_ids[col_idx] == static_cast<size_type>(*stream_desc.column_id)) {
+              stripe_bloom_ranges[col_idx] = datasource::range{offset, stream_desc.length};
+            }
+          }
+        }
+        offset += stream_desc.length;
+      }
+      for (auto const* stripe_ranges : {&stripe_index_ranges, &stripe_bloom_ranges}) {
+        for (auto const& range : *stripe_ranges) {
+          if (range.has_value()) { ranges.push_back(range.value()); }
+        }
+      }
+    }
+    auto const index_buffers = file_meta.source->host_read_ranges(ranges);
+
+    // Parse the row indexes and Bloom filters; stripes are only used if the number of entries
+    // matches the number of row groups
+    size_t buffer_idx = 0;
+    for (size_t c = 0; c < candidate_stripes.size(); ++c) {
+      auto const& stripe       = file_meta.ff.stripes[stripes[src_idx][candidate_stripes[c]]];
+      auto const num_rowgroups = (stripe.numberOfRows + row_index_stride - 1) / row_index_stride;
+      std::vector<std::pair<size_type, RowIndex>> row_indexes;
+      std::map<size_type, BloomFilterIndex> bloom_filters;
+      for (size_t col_idx = 0; col_idx < output_dtypes.size(); ++col_idx) {
+        if (not index_ranges[c][col_idx].has_value()) { continue; }
+        auto const& buffer = index_buffers[buffer_idx++];
+        auto const ri_data =
+          file_meta.decompressor->decompress_blocks({buffer->data(), buffer->size()}, stream);
+        auto& row_index = row_indexes.emplace_back(col_idx, RowIndex{}).second;
+        ProtobufReader(ri_data.data(), ri_data.size()).read(row_index);
+      }
+      for (size_t col_idx = 0; col_idx < output_dtypes.size(); ++col_idx) {
+        if (not bloom_ranges[c][col_idx].has_value()) { continue; }
+        auto const& buffer = index_buffers[buffer_idx++];
+        auto const bf_data =
+          file_meta.decompressor->decompress_blocks({buffer->data(), buffer->size()}, stream);
+        BloomFilterIndex bloom_filter_index;
+        ProtobufReader(bf_data.data(), bf_data.size()).read(bloom_filter_index);
+        if (bloom_filter_index.bloomFilter.size() == num_rowgroups) {
+          bloom_filters.emplace(col_idx, std::move(bloom_filter_index));
+        }
+      }
+      auto const is_complete =
+        row_indexes.size() == filter_columns.size() and
+        std::all_of(row_indexes.cbegin(), row_indexes.cend(), [&](auto const& row_index) {
+          return row_index.second.entry.size() == num_rowgroups;
+        });
+      if (not is_complete and bloom_filters.empty()) { continue; }
+
+      for (auto const col_idx : filter_columns) {
+        if (static_cast<size_t>(col_idx) >= output_dtypes.size()) { continue; }
+        auto const row_index =
+          std::find_if(row_indexes.begin(), row_indexes.end(), [&](auto const& row_index) {
+            return row_index.first == col_idx;
+          });
+        for (size_t rg = 0; rg < num_rowgroups; ++rg) {
+          // Row groups without statistics are required
+          auto& stats = rowgroup_stats[col_idx].emplace_back();
+          if (is_complete) {
+            stats = row_index->second.entry[rg].statistics.value_or(column_statistics{});
+          }
+        }
+      }
+      for (size_t rg = 0; rg < num_rowgroups; ++rg) {
+        rowgroup_bloom_match.push_back(cudf::io::detail::may_satisfy(
+          filter.get(), [&](size_type col_idx, ast::literal const& lit) {
+            auto const filter_it = bloom_filters.find(col_idx);
+            auto const& hashes   = literal_hashes.at({col_idx, &lit});
+            if (filter_it == bloom_filters.end() or not hashes.has_value()) { return true; }
+            return may_contain(filter_it->second.bloomFilter[rg], hashes.value());
+          }));
+      }
+      rowgroup_stripes.insert(
+        rowgroup_stripes.end(), num_rowgroups, stripe_offset + candidate_stripes[c]);
+    }
+    stripe_offset += stripes[src_idx].size();
+  }
+  if (rowgroup_stripes.empty()) { return; }
+
+  auto const num_rowgroups   = static_cast<size_type>(rowgroup_stripes.size());
+  auto const converted_stats = convert_stats(rowgroup_stats, output_dtypes);
+  auto const is_rowgroup_required = cudf::io::detail::evaluate_stats_filter(
+    converted_stats, output_dtypes, filter.get(), num_rowgroups, stream);
+
+  // Stripes are read as a whole, so a stripe is only pruned when none of its row groups match
+  std::vector<bool> has_required_rowgroup(is_stripe_required.size(), false);
+  std::vector<bool> has_row_index(is_stripe_required.size(), false);
+  for (size_type rg = 0; rg < num_rowgroups; ++rg) {
+    has_row_index[rowgroup_stripes[rg]] = true;
+    if (is_rowgroup_required[rg] and rowgroup_bloom_match[rg]) {
+      has_required_rowgroup[rowgroup_stripes[rg]] = true;
+    }
+  }
+  for (size_t stripe = 0; stripe < is_stripe_required.size(); ++stripe) {
+    if (has_row_index[stripe] and not has_required_rowgroup[stripe]) {
+      is_stripe_required[stripe] = false;
+    }
+  }
+}
+
+}  // namespace cudf::io::orc::detail
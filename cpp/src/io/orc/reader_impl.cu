@@ -28,12 +28,15 @@
 #include <io/comp/nvcomp_adapter.hpp>
 #include <io/utilities/config_utils.hpp>
 
+#include <cudf/detail/stream_compaction.hpp>
 #include <cudf/detail/timezone.hpp>
+#include <cudf/detail/transform.hpp>
 #include <cudf/detail/utilities/integer_utils.hpp>
 #include <cudf/detail/utilities/vector_factories.hpp>
 #include <cudf/table/table.hpp>
 #include <cudf/utilities/bit.hpp>
 #include <cudf/utilities/error.hpp>
+#include <cudf/utilities/traits.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
 #include <rmm/device_buffer.hpp>
@@ -50,7 +53,10 @@
 #include <thrust/transform.h>
 
 #include <algorithm>
+#include <climits>
 #include <iterator>
+#include <limits>
+#include <numeric>
 
 namespace cudf::io::detail::orc {
 using namespace cudf::io::orc;
@@ -136,6 +142,11 @@ std::size_t gather_stream_info(std::size_t stripe_index,
   };
 
   for (auto const& stream : stripefooter->streams) {
+    // Bloom filters are only used to filter stripes; they are not needed to decode the columns
+    if (stream.kind == orc::BLOOM_FILTER or stream.kind == orc::BLOOM_FILTER_UTF8) {
+      src_offset += stream.length;
+      continue;
+    }
     if (!stream.column_id || *stream.column_id >= orc2gdf.size()) {
       dst_offset += stream.length;
       continue;
@@ -953,22 +964,235 @@ reader::impl::impl(std::vector<std::unique_ptr<datasource>>&& sources,
     _use_index{options.is_enabled_use_index()},
     _use_np_dtypes{options.is_enabled_use_np_dtypes()},
     _decimal128_columns{options.get_decimal128_columns()},
-    _col_meta{std::make_unique<reader_column_meta>()}
+    _col_meta{std::make_unique<reader_column_meta>()},
+    _chunk_read_limit{0},
+    _pass_read_limit{0}
+{
+}
+
+reader::impl::impl(std::size_t chunk_read_limit,
+                   std::size_t pass_read_limit,
+                   std::vector<std::unique_ptr<datasource>>&& sources,
+                   orc_reader_options const& options,
+                   rmm::cuda_stream_view stream,
+                   rmm::mr::device_memory_resource* mr)
+  : _stream(stream),
+    _mr(mr),
+    _sources(std::move(sources)),
+    _metadata{_sources, stream},
+    _selected_columns{_metadata.select_columns(options.get_columns())},
+    _timestamp_type{options.get_timestamp_type()},
+    _use_index{options.is_enabled_use_index()},
+    _use_np_dtypes{options.is_enabled_use_np_dtypes()},
+    _decimal128_columns{options.get_decimal128_columns()},
+    _col_meta{std::make_unique<reader_column_meta>()},
+    _chunk_read_limit{chunk_read_limit},
+    _pass_read_limit{pass_read_limit}
 {
+  // Zero limits read everything in a single chunk, but the stripes are still selected here, as
+  // `read_chunk` is called without a selection
+  prepare_stripes(
+    options.get_skip_rows(), options.get_num_rows(), options.get_stripes(), options.get_filter());
 }
 
-table_with_metadata reader::impl::read(uint64_t skip_rows,
-                                       std::optional<size_type> const& num_rows_opt,
-                                       std::vector<std::vector<size_type>> const& stripes)
+data_type reader::impl::column_data_type(size_type orc_col_id) const
+{
+  auto col_type = to_cudf_type(_metadata.get_col_type(orc_col_id).kind,
+                               _use_np_dtypes,
+                               _timestamp_type.id(),
+                               to_cudf_decimal_type(_decimal128_columns, _metadata, orc_col_id));
+  CUDF_EXPECTS(col_type != type_id::EMPTY, "Unknown type");
+  if (col_type == type_id::DECIMAL32 or col_type == type_id::DECIMAL64 or
+      col_type == type_id::DECIMAL128) {
+    // sign of the scale is changed since cuDF follows c++ libraries like CNL
+    // which uses negative scaling, but liborc and other libraries
+    // follow positive scaling.
+    auto const scale =
+      -static_cast<size_type>(_metadata.get_col_type(orc_col_id).scale.value_or(0));
+    return data_type{col_type, scale};
+  }
+  return data_type{col_type};
+}
+
+void reader::impl::prepare_stripes(
+  uint64_t skip_rows,
+  std::optional<size_type> const& num_rows_opt,
+  std::vector<std::vector<size_type>> const& stripes,
+  std::optional<std::reference_wrapper<ast::expression const>> filter)
 {
   // Selected columns at different levels of nesting are stored in different elements
   // of `selected_columns`; thus, size == 1 means no nested columns
   CUDF_EXPECTS(skip_rows == 0 or _selected_columns.num_levels() == 1,
                "skip_rows is not supported by nested columns");
 
+  _stripes.clear();
+  _rows_to_skip         = 0;
+  _rows_remaining       = 0;
+  _filter               = filter;
+  _next_stripe          = 0;
+  _has_read_chunk       = false;
+  _row_fixed_width_bits = 0;
+
+  // There are no columns in the table
+  if (_selected_columns.num_levels() == 0) { return; }
+
+  // Prune the stripes that cannot contain rows matching the filter; row selection is applied to
+  // all rows of the file, so stripes are only pruned when reading the whole file
+  auto const filtered_stripes = [&]() -> std::optional<std::vector<std::vector<size_type>>> {
+    if (not filter.has_value() or skip_rows != 0 or num_rows_opt.has_value()) {
+      return std::nullopt;
+    }
+    std::vector<data_type> output_dtypes;
+    std::vector<size_type> output_column_ids;
+    for (auto const& col : _selected_columns.levels[0]) {
+      output_dtypes.push_back(column_data_type(col.id));
+      output_column_ids.push_back(col.id);
+    }
+    return _metadata.filter_stripes(
+      stripes, output_dtypes, output_column_ids, filter.value(), _stream);
+  }();
+
+  // Select only stripes required (aka row groups)
+  auto const [rows_to_skip, rows_to_read, selected_stripes] = _metadata.select_stripes(
+    filtered_stripes.value_or(stripes), skip_rows, num_rows_opt, _stream);
+  if (rows_to_read == 0) { return; }
+  _rows_to_skip   = rows_to_skip;
+  _rows_remaining = rows_to_read;
+
+  // The output of top-level fixed-width columns is estimated from the number of rows; the output
+  // of the other columns from the size of their streams
+  std::vector<bool> is_var_width_column(_metadata.get_num_cols(), false);
+  for (std::size_t level = 0; level < _selected_columns.num_levels(); ++level) {
+    for (auto const& col : _selected_columns.levels[level]) {
+      auto const col_type = column_data_type(col.id);
+      if (level == 0 and is_fixed_width(col_type)) {
+        // Data and validity
+        _row_fixed_width_bits += size_of(col_type) * CHAR_BIT + 1;
+      } else {
+        is_var_width_column[col.id] = true;
+      }
+    }
+  }
+  std::vector<bool> is_selected_column(_metadata.get_num_cols(), false);
+  for (auto const& level : _selected_columns.levels) {
+    for (auto const& col : level) {
+      is_selected_column[col.id] = true;
+    }
+  }
+
+  for (auto const& stripe_source_mapping : selected_stripes) {
+    for (auto const& stripe : stripe_source_mapping.stripe_info) {
+      std::size_t stream_size           = 0;
+      std::size_t var_width_stream_size = 0;
+      for (auto const& stream : stripe.second->streams) {
+        if (not stream.column_id.has_value() or
+            *stream.column_id >= is_selected_column.size() or
+            not is_selected_column[*stream.column_id]) {
+          continue;
+        }
+        stream_size += stream.length;
+        if (is_var_width_column[*stream.column_id]) { var_width_stream_size += stream.length; }
+      }
+      _stripes.push_back(
+        {stripe_source_mapping.source_idx, stripe, stream_size, var_width_stream_size});
+    }
+  }
+}
+
+std::size_t reader::impl::next_chunk_end() const
+{
+  if (_chunk_read_limit == 0 and _pass_read_limit == 0) { return _stripes.size(); }
+
+  // The decompressed size of the stripe data is only known once a stripe has been decompressed,
+  // so the first chunk of a compressed dataset holds a single stripe
+  auto const is_compressed = _metadata.per_file_metadata[0].ps.compression != orc::NONE;
+  if (is_compressed and _total_comp_size == 0) { return _next_stripe + 1; }
+  auto const decomp_ratio =
+    is_compressed ? static_cast<double>(_total_decomp_size) / _total_comp_size : 1.0;
+
+  // The compressed and the decompressed stripe data are held at the same time
+  auto const pass_size = [&](selected_stripe const& s) {
+    return s.stream_size +
+           (is_compressed ? static_cast<std::size_t>(s.stream_size * decomp_ratio) : 0);
+  };
+  auto const output_size = [&](selected_stripe const& s) {
+    return (s.stripe.first->numberOfRows * _row_fixed_width_bits + CHAR_BIT - 1) / CHAR_BIT +
+           static_cast<std::size_t>(s.var_width_stream_size * decomp_ratio);
+  };
+  auto const is_within_limit = [](std::size_t limit, std::size_t size) {
+    return limit == 0 or size <= limit;
+  };
+
+  std::size_t chunk_pass_size   = 0;
+  std::size_t chunk_output_size = 0;
+  std::size_t chunk_num_rows    = 0;
+  auto end                      = _next_stripe;
+  // Each chunk holds at least one stripe
+  do {
+    chunk_pass_size += pass_size(_stripes[end]);
+    chunk_output_size += output_size(_stripes[end]);
+    chunk_num_rows += _stripes[end].stripe.first->numberOfRows;
+    ++end;
+  } while (end < _stripes.size() and
+           is_within_limit(_pass_read_limit, chunk_pass_size + pass_size(_stripes[end])) and
+           is_within_limit(_chunk_read_limit, chunk_output_size + output_size(_stripes[end])) and
+           chunk_num_rows + _stripes[end].stripe.first->numberOfRows <=
+             static_cast<std::size_t>(std::numeric_limits<size_type>::max()));
+  return end;
+}
+
+bool reader::impl::has_next() const
+{
+  return not _has_read_chunk or _next_stripe < _stripes.size();
+}
+
+table_with_metadata reader::impl::read_chunk()
+{
+  _has_read_chunk = true;
+
   // There are no columns in the table
   if (_selected_columns.num_levels() == 0) { return {std::make_unique<table>(), table_metadata{}}; }
 
+  // If no rows or stripes to read, return empty columns
+  if (_next_stripe >= _stripes.size()) { return read_stripes(0, 0, {}); }
+
+  // Group the stripes of the chunk by source
+  auto const end = next_chunk_end();
+  std::vector<metadata::stripe_source_mapping> chunk_stripes;
+  uint64_t chunk_num_rows = 0;
+  for (auto i = _next_stripe; i < end; ++i) {
+    auto const& stripe = _stripes[i];
+    if (chunk_stripes.empty() or chunk_stripes.back().source_idx != stripe.source_idx) {
+      chunk_stripes.push_back({stripe.source_idx, {}});
+    }
+    chunk_stripes.back().stripe_info.push_back(stripe.stripe);
+    chunk_num_rows += stripe.stripe.first->numberOfRows;
+  }
+
+  // Rows are only skipped in the first stripe
+  auto const rows_to_skip = _next_stripe == 0 ? _rows_to_skip : 0;
+  auto const rows_to_read = std::min(chunk_num_rows - rows_to_skip, _rows_remaining);
+  _rows_remaining -= rows_to_read;
+  _next_stripe = end;
+
+  return read_stripes(rows_to_skip, static_cast<size_type>(rows_to_read), chunk_stripes);
+}
+
+table_with_metadata reader::impl::read(
+  uint64_t skip_rows,
+  std::optional<size_type> const& num_rows_opt,
+  std::vector<std::vector<size_type>> const& stripes,
+  std::optional<std::reference_wrapper<ast::expression const>> filter)
+{
+  prepare_stripes(skip_rows, num_rows_opt, stripes, filter);
+  return read_chunk();
+}
+
+table_with_metadata reader::impl::read_stripes(
+  uint64_t rows_to_skip,
+  size_type rows_to_read,
+  std::vector<metadata::stripe_source_mapping> const& selected_stripes)
+{
   std::vector<std::vector<column_buffer>> out_buffers(_selected_columns.num_levels());
   std::vector<std::unique_ptr<column>> out_columns;
   table_metadata out_metadata;
@@ -990,10 +1214,6 @@ table_with_metadata reader::impl::read(uint64_t skip_rows,
   out_metadata.user_data = {out_metadata.per_file_user_data[0].begin(),
                             out_metadata.per_file_user_data[0].end()};
 
-  // Select only stripes required (aka row groups)
-  auto const [rows_to_skip, rows_to_read, selected_stripes] =
-    _metadata.select_stripes(stripes, skip_rows, num_rows_opt, _stream);
-
   // If no rows or stripes to read, return empty columns
   if (rows_to_read == 0 || selected_stripes.empty()) {
     std::transform(_selected_columns.levels[0].begin(),
@@ -1013,7 +1233,7 @@ table_with_metadata reader::impl::read(uint64_t skip_rows,
   }
 
   // Set up table for converting timestamp columns from local to UTC time
-  auto const tz_table = [&, &selected_stripes = selected_stripes] {
+  auto const tz_table = [&] {
     auto const has_timestamp_column = std::any_of(
       _selected_columns.levels.cbegin(), _selected_columns.levels.cend(), [&](auto const& col_lvl) {
         return std::any_of(col_lvl.cbegin(), col_lvl.cend(), [&](auto const& col_meta) {
@@ -1033,6 +1253,8 @@ table_with_metadata reader::impl::read(uint64_t skip_rows,
   // Iterates through levels of nested columns, child column will be one level down
   // compared to parent column.
   auto& col_meta = *_col_meta;
+  // Reset the column details of the previously read stripes
+  col_meta = reader_column_meta{};
   for (std::size_t level = 0; level < _selected_columns.num_levels(); ++level) {
     auto& columns_level = _selected_columns.levels[level];
     // Association between each ORC column and its cudf::column
@@ -1042,26 +1264,12 @@ table_with_metadata reader::impl::read(uint64_t skip_rows,
     // Get a list of column data types
     std::vector<data_type> column_types;
     for (auto& col : columns_level) {
-      auto col_type = to_cudf_type(_metadata.get_col_type(col.id).kind,
-                                   _use_np_dtypes,
-                                   _timestamp_type.id(),
-                                   to_cudf_decimal_type(_decimal128_columns, _metadata, col.id));
-      CUDF_EXPECTS(col_type != type_id::EMPTY, "Unknown type");
-      if (col_type == type_id::DECIMAL32 or col_type == type_id::DECIMAL64 or
-          col_type == type_id::DECIMAL128) {
-        // sign of the scale is changed since cuDF follows c++ libraries like CNL
-        // which uses negative scaling, but liborc and other libraries
-        // follow positive scaling.
-        auto const scale =
-          -static_cast<size_type>(_metadata.get_col_type(col.id).scale.value_or(0));
-        column_types.emplace_back(col_type, scale);
-      } else {
-        column_types.emplace_back(col_type);
-      }
+      auto const col_type = column_data_type(col.id);
+      column_types.push_back(col_type);
 
       // Map each ORC column to its column
       col_meta.orc_col_map[level][col.id] = column_types.size() - 1;
-      if (col_type == type_id::LIST or col_type == type_id::STRUCT) {
+      if (col_type.id() == type_id::LIST or col_type.id() == type_id::STRUCT) {
         nested_col.emplace_back(col);
       }
     }
@@ -1140,6 +1348,12 @@ table_with_metadata reader::impl::read(uint64_t skip_rows,
           cudf::util::round_up_safe(total_data_size, BUFFER_PADDING_MULTIPLE), _stream);
         auto dst_base = static_cast<uint8_t*>(stripe_data.back().data());
 
+        auto& source = _metadata.per_file_metadata[stripe_source_mapping.source_idx].source;
+
+        // Host reads of this stripe, issued through a single vectored read
+        std::vector<datasource::range> host_ranges;
+        std::vector<uint8_t*> host_range_dsts;
+
         // Coalesce consecutive streams into one read
         while (not is_stripe_data_empty and stream_count < stream_info.size()) {
           auto const d_dst  = dst_base + stream_info[stream_count].dst_pos;
@@ -1152,23 +1366,28 @@ table_with_metadata reader::impl::read(uint64_t skip_rows,
             len += stream_info[stream_count].length;
             stream_count++;
           }
-          if (_metadata.per_file_metadata[stripe_source_mapping.source_idx]
-                .source->is_device_read_preferred(len)) {
+          if (source->is_device_read_preferred(len)) {
             read_tasks.push_back(
-              std::pair(_metadata.per_file_metadata[stripe_source_mapping.source_idx]
-                          .source->device_read_async(offset, len, d_dst, _stream),
-                        len));
+              std::pair(source->device_read_async(offset, len, d_dst, _stream), len));
 
           } else {
-            auto const buffer =
-              _metadata.per_file_metadata[stripe_source_mapping.source_idx].source->host_read(
-                offset, len);
-            CUDF_EXPECTS(buffer->size() == len, "Unexpected discrepancy in bytes read.");
-            CUDF_CUDA_TRY(
-              cudaMemcpyAsync(d_dst, buffer->data(), len, cudaMemcpyDefault, _stream.value()));
-            _stream.synchronize();
+            host_ranges.push_back({offset, len});
+            host_range_dsts.push_back(d_dst);
           }
         }
+        if (not host_ranges.empty()) {
+          auto const buffers = source->host_read_ranges(host_ranges);
+          for (std::size_t r = 0; r < buffers.size(); ++r) {
+            CUDF_EXPECTS(buffers[r]->size() == host_ranges[r].size,
+                         "Unexpected discrepancy in bytes read.");
+            CUDF_CUDA_TRY(cudaMemcpyAsync(host_range_dsts[r],
+                                          buffers[r]->data(),
+                                          buffers[r]->size(),
+                                          cudaMemcpyDefault,
+                                          _stream.value()));
+          }
+          _stream.synchronize();
+        }
 
         auto const num_rows_per_stripe = stripe_info->numberOfRows;
         auto const rowgroup_id         = num_rowgroups;
@@ -1255,6 +1474,10 @@ table_with_metadata reader::impl::read(uint64_t skip_rows,
     }
     // Setup row group descriptors if using indexes
     if (_metadata.per_file_metadata[0].ps.compression != orc::NONE) {
+      _total_comp_size += std::accumulate(
+        stripe_data.cbegin(), stripe_data.cend(), std::size_t{0}, [](auto sum, auto& data) {
+          return sum + data.size();
+        });
       auto decomp_data = decompress_stripe_data(*_metadata.per_file_metadata[0].decompressor,
                                                 stripe_data,
                                                 stream_info,
@@ -1264,6 +1487,7 @@ table_with_metadata reader::impl::read(uint64_t skip_rows,
                                                 _metadata.get_row_index_stride(),
                                                 level == 0,
                                                 _stream);
+      _total_decomp_size += decomp_data.size();
       stripe_data.clear();
       stripe_data.push_back(std::move(decomp_data));
     } else {
@@ -1342,9 +1566,20 @@ table_with_metadata reader::impl::read(uint64_t skip_rows,
       return make_column(col_buffer, &out_metadata.schema_info.back(), std::nullopt, _stream);
     });
 
-  return {std::make_unique<table>(std::move(out_columns)), std::move(out_metadata)};
+  auto out_table = std::make_unique<table>(std::move(out_columns));
+  if (_filter.has_value()) {
+    auto predicate = cudf::detail::compute_column(
+      *out_table, _filter.value().get(), _stream, rmm::mr::get_current_device_resource());
+    CUDF_EXPECTS(predicate->view().type().id() == type_id::BOOL8,
+                 "Predicate filter should return a boolean");
+    out_table = cudf::detail::apply_boolean_mask(*out_table, *predicate, _stream, _mr);
+  }
+  return {std::move(out_table), std::move(out_metadata)};
 }
 
+// Forward to implementation
+reader::reader() = default;
+
 // Forward to implementation
 reader::reader(std::vector<std::unique_ptr<cudf::io::datasource>>&& sources,
                orc_reader_options const& options,
@@ -1360,7 +1595,31 @@ reader::~reader() = default;
 // Forward to implementation
 table_with_metadata reader::read(orc_reader_options const& options)
 {
-  return _impl->read(options.get_skip_rows(), options.get_num_rows(), options.get_stripes());
+  return _impl->read(options.get_skip_rows(),
+                     options.get_num_rows(),
+                     options.get_stripes(),
+                     options.get_filter());
+}
+
+// Forward to implementation
+chunked_reader::chunked_reader(std::size_t chunk_read_limit,
+                               std::size_t pass_read_limit,
+                               std::vector<std::unique_ptr<cudf::io::datasource>>&& sources,
+                               orc_reader_options const& options,
+                               rmm::cuda_stream_view stream,
+                               rmm::mr::device_memory_resource* mr)
+{
+  _impl = std::make_unique<impl>(
+    chunk_read_limit, pass_read_limit, std::move(sources), options, stream, mr);
 }
 
+// Destructor within this translation unit
+chunked_reader::~chunked_reader() = default;
+
+// Forward to implementation
+bool chunked_reader::has_next() const { return _impl->has_next(); }
+
+// Forward to implementation
+table_with_metadata chunked_reader::read_chunk() const { return _impl->read_chunk(); }
+
 }  // namespace cudf::io::detail::orc
@@ -29,7 +29,9 @@
 
 #include <rmm/cuda_stream_view.hpp>
 
+#include <functional>
 #include <memory>
+#include <optional>
 #include <string>
 #include <utility>
 #include <vector>
@@ -59,19 +61,99 @@ class reader::impl {
                 rmm::cuda_stream_view stream,
                 rmm::mr::device_memory_resource* mr);
 
+  /**
+   * @brief Constructor from a dataset source with reader options and read size limits, used by
+   * the chunked reader.
+   *
+   * The stripes to read are selected on construction, even if both limits are `0`.
+   *
+   * @param chunk_read_limit Limit on total number of bytes to be returned per read,
+   *        or `0` if there is no limit
+   * @param pass_read_limit Limit on the memory used to read and decompress the stripe data of
+   *        each read, or `0` if there is no limit
+   * @param sources Dataset sources
+   * @param options Settings for controlling reading behavior
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   * @param mr Device memory resource to use for device memory allocation
+   */
+  explicit impl(std::size_t chunk_read_limit,
+                std::size_t pass_read_limit,
+                std::vector<std::unique_ptr<datasource>>&& sources,
+                orc_reader_options const& options,
+                rmm::cuda_stream_view stream,
+                rmm::mr::device_memory_resource* mr);
+
   /**
    * @brief Read an entire set or a subset of data and returns a set of columns
    *
    * @param skip_rows Number of rows to skip from the start
    * @param num_rows_opt Optional number of rows to read
    * @param stripes Indices of individual stripes to load if non-empty
+   * @param filter Optional AST expression to filter output rows
    * @return The set of columns along with metadata
    */
   table_with_metadata read(uint64_t skip_rows,
                            std::optional<size_type> const& num_rows_opt,
-                           std::vector<std::vector<size_type>> const& stripes);
+                           std::vector<std::vector<size_type>> const& stripes,
+                           std::optional<std::reference_wrapper<ast::expression const>> filter);
+
+  /**
+   * @copydoc cudf::io::chunked_orc_reader::has_next
+   */
+  [[nodiscard]] bool has_next() const;
+
+  /**
+   * @copydoc cudf::io::chunked_orc_reader::read_chunk
+   */
+  table_with_metadata read_chunk();
 
  private:
+  /**
+   * @brief A selected stripe, with the sizes used to plan the chunks
+   */
+  struct selected_stripe {
+    int source_idx;
+    std::pair<StripeInformation const*, StripeFooter const*> stripe;
+    std::size_t stream_size;            // Total size of the streams of the selected columns
+    std::size_t var_width_stream_size;  // Size of the streams of variable-width output columns
+  };
+
+  /**
+   * @brief Selects the stripes and rows to read, and resets the chunked reading state.
+   *
+   * @param skip_rows Number of rows to skip from the start
+   * @param num_rows_opt Optional number of rows to read
+   * @param stripes Indices of individual stripes to load if non-empty
+   * @param filter Optional AST expression to filter output rows
+   */
+  void prepare_stripes(uint64_t skip_rows,
+                       std::optional<size_type> const& num_rows_opt,
+                       std::vector<std::vector<size_type>> const& stripes,
+                       std::optional<std::reference_wrapper<ast::expression const>> filter);
+
+  /**
+   * @brief Returns the index of the stripe after the last stripe of the next chunk
+   */
+  [[nodiscard]] std::size_t next_chunk_end() const;
+
+  /**
+   * @brief Reads, decompresses and decodes a set of stripes
+   *
+   * @param rows_to_skip Number of rows to skip from the start of the first stripe
+   * @param rows_to_read Number of rows to read
+   * @param selected_stripes Stripes to read, grouped by source
+   * @return The set of columns along with metadata
+   */
+  table_with_metadata read_stripes(
+    uint64_t rows_to_skip,
+    size_type rows_to_read,
+    std::vector<metadata::stripe_source_mapping> const& selected_stripes);
+
+  /**
+   * @brief Returns the output data type of a column
+   */
+  [[nodiscard]] data_type column_data_type(size_type orc_col_id) const;
+
   rmm::cuda_stream_view const _stream;
   rmm::mr::device_memory_resource* const _mr;
 
@@ -84,6 +166,23 @@ class reader::impl {
   bool const _use_np_dtypes;        // Enable or disable the conversion to numpy-compatible dtypes
   std::vector<std::string> const _decimal128_columns;   // Control decimals conversion
   std::unique_ptr<reader_column_meta> const _col_meta;  // Track of orc mapping and child details
+
+  std::size_t const _chunk_read_limit;  // Limit on the size of the output of each read
+  std::size_t const _pass_read_limit;   // Limit on the size of the stripe data of each read
+
+  // Selected stripes and rows, and the state of the chunked reading
+  std::vector<selected_stripe> _stripes;
+  uint64_t _rows_to_skip   = 0;
+  uint64_t _rows_remaining = 0;
+  std::optional<std::reference_wrapper<ast::expression const>> _filter;
+  std::size_t _next_stripe = 0;
+  bool _has_read_chunk     = false;
+
+  // Estimated output size of the fixed-width columns, in bits per row
+  std::size_t _row_fixed_width_bits = 0;
+  // Total compressed and decompressed sizes of the stripe data read so far
+  std::size_t _total_comp_size   = 0;
+  std::size_t _total_decomp_size = 0;
 };
 
 }  // namespace cudf::io::detail::orc
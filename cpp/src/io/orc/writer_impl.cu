@@ -19,6 +19,7 @@
  * @brief cuDF-IO ORC writer class implementation
  */
 
+#include "bloom_filter.hpp"
 #include "writer_impl.hpp"
 
 #include <io/comp/nvcomp_adapter.hpp>
@@ -216,9 +217,18 @@ class orc_column_view {
                                                : to_clockscale(col.type().id())},
       _precision{metadata.is_decimal_precision_set() ? metadata.get_decimal_precision()
                                                      : orc_precision(col.type().id())},
-      name{metadata.get_name()}
+      name{metadata.get_name()},
+      _bloom_filter{metadata.is_enabled_bloom_filter()}
   {
     if (metadata.is_nullability_defined()) { nullable_from_metadata = metadata.nullable(); }
+    if (_bloom_filter) {
+      auto const id = col.type().id();
+      CUDF_EXPECTS((cudf::is_integral(col.type()) and id != type_id::BOOL8) or
+                     cudf::is_floating_point(col.type()) or id == type_id::STRING or
+                     id == type_id::TIMESTAMP_DAYS,
+                   "Bloom filters are only supported for integral, floating point, string and "
+                   "date columns");
+    }
     if (parent != nullptr) {
       parent->add_child(_index);
       _parent_index = parent->index();
@@ -298,6 +308,7 @@ class orc_column_view {
   [[nodiscard]] auto orc_kind() const noexcept { return _type_kind; }
   [[nodiscard]] auto orc_encoding() const noexcept { return _encoding_kind; }
   [[nodiscard]] std::string_view orc_name() const noexcept { return name; }
+  [[nodiscard]] bool bloom_filter() const noexcept { return _bloom_filter; }
 
  private:
   column_view cudf_column;
@@ -328,6 +339,10 @@ class orc_column_view {
 
   std::optional<bool> nullable_from_metadata;
   std::vector<uint32_t> children;
+
+  // Whether Bloom filters are written for the rowgroups of the column
+  bool _bloom_filter = false;
+
   std::optional<uint32_t> _parent_index;
 };
 
@@ -1504,6 +1519,65 @@ void write_index_stream(int32_t stripe_id,
   stripe->indexLength += pbw.size();
 }
 
+/**
+ * @brief Write the Bloom filter stream of the specified column in a stripe
+ *
+ * The stream holds one filter per rowgroup of the stripe. When the file is compressed, the stream
+ * is written as uncompressed blocks that are no larger than the compression block size.
+ *
+ * @param[in] stripe_id Stripe's identifier
+ * @param[in] bloom_col_idx Index of the column among the columns with Bloom filters
+ * @param[in] segmentation stripe and rowgroup ranges
+ * @param[in] bloom_filters Bloom filters of the rowgroups of the columns that have them
+ * @param[in,out] stripe Stream's parent stripe
+ * @param[in] compression_kind The compression kind
+ * @param[in] compression_blocksize The block size used for compression
+ * @param[in] out_sink Sink for writing data
+ * @return Description of the written stream
+ */
+Stream write_bloom_filter_stream(int32_t stripe_id,
+                                 size_t bloom_col_idx,
+                                 file_segmentation const& segmentation,
+                                 rowgroup_bloom_filters const& bloom_filters,
+                                 StripeInformation* stripe,
+                                 CompressionKind compression_kind,
+                                 size_t compression_blocksize,
+                                 std::unique_ptr<data_sink> const& out_sink)
+{
+  auto const num_words = bloom_filters.num_words();
+
+  ProtobufWriter pbw;
+  auto const& rowgroups_range = segmentation.stripes[stripe_id];
+  std::for_each(rowgroups_range.cbegin(), rowgroups_range.cend(), [&](auto rowgroup) {
+    auto const bitset = bloom_filters.bitsets.data() +
+                        (bloom_col_idx * segmentation.num_rowgroups() + rowgroup) * num_words;
+    pbw.put_bloom_filter(
+      bloom_filters.num_hash_functions,
+      {reinterpret_cast<uint8_t const*>(bitset), num_words * sizeof(uint32_t)});
+  });
+
+  size_t length = 0;
+  if (compression_kind == NONE) {
+    out_sink->host_write(pbw.data(), pbw.size());
+    length = pbw.size();
+  } else {
+    for (size_t offset = 0; offset < pbw.size(); offset += compression_blocksize) {
+      auto const block_len  = std::min(compression_blocksize, pbw.size() - offset);
+      auto const uncomp_len = static_cast<uint32_t>(block_len * 2 + 1);
+
+      uint8_t const header[block_header_size] = {static_cast<uint8_t>(uncomp_len >> 0),
+                                                 static_cast<uint8_t>(uncomp_len >> 8),
+                                                 static_cast<uint8_t>(uncomp_len >> 16)};
+      out_sink->host_write(header, block_header_size);
+      out_sink->host_write(pbw.data() + offset, block_len);
+      length += block_header_size + block_len;
+    }
+  }
+  stripe->indexLength += length;
+
+  return Stream{BLOOM_FILTER_UTF8, bloom_filters.column_indices[bloom_col_idx] + 1, length};
+}
+
 /**
  * @brief Write the specified column's data streams
  *
@@ -2018,6 +2092,47 @@ auto set_rowgroup_char_counts(orc_table_view& orc_table,
   return h_counts;
 }
 
+/**
+ * @brief Builds the Bloom filters of each rowgroup of the columns that have them enabled.
+ *
+ * As in the ORC Java writer, each filter is sized for `row_index_stride` values at the default
+ * false positive probability.
+ */
+rowgroup_bloom_filters build_rowgroup_bloom_filters(
+  orc_table_view const& orc_table,
+  device_2dspan<rowgroup_rows const> rowgroup_bounds,
+  size_type row_index_stride,
+  rmm::cuda_stream_view stream)
+{
+  rowgroup_bloom_filters filters;
+  for (auto const& column : orc_table.columns) {
+    if (column.bloom_filter()) { filters.column_indices.push_back(column.index()); }
+  }
+  if (filters.column_indices.empty() or rowgroup_bounds.count() == 0) { return filters; }
+
+  filters.num_bits           = bloom_filter_num_bits(row_index_stride, bloom_filter_default_fpp);
+  filters.num_hash_functions = bloom_filter_num_hash_functions(row_index_stride, filters.num_bits);
+
+  auto const num_rowgroups = rowgroup_bounds.size().first;
+  rmm::device_uvector<uint32_t> bitsets(
+    filters.column_indices.size() * num_rowgroups * filters.num_words(), stream);
+  CUDF_CUDA_TRY(
+    cudaMemsetAsync(bitsets.data(), 0, bitsets.size() * sizeof(uint32_t), stream.value()));
+  auto const d_column_indices = cudf::detail::make_device_uvector_async(
+    filters.column_indices, stream, rmm::mr::get_current_device_resource());
+
+  gpu::rowgroup_bloom_filters(bitsets,
+                              filters.num_bits,
+                              filters.num_hash_functions,
+                              orc_table.d_columns,
+                              rowgroup_bounds,
+                              d_column_indices,
+                              stream);
+
+  filters.bitsets = cudf::detail::make_std_vector_sync(bitsets, stream);
+  return filters;
+}
+
 // Holds the stripe dictionary descriptors and dictionary buffers.
 struct stripe_dictionaries {
   hostdevice_2dvector<gpu::stripe_dictionary> views;       // descriptors [string_column][stripe]
@@ -2191,6 +2306,9 @@ auto convert_table_to_orc_data(table_view const& input,
   auto segmentation =
     calculate_segmentation(orc_table.columns, std::move(rowgroup_bounds), max_stripe_size);
 
+  auto bloom_filters =
+    build_rowgroup_bloom_filters(orc_table, segmentation.rowgroups, row_index_stride, stream);
+
   auto stripe_dicts    = build_dictionaries(orc_table, segmentation, stream);
   auto dec_chunk_sizes = decimal_chunk_sizes(orc_table, segmentation, stream);
 
@@ -2225,6 +2343,7 @@ auto convert_table_to_orc_data(table_view const& input,
                       cudf::detail::hostdevice_vector<compression_result>{},  // comp_results
                       std::move(strm_descs),
                       intermediate_statistics{stream},
+                      std::move(bloom_filters),
                       std::optional<writer_compression_statistics>{},
                       std::move(streams),
                       std::move(stripes),
@@ -2305,6 +2424,7 @@ auto convert_table_to_orc_data(table_view const& input,
                     std::move(comp_results),
                     std::move(strm_descs),
                     std::move(intermediate_stats),
+                    std::move(bloom_filters),
                     std::move(compression_stats),
                     std::move(streams),
                     std::move(stripes),
@@ -2382,6 +2502,7 @@ void writer::impl::write(table_view const& input)
                          comp_results,
                          strm_descs,
                          intermediate_stats,
+                         bloom_filters,
                          compression_stats,
                          streams,
                          stripes,
@@ -2416,6 +2537,7 @@ void writer::impl::write(table_view const& input)
                          comp_results,
                          strm_descs,
                          intermediate_stats.rowgroup_blobs,
+                         bloom_filters,
                          streams,
                          stripes,
                          bounce_buffer);
@@ -2449,6 +2571,7 @@ void writer::impl::write_orc_data_to_sink(encoded_data const& enc_data,
                                           host_span<compression_result const> comp_results,
                                           host_2dspan<gpu::StripeStream const> strm_descs,
                                           host_span<ColStatsBlob const> rg_stats,
+                                          rowgroup_bloom_filters const& bloom_filters,
                                           orc_streams& streams,
                                           host_span<StripeInformation> stripes,
                                           host_span<uint8_t> bounce_buffer)
@@ -2480,6 +2603,20 @@ void writer::impl::write_orc_data_to_sink(encoded_data const& enc_data,
                          _out_sink);
     }
 
+    // Bloom filter streams are also part of the index, following the row index streams
+    std::vector<Stream> bloom_filter_streams;
+    for (size_t bloom_col_idx = 0; bloom_col_idx < bloom_filters.column_indices.size();
+         ++bloom_col_idx) {
+      bloom_filter_streams.push_back(write_bloom_filter_stream(stripe_id,
+                                                               bloom_col_idx,
+                                                               segmentation,
+                                                               bloom_filters,
+                                                               &stripe,
+                                                               _compression_kind,
+                                                               _compression_blocksize,
+                                                               _out_sink));
+    }
+
     // Column data consisting one or more separate streams
     for (auto const& strm_desc : strm_descs[stripe_id]) {
       write_tasks.push_back(write_data_stream(
@@ -2496,7 +2633,11 @@ void writer::impl::write_orc_data_to_sink(encoded_data const& enc_data,
 
     // Write stripefooter consisting of stream information
     StripeFooter sf;
-    sf.streams = streams;
+    std::vector<Stream> const& stripe_streams = streams;
+    sf.streams.assign(stripe_streams.cbegin(), stripe_streams.cbegin() + num_index_streams);
+    sf.streams.insert(sf.streams.end(), bloom_filter_streams.cbegin(), bloom_filter_streams.cend());
+    sf.streams.insert(
+      sf.streams.end(), stripe_streams.cbegin() + num_index_streams, stripe_streams.cend());
     sf.columns.resize(orc_table.num_columns() + 1);
     sf.columns[0].kind = DIRECT;
     for (size_t i = 1; i < sf.columns.size(); ++i) {
@@ -144,6 +144,18 @@ struct encoded_data {
   hostdevice_2dvector<gpu::encoder_chunk_streams> streams;  // streams of encoded data, per chunk
 };
 
+/**
+ * @brief Bloom filters of each rowgroup of the columns that have them.
+ */
+struct rowgroup_bloom_filters {
+  std::vector<uint32_t> column_indices;  // indices of the columns with Bloom filters
+  uint32_t num_bits           = 0;       // number of bits in each filter
+  uint32_t num_hash_functions = 0;       // number of hash functions of each filter
+  std::vector<uint32_t> bitsets;         // filter words [column][rowgroup][word]
+
+  [[nodiscard]] auto num_words() const noexcept { return num_bits / 32; }
+};
+
 /**
  * @brief Dictionary data for string columns and their device views, per column.
  */
@@ -300,6 +312,7 @@ class writer::impl {
    * @param[in] comp_results Status of data compression
    * @param[in] strm_descs List of stream descriptors
    * @param[in] rg_stats row group level statistics
+   * @param[in] bloom_filters Bloom filters of the rowgroups of the columns that have them
    * @param[in,out] streams List of stream descriptors
    * @param[in,out] stripes List of stripe description
    * @param[out] bounce_buffer Temporary host output buffer
@@ -311,6 +324,7 @@ class writer::impl {
                               host_span<compression_result const> comp_results,
                               host_2dspan<gpu::StripeStream const> strm_descs,
                               host_span<ColStatsBlob const> rg_stats,
+                              rowgroup_bloom_filters const& bloom_filters,
                               orc_streams& streams,
                               host_span<StripeInformation> stripes,
                               host_span<uint8_t> bounce_buffer);
@@ -0,0 +1,169 @@
+/*
+ * Copyright (c) 2023, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <io/utilities/host_write_tasks.hpp>
+
+#include <cudf/detail/contiguous_split.hpp>
+#include <cudf/detail/utilities/crc32c.hpp>
+#include <cudf/detail/utilities/pinned_host_vector.hpp>
+#include <cudf/io/detail/packed.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/span.hpp>
+
+#include <rmm/device_buffer.hpp>
+
+#include <algorithm>
+
+namespace cudf {
+namespace io {
+namespace detail {
+namespace packed {
+
+namespace {
+
+constexpr uint32_t packed_magic   = 0x4b505543;  // "CUPK"
+constexpr uint32_t packed_version = 2;           // 2: checksummed metadata after the data
+
+// Size of the chunks copied from the source to the device
+constexpr std::size_t read_chunk_size = 64 * 1024 * 1024;
+
+/**
+ * @brief Fixed-size header at the start of the packed output; followed by the data, then the
+ * metadata.
+ */
+struct file_header_s {
+  uint32_t magic;
+  uint32_t version;
+  uint64_t metadata_size;
+  uint64_t data_size;
+};
+static_assert(sizeof(file_header_s) == 24, "Unexpected packed header size");
+
+}  // namespace
+
+void write_packed(table_view const& input,
+                  data_sink& sink,
+                  std::size_t bounce_buffer_size,
+                  rmm::cuda_stream_view stream,
+                  rmm::mr::device_memory_resource* mr)
+{
+  auto packer   = chunked_pack::create(input, bounce_buffer_size, mr);
+  auto metadata = packer->build_metadata();
+  // No metadata is built for a table without columns
+  if (metadata == nullptr) { metadata = std::make_unique<std::vector<uint8_t>>(); }
+
+  file_header_s const header{
+    packed_magic, packed_version, metadata->size(), packer->get_total_contiguous_size()};
+  sink.host_write(&header, sizeof(header));
+
+  rmm::device_buffer bounce_buffer(bounce_buffer_size, stream, mr);
+  auto const device_span = cudf::device_span<uint8_t>(
+    static_cast<uint8_t*>(bounce_buffer.data()), bounce_buffer.size());
+  auto const use_device_write = sink.is_device_write_preferred(bounce_buffer_size);
+
+  // Host writes alternate between two host buffers, so that packing and copying a chunk overlaps
+  // with writing the previous chunk to the sink; pending writes are waited for on every exit path,
+  // before the host buffers are freed
+  constexpr int num_host_buffers = 2;
+  auto host_buffer               = cudf::detail::pinned_host_vector<uint8_t>(
+    use_device_write ? 0 : num_host_buffers * bounce_buffer_size);
+  host_write_tasks<num_host_buffers> host_buffer_writes;
+  int next_host_buffer   = 0;
+  uint32_t data_checksum = 0;
+
+  while (packer->has_next()) {
+    // `chunked_pack` packs on the default stream
+    auto const bytes_copied = packer->next(device_span);
+    if (use_device_write) {
+      sink.device_write(bounce_buffer.data(), bytes_copied, stream);
+      continue;
+    }
+    auto& write_task = host_buffer_writes[next_host_buffer];
+    if (write_task.valid()) { write_task.get(); }
+    auto const host_bfr = host_buffer.data() + next_host_buffer * bounce_buffer_size;
+    CUDF_CUDA_TRY(cudaMemcpyAsync(
+      host_bfr, bounce_buffer.data(), bytes_copied, cudaMemcpyDefault, stream.value()));
+    stream.synchronize();
+    write_task       = sink.host_write_async(host_bfr, bytes_copied);
+    data_checksum    = cudf::detail::crc32c({host_bfr, bytes_copied}, data_checksum);
+    next_host_buffer = (next_host_buffer + 1) % num_host_buffers;
+  }
+  host_buffer_writes.get();
+
+  // The data is only checksummed when it is copied through host memory
+  if (not use_device_write && not metadata->empty()) {
+    cudf::detail::set_packed_data_checksum(*metadata, data_checksum);
+  }
+  sink.host_write(metadata->data(), metadata->size());
+  sink.flush();
+}
+
+packed_columns read_packed(datasource& source,
+                           rmm::cuda_stream_view stream,
+                           rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(source.size() >= sizeof(file_header_s), "Incorrect data source");
+  file_header_s header;
+  auto const header_buffer = source.host_read(0, sizeof(header));
+  std::copy_n(header_buffer->data(), sizeof(header), reinterpret_cast<uint8_t*>(&header));
+  CUDF_EXPECTS(header.magic == packed_magic, "Not a packed table");
+  CUDF_EXPECTS(header.version == packed_version, "Unsupported packed table version");
+  CUDF_EXPECTS(header.metadata_size <= source.size() - sizeof(header) &&
+                 header.data_size <= source.size() - sizeof(header) - header.metadata_size,
+               "Incorrect packed table sizes");
+
+  auto const data_offset = sizeof(header);
+  auto const metadata_buffer =
+    source.host_read(data_offset + header.data_size, header.metadata_size);
+  auto metadata = std::make_unique<std::vector<uint8_t>>(
+    metadata_buffer->data(), metadata_buffer->data() + metadata_buffer->size());
+  if (not metadata->empty()) { cudf::detail::validate_packed(*metadata, header.data_size); }
+  auto const expected_checksum =
+    metadata->empty() ? std::nullopt : cudf::detail::packed_data_checksum(*metadata);
+
+  auto gpu_data  = std::make_unique<rmm::device_buffer>(header.data_size, stream, mr);
+  auto const dst = static_cast<uint8_t*>(gpu_data->data());
+  if (header.data_size != 0 && source.is_device_read_preferred(header.data_size)) {
+    auto const bytes_read = source.device_read(data_offset, header.data_size, dst, stream);
+    CUDF_EXPECTS(bytes_read == header.data_size, "Unexpected end of packed data");
+  } else {
+    // Memory mapped sources return views of the mapping, so each chunk is copied to the device
+    // without an intermediate host copy
+    uint32_t data_checksum = 0;
+    for (std::size_t offset = 0; offset < header.data_size; offset += read_chunk_size) {
+      auto const size   = std::min<std::size_t>(read_chunk_size, header.data_size - offset);
+      auto const buffer = source.host_read(data_offset + offset, size);
+      CUDF_EXPECTS(buffer->size() == size, "Unexpected end of packed data");
+      CUDF_CUDA_TRY(cudaMemcpyAsync(
+        dst + offset, buffer->data(), size, cudaMemcpyDefault, stream.value()));
+      // Checksum the chunk while it is copied
+      if (expected_checksum.has_value()) {
+        data_checksum = cudf::detail::crc32c({buffer->data(), size}, data_checksum);
+      }
+      stream.synchronize();
+    }
+    CUDF_EXPECTS(not expected_checksum.has_value() || expected_checksum.value() == data_checksum,
+                 "Packed data checksum mismatch");
+  }
+  stream.synchronize();
+
+  return packed_columns{std::move(metadata), std::move(gpu_data)};
+}
+
+}  // namespace packed
+}  // namespace detail
+}  // namespace io
+}  // namespace cudf
@@ -0,0 +1,184 @@
+/*
+ * Copyright (c) 2023, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/types.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @file bloom_filter.hpp
+ * @brief Split block Bloom filters as specified by the Parquet format
+ *
+ * The filter is an array of 256-bit blocks. Each value is hashed with 64-bit xxHash (seed 0) of
+ * its plain encoding; the upper 32 bits of the hash select a block and the lower 32 bits set one
+ * bit in each of the eight 32-bit words of the block.
+ */
+
+namespace cudf {
+namespace io {
+namespace parquet {
+
+constexpr uint32_t bloom_filter_block_words = 8;
+constexpr uint32_t bloom_filter_block_bytes = bloom_filter_block_words * sizeof(uint32_t);
+constexpr uint32_t bloom_filter_min_bytes   = bloom_filter_block_bytes;
+constexpr uint32_t bloom_filter_max_bytes   = 128 * 1024 * 1024;
+
+/**
+ * @brief Computes the 64-bit xxHash of a byte buffer with seed 0
+ */
+CUDF_HOST_DEVICE inline uint64_t bloom_filter_hash(uint8_t const* data, size_t size)
+{
+  constexpr uint64_t prime1 = 0x9e3779b185ebca87ul;
+  constexpr uint64_t prime2 = 0xc2b2ae3d27d4eb4ful;
+  constexpr uint64_t prime3 = 0x165667b19e3779f9ul;
+  constexpr uint64_t prime4 = 0x85ebca77c2b2ae63ul;
+  constexpr uint64_t prime5 = 0x27d4eb2f165667c5ul;
+
+  auto const rotl   = [](uint64_t x, int r) { return (x << r) | (x >> (64 - r)); };
+  auto const load32 = [&](size_t offset) {
+    return static_cast<uint64_t>(data[offset]) | (static_cast<uint64_t>(data[offset + 1]) << 8) |
+           (static_cast<uint64_t>(data[offset + 2]) << 16) |
+           (static_cast<uint64_t>(data[offset + 3]) << 24);
+  };
+  auto const load64 = [&](size_t offset) { return load32(offset) | (load32(offset + 4) << 32); };
+  auto const mix    = [&](uint64_t acc, uint64_t input) {
+    return rotl(acc + input * prime2, 31) * prime1;
+  };
+  auto const merge  = [&](uint64_t acc, uint64_t val) {
+    return (acc ^ mix(0, val)) * prime1 + prime4;
+  };
+
+  size_t offset = 0;
+  uint64_t h64;
+  if (size >= 32) {
+    uint64_t v1 = prime1 + prime2;
+    uint64_t v2 = prime2;
+    uint64_t v3 = 0;
+    uint64_t v4 = -prime1;
+    for (; offset + 32 <= size; offset += 32) {
+      v1 = mix(v1, load64(offset));
+      v2 = mix(v2, load64(offset + 8));
+      v3 = mix(v3, load64(offset + 16));
+      v4 = mix(v4, load64(offset + 24));
+    }
+    h64 = rotl(v1, 1) + rotl(v2, 7) + rotl(v3, 12) + rotl(v4, 18);
+    h64 = merge(h64, v1);
+    h64 = merge(h64, v2);
+    h64 = merge(h64, v3);
+    h64 = merge(h64, v4);
+  } else {
+    h64 = prime5;
+  }
+  h64 += size;
+
+  for (; offset + 8 <= size; offset += 8) {
+    h64 ^= mix(0, load64(offset));
+    h64 = rotl(h64, 27) * prime1 + prime4;
+  }
+  if (offset + 4 <= size) {
+    h64 ^= load32(offset) * prime1;
+    h64 = rotl(h64, 23) * prime2 + prime3;
+    offset += 4;
+  }
+  for (; offset < size; ++offset) {
+    h64 ^= data[offset] * prime5;
+    h64 = rotl(h64, 11) * prime1;
+  }
+
+  h64 ^= h64 >> 33;
+  h64 *= prime2;
+  h64 ^= h64 >> 29;
+  h64 *= prime3;
+  h64 ^= h64 >> 32;
+  return h64;
+}
+
+/**
+ * @brief Returns the bit set in the given word of a block for the hash of a value
+ */
+CUDF_HOST_DEVICE inline uint32_t bloom_filter_mask(uint64_t hash, uint32_t word)
+{
+  constexpr uint32_t salt[bloom_filter_block_words] = {0x47b6137bU,
+                                                       0x44974d91U,
+                                                       0x8824ad5bU,
+                                                       0xa2b7289dU,
+                                                       0x705495c7U,
+                                                       0x2df1424bU,
+                                                       0x9efc4947U,
+                                                       0x5c6bfb31U};
+  return 1U << ((static_cast<uint32_t>(hash) * salt[word]) >> 27);
+}
+
+/**
+ * @brief Returns the index of the first word of the block selected by the hash of a value
+ *
+ * @param hash Hash of the value
+ * @param num_blocks Number of blocks in the filter
+ */
+CUDF_HOST_DEVICE inline size_t bloom_filter_block(uint64_t hash, size_t num_blocks)
+{
+  return ((hash >> 32) * num_blocks >> 32) * bloom_filter_block_words;
+}
+
+/**
+ * @brief Checks whether a value may be present in a filter
+ *
+ * @param bitset Filter words
+ * @param num_blocks Number of blocks in the filter
+ * @param hash Hash of the value
+ * @return False if the value is definitely absent
+ */
+CUDF_HOST_DEVICE inline bool bloom_filter_check(uint32_t const* bitset,
+                                                size_t num_blocks,
+                                                uint64_t hash)
+{
+  auto const block = bitset + bloom_filter_block(hash, num_blocks);
+  for (uint32_t i = 0; i < bloom_filter_block_words; ++i) {
+    if ((block[i] & bloom_filter_mask(hash, i)) == 0) { return false; }
+  }
+  return true;
+}
+
+/**
+ * @brief Computes the size of a filter for the given number of distinct values
+ *
+ * @param num_distinct Upper bound on the number of distinct values inserted
+ * @param fpp Target false positive probability
+ * @param max_bytes Maximum size of the filter
+ * @return Size in bytes, a multiple of the block size between `bloom_filter_min_bytes` and
+ * `max_bytes`
+ */
+inline uint32_t bloom_filter_size(size_t num_distinct, double fpp, uint32_t max_bytes)
+{
+  // Optimal number of bits for 8 hash functions: -8 * n / ln(1 - fpp^(1/8))
+  auto const num_bits =
+    -8.0 * static_cast<double>(num_distinct) / std::log(1.0 - std::pow(fpp, 1.0 / 8));
+  auto const max_size = std::clamp(max_bytes, bloom_filter_min_bytes, bloom_filter_max_bytes);
+  uint32_t size       = bloom_filter_min_bytes;
+  while (size < max_size && size * 8.0 < num_bits) {
+    size *= 2;
+  }
+  return std::min(size, max_size / bloom_filter_block_bytes * bloom_filter_block_bytes);
+}
+
+}  // namespace parquet
+}  // namespace io
+}  // namespace cudf
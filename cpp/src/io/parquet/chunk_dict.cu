@@ -14,6 +14,7 @@
  * limitations under the License.
  */
 
+#include "bloom_filter.hpp"
 #include "parquet_gpu.cuh"
 
 #include <cudf/detail/iterator.cuh>
@@ -190,6 +191,84 @@ __global__ void __launch_bounds__(block_size)
   }  // while
 }
 
+/**
+ * @brief Hashes the plain encoding of a column value for insertion into a Bloom filter
+ */
+struct bloom_filter_hash_fn {
+  template <typename T>
+  __device__ static uint64_t hash_value(T value)
+  {
+    return bloom_filter_hash(reinterpret_cast<uint8_t const*>(&value), sizeof(T));
+  }
+
+  template <typename T>
+  __device__ uint64_t operator()(column_device_view const& col,
+                                 size_type idx,
+                                 Type physical_type) const
+  {
+    if constexpr (std::is_same_v<T, string_view>) {
+      auto const str = col.element<string_view>(idx);
+      return bloom_filter_hash(reinterpret_cast<uint8_t const*>(str.data()), str.size_bytes());
+    } else if constexpr (cudf::is_fixed_width<T>() and not std::is_same_v<T, bool>) {
+      auto const value = [&]() {
+        if constexpr (cudf::is_fixed_point<T>()) {
+          return col.element<T>(idx).value();
+        } else if constexpr (cudf::is_timestamp<T>()) {
+          return col.element<T>(idx).time_since_epoch().count();
+        } else if constexpr (cudf::is_duration<T>()) {
+          return col.element<T>(idx).count();
+        } else {
+          return col.element<T>(idx);
+        }
+      }();
+      switch (physical_type) {
+        case Type::INT32: return hash_value(static_cast<int32_t>(value));
+        case Type::INT64: return hash_value(static_cast<int64_t>(value));
+        case Type::FLOAT: return hash_value(static_cast<float>(value));
+        case Type::DOUBLE: return hash_value(static_cast<double>(value));
+        default: CUDF_UNREACHABLE("Unsupported physical type for Bloom filter");
+      }
+    } else {
+      CUDF_UNREACHABLE("Unsupported type for Bloom filter");
+    }
+  }
+};
+
+template <int block_size>
+__global__ void __launch_bounds__(block_size)
+  populate_bloom_filters_kernel(cudf::detail::device_2dspan<gpu::PageFragment const> frags)
+{
+  auto col_idx = blockIdx.y;
+  auto block_x = blockIdx.x;
+  auto t       = threadIdx.x;
+  auto frag    = frags[col_idx][block_x];
+  auto chunk   = frag.chunk;
+  auto col     = chunk->col_desc;
+
+  if (chunk->bloom_filter_data == nullptr) { return; }
+
+  size_type start_row = frag.start_row;
+  size_type end_row   = frag.start_row + frag.num_rows;
+
+  // Find the bounds of values in leaf column to be inserted into the filter for current chunk
+  size_type const s_start_value_idx = row_to_value_idx(start_row, *col);
+  size_type const end_value_idx     = row_to_value_idx(end_row, *col);
+
+  column_device_view const& data_col = *col->leaf_column;
+
+  auto const num_blocks = chunk->bloom_filter_size / bloom_filter_block_bytes;
+
+  for (auto val_idx = s_start_value_idx + t; val_idx < end_value_idx; val_idx += block_size) {
+    if (val_idx >= data_col.size() or not data_col.is_valid(val_idx)) { continue; }
+    auto const hash = type_dispatcher(
+      data_col.type(), bloom_filter_hash_fn{}, data_col, val_idx, col->physical_type);
+    auto const block = chunk->bloom_filter_data + bloom_filter_block(hash, num_blocks);
+    for (uint32_t i = 0; i < bloom_filter_block_words; ++i) {
+      atomicOr(block + i, bloom_filter_mask(hash, i));
+    }
+  }
+}
+
 template <int block_size>
 __global__ void __launch_bounds__(block_size)
   collect_map_entries_kernel(device_span<EncColumnChunk> chunks)
@@ -286,6 +365,14 @@ void populate_chunk_hash_maps(cudf::detail::device_2dspan<gpu::PageFragment cons
     <<<dim_grid, DEFAULT_BLOCK_SIZE, 0, stream.value()>>>(frags);
 }
 
+void populate_bloom_filters(cudf::detail::device_2dspan<gpu::PageFragment const> frags,
+                            rmm::cuda_stream_view stream)
+{
+  dim3 const dim_grid(frags.size().second, frags.size().first);
+  populate_bloom_filters_kernel<DEFAULT_BLOCK_SIZE>
+    <<<dim_grid, DEFAULT_BLOCK_SIZE, 0, stream.value()>>>(frags);
+}
+
 void collect_map_entries(device_span<EncColumnChunk> chunks, rmm::cuda_stream_view stream)
 {
   constexpr int block_size = 1024;
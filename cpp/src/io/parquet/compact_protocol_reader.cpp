@@ -23,23 +23,6 @@
 namespace cudf {
 namespace io {
 namespace parquet {
-uint8_t const CompactProtocolReader::g_list2struct[16] = {0,
-                                                          1,
-                                                          2,
-                                                          ST_FLD_BYTE,
-                                                          ST_FLD_DOUBLE,
-                                                          5,
-                                                          ST_FLD_I16,
-                                                          7,
-                                                          ST_FLD_I32,
-                                                          9,
-                                                          ST_FLD_I64,
-                                                          ST_FLD_BINARY,
-                                                          ST_FLD_STRUCT,
-                                                          ST_FLD_MAP,
-                                                          ST_FLD_SET,
-                                                          ST_FLD_LIST};
-
 /**
  * @brief Skips the number of bytes according to the specified struct type
  *
@@ -50,6 +33,15 @@ uint8_t const CompactProtocolReader::g_list2struct[16] = {0,
  */
 bool CompactProtocolReader::skip_struct_field(int t, int depth)
 {
+  if (depth > 10) return false;
+  // Elements of lists, sets and maps are encoded with their own types; booleans take one byte
+  auto const skip_element = [&](int el_type) {
+    if (el_type == ST_FLD_TRUE || el_type == ST_FLD_FALSE) {
+      skip_bytes(1);
+      return true;
+    }
+    return skip_struct_field(el_type, depth + 1);
+  };
   switch (t) {
     case ST_FLD_TRUE:
     case ST_FLD_FALSE: break;
@@ -61,26 +53,27 @@ bool CompactProtocolReader::skip_struct_field(int t, int depth)
     case ST_FLD_BINARY: skip_bytes(get_u32()); break;
     case ST_FLD_LIST:
     case ST_FLD_SET: {
-      int c = getb();
-      int n = c >> 4;
-      if (n == 0xf) n = get_i32();
-      t = g_list2struct[c & 0xf];
-      if (depth > 10) return false;
+      uint8_t el_type;
+      int32_t const n = get_listh(&el_type);
       for (int32_t i = 0; i < n; i++)
-        skip_struct_field(t, depth + 1);
+        if (!skip_element(el_type)) return false;
+    } break;
+    case ST_FLD_MAP: {
+      uint32_t const n = get_u32();
+      if (n == 0) break;
+      int const c = getb();
+      for (uint32_t i = 0; i < n; i++)
+        if (!skip_element(c >> 4) || !skip_element(c & 0xf)) return false;
     } break;
     case ST_FLD_STRUCT:
       for (;;) {
-        int c = getb();
-        t     = c & 0xf;
+        int const c = getb();
         if (!c) break;
-        if (depth > 10) return false;
-        skip_struct_field(t, depth + 1);
+        if ((c >> 4) == 0) get_i16();  // field id in long form
+        if (!skip_struct_field(c & 0xf, depth + 1)) return false;
       }
       break;
-    default:
-      // printf("unsupported skip for type %d\n", t);
-      break;
+    default: return false;
   }
   return true;
 }
@@ -223,6 +216,16 @@ bool CompactProtocolReader::read(RowGroup* r)
 
 bool CompactProtocolReader::read(ColumnChunk* c)
 {
+  if (m_defer_column_metadata) {
+    auto op = std::make_tuple(ParquetFieldString(1, c->file_path),
+                              ParquetFieldInt64(2, c->file_offset),
+                              ParquetFieldStructRange(3, c->meta_data_offset, c->meta_data_length),
+                              ParquetFieldInt64(4, c->offset_index_offset),
+                              ParquetFieldInt32(5, c->offset_index_length),
+                              ParquetFieldInt64(6, c->column_index_offset),
+                              ParquetFieldInt32(7, c->column_index_length));
+    return function_builder(this, op);
+  }
   auto op = std::make_tuple(ParquetFieldString(1, c->file_path),
                             ParquetFieldInt64(2, c->file_offset),
                             ParquetFieldStruct(3, c->meta_data),
@@ -245,7 +248,9 @@ bool CompactProtocolReader::read(ColumnChunkMetaData* c)
                             ParquetFieldInt64(9, c->data_page_offset),
                             ParquetFieldInt64(10, c->index_page_offset),
                             ParquetFieldInt64(11, c->dictionary_page_offset),
-                            ParquetFieldStruct(12, c->statistics));
+                            ParquetFieldStruct(12, c->statistics),
+                            ParquetFieldInt64(14, c->bloom_filter_offset),
+                            ParquetFieldInt32(15, c->bloom_filter_length));
   return function_builder(this, op);
 }
 
@@ -316,6 +321,33 @@ bool CompactProtocolReader::read(Statistics* s)
   return function_builder(this, op);
 }
 
+bool CompactProtocolReader::read(BloomFilterAlgorithm* a)
+{
+  auto op = std::make_tuple(ParquetFieldUnion(1, a->isset.BLOCK, a->BLOCK));
+  return function_builder(this, op);
+}
+
+bool CompactProtocolReader::read(BloomFilterHash* h)
+{
+  auto op = std::make_tuple(ParquetFieldUnion(1, h->isset.XXHASH, h->XXHASH));
+  return function_builder(this, op);
+}
+
+bool CompactProtocolReader::read(BloomFilterCompression* c)
+{
+  auto op = std::make_tuple(ParquetFieldUnion(1, c->isset.UNCOMPRESSED, c->UNCOMPRESSED));
+  return function_builder(this, op);
+}
+
+bool CompactProtocolReader::read(BloomFilterHeader* b)
+{
+  auto op = std::make_tuple(ParquetFieldInt32(1, b->num_bytes),
+                            ParquetFieldStruct(2, b->algorithm),
+                            ParquetFieldStruct(3, b->hash),
+                            ParquetFieldStruct(4, b->compression));
+  return function_builder(this, op);
+}
+
 /**
  * @brief Constructs the schema from the file-level metadata
  *
@@ -327,6 +359,23 @@ bool CompactProtocolReader::InitSchema(FileMetaData* md)
 {
   if (static_cast<std::size_t>(WalkSchema(md)) != md->schema.size()) return false;
 
+  if (m_defer_column_metadata) {
+    /* path_in_schema is not available until the column chunk metadata is decoded. Column chunks
+     * are stored in the same order as the leaves of the schema tree, so map them by position.
+     */
+    std::vector<int> leaf_indices;
+    for (std::size_t i = 1; i < md->schema.size(); ++i) {
+      if (md->schema[i].num_children == 0) { leaf_indices.push_back(i); }
+    }
+    for (auto& row_group : md->row_groups) {
+      if (row_group.columns.size() != leaf_indices.size()) return false;
+      for (std::size_t i = 0; i < row_group.columns.size(); ++i) {
+        row_group.columns[i].schema_idx = leaf_indices[i];
+      }
+    }
+    return true;
+  }
+
   /* Inside FileMetaData, there is a std::vector of RowGroups and each RowGroup contains a
    * a std::vector of ColumnChunks. Each ColumnChunk has a member ColumnMetaData, which contains
    * a std::vector of std::strings representing paths. The purpose of the code below is to set the
@@ -357,6 +406,28 @@ bool CompactProtocolReader::InitSchema(FileMetaData* md)
   return true;
 }
 
+/**
+ * @brief Decodes the deferred metadata of a column chunk
+ *
+ * @param[in] md File metadata that was parsed with deferred column chunk metadata
+ * @param[in,out] c Column chunk of `md` whose metadata is decoded
+ *
+ * @return True if the metadata is decoded or was not deferred, false otherwise
+ */
+bool CompactProtocolReader::read_column_metadata(FileMetaData const& md, ColumnChunk* c)
+{
+  if (c->meta_data_length == 0) return true;
+  if (md.encoded_footer == nullptr ||
+      static_cast<std::size_t>(c->meta_data_offset + c->meta_data_length) >
+        md.encoded_footer->size()) {
+    return false;
+  }
+  init(md.encoded_footer->data() + c->meta_data_offset, c->meta_data_length);
+  if (!read(&c->meta_data)) return false;
+  c->meta_data_length = 0;
+  return true;
+}
+
 /**
  * @brief Populates each node in the schema tree
  *
@@ -40,11 +40,14 @@ namespace parquet {
  * compression codecs are supported yet.
  */
 class CompactProtocolReader {
- protected:
-  static const uint8_t g_list2struct[16];
-
  public:
   explicit CompactProtocolReader(uint8_t const* base = nullptr, size_t len = 0) { init(base, len); }
+  /**
+   * @brief Skips over column chunk metadata, recording only its byte range within the input
+   *
+   * The metadata of individual column chunks can later be decoded with `read_column_metadata`.
+   */
+  void defer_column_metadata(bool defer = true) noexcept { m_defer_column_metadata = defer; }
   void init(uint8_t const* base, size_t len)
   {
     m_base = m_cur = base;
@@ -119,6 +122,10 @@ class CompactProtocolReader {
   bool read(OffsetIndex* o);
   bool read(ColumnIndex* c);
   bool read(Statistics* s);
+  bool read(BloomFilterAlgorithm* a);
+  bool read(BloomFilterHash* h);
+  bool read(BloomFilterCompression* c);
+  bool read(BloomFilterHeader* b);
 
  public:
   static int NumRequiredBits(uint32_t max_level) noexcept
@@ -126,6 +133,7 @@ class CompactProtocolReader {
     return 32 - CountLeadingZeros32(max_level);
   }
   bool InitSchema(FileMetaData* md);
+  bool read_column_metadata(FileMetaData const& md, ColumnChunk* c);
 
  protected:
   int WalkSchema(FileMetaData* md,
@@ -139,6 +147,8 @@ class CompactProtocolReader {
   uint8_t const* m_cur  = nullptr;
   uint8_t const* m_end  = nullptr;
 
+  bool m_defer_column_metadata = false;
+
   friend class ParquetFieldBool;
   friend class ParquetFieldBoolList;
   friend class ParquetFieldInt8;
@@ -161,6 +171,7 @@ class CompactProtocolReader {
   friend class ParquetFieldBinary;
   friend class ParquetFieldBinaryList;
   friend class ParquetFieldStructBlob;
+  friend class ParquetFieldStructRange;
 };
 
 /**
@@ -658,6 +669,32 @@ class ParquetFieldStructBlob {
   int field() { return field_val; }
 };
 
+/**
+ * @brief Functor to skip a structure while recording its byte range within the
+ * CompactProtocolReader input
+ *
+ * @return True if field type mismatches or if the structure cannot be skipped
+ */
+class ParquetFieldStructRange {
+  int field_val;
+  int64_t& offset;
+  int32_t& length;
+
+ public:
+  ParquetFieldStructRange(int f, int64_t& o, int32_t& l) : field_val(f), offset(o), length(l) {}
+  inline bool operator()(CompactProtocolReader* cpr, int field_type)
+  {
+    if (field_type != ST_FLD_STRUCT) return true;
+    uint8_t const* start = cpr->m_cur;
+    if (!cpr->skip_struct_field(field_type)) return true;
+    offset = start - cpr->m_base;
+    length = cpr->m_cur - start;
+    return false;
+  }
+
+  int field() { return field_val; }
+};
+
 }  // namespace parquet
 }  // namespace io
 }  // namespace cudf
@@ -24,13 +24,21 @@ namespace parquet {
  * @brief Parquet CompactProtocolWriter class
  */
 
-size_t CompactProtocolWriter::write(FileMetaData const& f)
+namespace {
+
+/**
+ * @brief Writes the file metadata, with the row groups written by `write_row_groups`.
+ */
+template <typename RowGroupsWriter>
+size_t write_file_metadata(CompactProtocolWriter& writer,
+                           FileMetaData const& f,
+                           RowGroupsWriter write_row_groups)
 {
-  CompactProtocolFieldWriter c(*this);
+  CompactProtocolFieldWriter c(writer);
   c.field_int(1, f.version);
   c.field_struct_list(2, f.schema);
   c.field_int(3, f.num_rows);
-  c.field_struct_list(4, f.row_groups);
+  write_row_groups(c);
   if (f.key_value_metadata.size() != 0) { c.field_struct_list(5, f.key_value_metadata); }
   if (f.created_by.size() != 0) { c.field_string(6, f.created_by); }
   if (f.column_order_listsize != 0) {
@@ -48,6 +56,27 @@ size_t CompactProtocolWriter::write(FileMetaData const& f)
   return c.value();
 }
 
+}  // namespace
+
+size_t CompactProtocolWriter::write(FileMetaData const& f)
+{
+  return write_file_metadata(
+    *this, f, [&](CompactProtocolFieldWriter& c) { c.field_struct_list(4, f.row_groups); });
+}
+
+size_t CompactProtocolWriter::write(FileMetaData const& f,
+                                    host_span<uint8_t const> encoded_row_groups,
+                                    uint32_t num_row_groups)
+{
+  return write_file_metadata(*this, f, [&](CompactProtocolFieldWriter& c) {
+    c.put_field_header(4, c.current_field(), ST_FLD_LIST);
+    c.put_byte((uint8_t)((std::min(num_row_groups, 0xfu) << 4) | ST_FLD_STRUCT));
+    if (num_row_groups >= 0xf) c.put_uint(num_row_groups);
+    c.put_byte(encoded_row_groups.data(), static_cast<uint32_t>(encoded_row_groups.size()));
+    c.set_current_field(4);
+  });
+}
+
 size_t CompactProtocolWriter::write(DecimalType const& decimal)
 {
   CompactProtocolFieldWriter c(*this);
@@ -202,6 +231,10 @@ size_t CompactProtocolWriter::write(ColumnChunkMetaData const& s)
   if (s.index_page_offset != 0) { c.field_int(10, s.index_page_offset); }
   if (s.dictionary_page_offset != 0) { c.field_int(11, s.dictionary_page_offset); }
   c.field_struct(12, s.statistics);
+  if (s.bloom_filter_offset != 0) {
+    c.field_int(14, s.bloom_filter_offset);
+    if (s.bloom_filter_length != 0) { c.field_int(15, s.bloom_filter_length); }
+  }
   return c.value();
 }
 
@@ -233,12 +266,42 @@ size_t CompactProtocolWriter::write(OffsetIndex const& s)
   return c.value();
 }
 
+size_t CompactProtocolWriter::write(BloomFilterAlgorithm const& a)
+{
+  CompactProtocolFieldWriter c(*this);
+  if (a.isset.BLOCK) { c.field_struct(1, a.BLOCK); }
+  return c.value();
+}
+
+size_t CompactProtocolWriter::write(BloomFilterHash const& h)
+{
+  CompactProtocolFieldWriter c(*this);
+  if (h.isset.XXHASH) { c.field_struct(1, h.XXHASH); }
+  return c.value();
+}
+
+size_t CompactProtocolWriter::write(BloomFilterCompression const& b)
+{
+  CompactProtocolFieldWriter c(*this);
+  if (b.isset.UNCOMPRESSED) { c.field_struct(1, b.UNCOMPRESSED); }
+  return c.value();
+}
+
+size_t CompactProtocolWriter::write(BloomFilterHeader const& b)
+{
+  CompactProtocolFieldWriter c(*this);
+  c.field_int(1, b.num_bytes);
+  c.field_struct(2, b.algorithm);
+  c.field_struct(3, b.hash);
+  c.field_struct(4, b.compression);
+  return c.value();
+}
+
 void CompactProtocolFieldWriter::put_byte(uint8_t v) { writer.m_buf.push_back(v); }
 
 void CompactProtocolFieldWriter::put_byte(uint8_t const* raw, uint32_t len)
 {
-  for (uint32_t i = 0; i < len; i++)
-    writer.m_buf.push_back(raw[i]);
+  writer.m_buf.insert(writer.m_buf.end(), raw, raw + len);
 }
 
 uint32_t CompactProtocolFieldWriter::put_uint(uint64_t v)
@@ -19,6 +19,8 @@
 #include "parquet.hpp"
 #include "parquet_common.hpp"
 
+#include <cudf/utilities/span.hpp>
+
 #include <algorithm>
 #include <cstddef>
 #include <cstdint>
@@ -39,6 +41,18 @@ class CompactProtocolWriter {
   CompactProtocolWriter(std::vector<uint8_t>* output) : m_buf(*output) {}
 
   size_t write(FileMetaData const&);
+  /**
+   * @brief Writes the file metadata with row groups that are already encoded, instead of
+   * `f.row_groups`
+   *
+   * @param f File metadata
+   * @param encoded_row_groups Concatenated Thrift-encoded `RowGroup` structs
+   * @param num_row_groups Number of encoded row groups
+   * @return Number of bytes written
+   */
+  size_t write(FileMetaData const& f,
+               host_span<uint8_t const> encoded_row_groups,
+               uint32_t num_row_groups);
   size_t write(DecimalType const&);
   size_t write(TimeUnit const&);
   size_t write(TimeType const&);
@@ -53,6 +67,10 @@ class CompactProtocolWriter {
   size_t write(Statistics const&);
   size_t write(PageLocation const&);
   size_t write(OffsetIndex const&);
+  size_t write(BloomFilterAlgorithm const&);
+  size_t write(BloomFilterHash const&);
+  size_t write(BloomFilterCompression const&);
+  size_t write(BloomFilterHeader const&);
 
  protected:
   std::vector<uint8_t>& m_buf;
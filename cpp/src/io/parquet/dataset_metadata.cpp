@@ -0,0 +1,267 @@
+/*
+ * Copyright (c) 2023, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dataset_metadata.hpp"
+
+#include "compact_protocol_reader.hpp"
+#include "compact_protocol_writer.hpp"
+
+#include <cudf/utilities/error.hpp>
+
+#include <algorithm>
+#include <utility>
+
+namespace cudf::io::detail::parquet {
+
+namespace {
+
+/**
+ * @brief Returns the encoded file metadata from the footer of a parquet file.
+ */
+std::vector<uint8_t> read_footer(datasource& source)
+{
+  constexpr auto header_len = sizeof(file_header_s);
+  constexpr auto ender_len  = sizeof(file_ender_s);
+
+  auto const len = source.size();
+  CUDF_EXPECTS(len > header_len + ender_len, "Incorrect data source");
+  auto const header_buffer = source.host_read(0, header_len);
+  auto const header        = reinterpret_cast<file_header_s const*>(header_buffer->data());
+  auto const ender_buffer  = source.host_read(len - ender_len, ender_len);
+  auto const ender         = reinterpret_cast<file_ender_s const*>(ender_buffer->data());
+  CUDF_EXPECTS(header->magic == parquet_magic && ender->magic == parquet_magic,
+               "Corrupted header or footer");
+  CUDF_EXPECTS(ender->footer_len != 0 && ender->footer_len <= (len - header_len - ender_len),
+               "Incorrect footer length");
+
+  auto const buffer = source.host_read(len - ender->footer_len - ender_len, ender->footer_len);
+  return {buffer->data(), buffer->data() + buffer->size()};
+}
+
+/**
+ * @brief Byte range of the encoded row groups within the encoded file metadata.
+ */
+struct encoded_row_groups_info {
+  size_t begin = 0;
+  size_t end   = 0;
+  std::vector<size_t> row_group_offsets;  // Offset of each row group, relative to `begin`
+  // Whether the metadata includes the column orders, which are not decoded by the reader
+  bool has_column_orders = false;
+};
+
+/**
+ * @brief Locates the encoded row groups by skipping over the fields of the file metadata.
+ */
+encoded_row_groups_info find_encoded_row_groups(host_span<uint8_t const> encoded)
+{
+  encoded_row_groups_info info;
+  CompactProtocolReader cp(encoded.data(), encoded.size());
+  int field = 0;
+  for (int c = cp.getb(); c != 0; c = cp.getb()) {
+    field           = ((c >> 4) != 0) ? field + (c >> 4) : cp.get_i16();
+    auto const type = c & 0xf;
+    if (field == 4 && type == ST_FLD_LIST) {
+      uint8_t el_type;
+      auto const num_row_groups = cp.get_listh(&el_type);
+      info.begin                = cp.bytecount();
+      for (int32_t i = 0; i < num_row_groups; ++i) {
+        info.row_group_offsets.push_back(cp.bytecount() - info.begin);
+        CUDF_EXPECTS(cp.skip_struct_field(el_type), "Cannot parse row groups");
+      }
+      info.end = cp.bytecount();
+      continue;
+    }
+    if (field == 7) { info.has_column_orders = true; }
+    CUDF_EXPECTS(cp.skip_struct_field(type), "Cannot parse metadata");
+  }
+  return info;
+}
+
+/**
+ * @brief Returns the number of leaf columns in the schema.
+ */
+uint32_t num_leaf_columns(std::vector<SchemaElement> const& schema)
+{
+  return std::count_if(schema.begin() + std::min<size_t>(schema.size(), 1),
+                       schema.end(),
+                       [](auto const& element) { return element.num_children == 0; });
+}
+
+/**
+ * @brief Writes the file metadata as a footer-only parquet file.
+ */
+void write_footer(data_sink& sink,
+                  FileMetaData const& metadata,
+                  host_span<uint8_t const> encoded_row_groups,
+                  uint32_t num_row_groups)
+{
+  std::vector<uint8_t> output;
+  file_header_s fhdr;
+  file_ender_s fendr;
+  fhdr.magic = parquet_magic;
+  output.insert(output.end(),
+                reinterpret_cast<uint8_t const*>(&fhdr),
+                reinterpret_cast<uint8_t const*>(&fhdr) + sizeof(fhdr));
+  CompactProtocolWriter cpw(&output);
+  fendr.footer_len = static_cast<uint32_t>(cpw.write(metadata, encoded_row_groups, num_row_groups));
+  fendr.magic      = parquet_magic;
+  output.insert(output.end(),
+                reinterpret_cast<uint8_t const*>(&fendr),
+                reinterpret_cast<uint8_t const*>(&fendr) + sizeof(fendr));
+  sink.host_write(output.data(), output.size());
+  sink.flush();
+}
+
+}  // namespace
+
+dataset_metadata::dataset_metadata(datasource& summary)
+{
+  auto const footer = read_footer(summary);
+
+  // Column chunk metadata is only skipped; file paths and row counts are needed to list the files
+  CompactProtocolReader cp(footer.data(), footer.size());
+  cp.defer_column_metadata();
+  CUDF_EXPECTS(cp.read(&_metadata), "Cannot parse metadata");
+
+  auto const row_groups = find_encoded_row_groups(footer);
+  CUDF_EXPECTS(row_groups.end >= row_groups.begin, "Cannot parse row groups");
+  _encoded_row_groups.assign(footer.begin() + row_groups.begin, footer.begin() + row_groups.end);
+  _num_row_groups = _metadata.row_groups.size();
+  if (row_groups.has_column_orders) {
+    _metadata.column_order_listsize = num_leaf_columns(_metadata.schema);
+  }
+
+  CUDF_EXPECTS(row_groups.row_group_offsets.size() == _metadata.row_groups.size(),
+               "Cannot parse row groups");
+  std::string const no_path;
+  for (size_t rg_idx = 0; rg_idx < _metadata.row_groups.size(); ++rg_idx) {
+    auto const& row_group = _metadata.row_groups[rg_idx];
+    auto const& path      = row_group.columns.empty() ? no_path : row_group.columns[0].file_path;
+    if (_files.empty() || _files.back().path != path) {
+      _files.push_back({path, 0, 0});
+      _file_offsets.push_back(row_groups.row_group_offsets[rg_idx]);
+    }
+    _files.back().num_rowgroups++;
+    _files.back().num_rows += row_group.num_rows;
+  }
+  _metadata.row_groups.clear();
+  _metadata.row_groups.shrink_to_fit();
+
+  CompactProtocolWriter schema_writer(&_encoded_schema);
+  for (auto const& element : _metadata.schema) {
+    schema_writer.write(element);
+  }
+}
+
+void dataset_metadata::append(std::string const& file_path, FileMetaData&& file_metadata)
+{
+  CUDF_EXPECTS(not file_metadata.schema.empty(), "Cannot append a file without a schema");
+
+  std::vector<uint8_t> encoded_schema;
+  CompactProtocolWriter schema_writer(&encoded_schema);
+  for (auto const& element : file_metadata.schema) {
+    schema_writer.write(element);
+  }
+
+  auto row_groups = std::move(file_metadata.row_groups);
+  if (_metadata.schema.empty()) {
+    // The first file provides the schema and the file-level fields
+    _metadata          = std::move(file_metadata);
+    _metadata.num_rows = 0;
+    _encoded_schema    = std::move(encoded_schema);
+    // Reader doesn't currently populate column_order, so infer it from the statistics, as
+    // `merge_row_group_metadata` does
+    auto const is_valid_stats = [](auto const& stats) {
+      return stats.max.size() != 0 || stats.min.size() != 0 || stats.null_count != -1 ||
+             stats.distinct_count != -1 || stats.max_value.size() != 0 ||
+             stats.min_value.size() != 0;
+    };
+    auto const has_stats = not row_groups.empty() && not row_groups[0].columns.empty() &&
+                           is_valid_stats(row_groups[0].columns[0].meta_data.statistics);
+    _metadata.column_order_listsize = has_stats ? num_leaf_columns(_metadata.schema) : 0;
+  } else {
+    CUDF_EXPECTS(encoded_schema == _encoded_schema,
+                 "The schema of " + file_path + " does not match the schema of the dataset");
+  }
+
+  // Only the row groups of the appended file are encoded
+  _file_offsets.push_back(_encoded_row_groups.size());
+  CompactProtocolWriter cpw(&_encoded_row_groups);
+  int64_t num_rows = 0;
+  for (auto& row_group : row_groups) {
+    for (auto& chunk : row_group.columns) {
+      chunk.file_path = file_path;
+    }
+    cpw.write(row_group);
+    num_rows += row_group.num_rows;
+  }
+  _num_row_groups += row_groups.size();
+  _metadata.num_rows += num_rows;
+  _files.push_back({file_path, static_cast<size_type>(row_groups.size()), num_rows});
+}
+
+void dataset_metadata::append_file_metadata(std::string const& file_path,
+                                            host_span<uint8_t const> file_metadata)
+{
+  // The blob holds the encoded metadata between the file header and the file ender
+  CUDF_EXPECTS(file_metadata.size() > sizeof(file_header_s) + sizeof(file_ender_s),
+               "Invalid file metadata");
+  CompactProtocolReader cp(file_metadata.data() + sizeof(file_header_s),
+                           file_metadata.size() - sizeof(file_header_s) - sizeof(file_ender_s));
+  FileMetaData md;
+  CUDF_EXPECTS(cp.read(&md), "Cannot parse metadata");
+  append(file_path, std::move(md));
+}
+
+void dataset_metadata::append_file(std::string const& file_path, datasource& file)
+{
+  auto const footer = read_footer(file);
+  CompactProtocolReader cp(footer.data(), footer.size());
+  FileMetaData md;
+  CUDF_EXPECTS(cp.read(&md), "Cannot parse metadata");
+  append(file_path, std::move(md));
+}
+
+FileMetaData dataset_metadata::file_metadata(size_t file_idx) const
+{
+  CUDF_EXPECTS(file_idx < _files.size(), "Invalid file index");
+  auto const begin = _file_offsets[file_idx];
+  auto const end =
+    file_idx + 1 < _files.size() ? _file_offsets[file_idx + 1] : _encoded_row_groups.size();
+
+  auto file_metadata     = _metadata;
+  file_metadata.num_rows = _files[file_idx].num_rows;
+  file_metadata.row_groups.resize(_files[file_idx].num_rowgroups);
+  CompactProtocolReader cp(_encoded_row_groups.data() + begin, end - begin);
+  for (auto& row_group : file_metadata.row_groups) {
+    CUDF_EXPECTS(cp.read(&row_group), "Cannot parse row groups");
+  }
+  return file_metadata;
+}
+
+void dataset_metadata::write_metadata(data_sink& sink) const
+{
+  write_footer(sink, _metadata, _encoded_row_groups, _num_row_groups);
+}
+
+void dataset_metadata::write_common_metadata(data_sink& sink) const
+{
+  auto common_metadata     = _metadata;
+  common_metadata.num_rows = 0;
+  write_footer(sink, common_metadata, {}, 0);
+}
+
+}  // namespace cudf::io::detail::parquet
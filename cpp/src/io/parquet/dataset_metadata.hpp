@@ -0,0 +1,112 @@
+/*
+ * Copyright (c) 2023, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file dataset_metadata.hpp
+ * @brief cuDF-IO Parquet dataset summary metadata
+ */
+
+#pragma once
+
+#include "parquet.hpp"
+
+#include <cudf/io/data_sink.hpp>
+#include <cudf/io/datasource.hpp>
+#include <cudf/io/parquet_metadata.hpp>
+#include <cudf/utilities/span.hpp>
+
+#include <string>
+#include <vector>
+
+namespace cudf::io::detail::parquet {
+
+using namespace cudf::io::parquet;
+
+/**
+ * @brief Implementation of `cudf::io::parquet_dataset_metadata`.
+ *
+ * The file metadata is kept without its row groups, which are instead kept Thrift-encoded and
+ * written as is.
+ */
+class dataset_metadata {
+ public:
+  dataset_metadata() = default;
+
+  /**
+   * @brief Loads an existing `_metadata` file.
+   *
+   * Only the byte range of the encoded row groups is located; the column chunk metadata is not
+   * decoded.
+   *
+   * @param summary Source of the `_metadata` file
+   */
+  explicit dataset_metadata(datasource& summary);
+
+  /**
+   * @brief Appends the row groups of a file, pointing their column chunks to `file_path`.
+   *
+   * @param file_path Path of the file
+   * @param file_metadata Decoded metadata of the file
+   */
+  void append(std::string const& file_path, FileMetaData&& file_metadata);
+
+  /**
+   * @copydoc cudf::io::parquet_dataset_metadata::append_file_metadata
+   */
+  void append_file_metadata(std::string const& file_path, host_span<uint8_t const> file_metadata);
+
+  /**
+   * @brief Appends the row groups of a file, read from its footer.
+   *
+   * @param file_path Path of the file
+   * @param file Source of the parquet file
+   */
+  void append_file(std::string const& file_path, datasource& file);
+
+  [[nodiscard]] int64_t num_rows() const { return _metadata.num_rows; }
+
+  [[nodiscard]] std::vector<parquet_dataset_file> const& files() const { return _files; }
+
+  /**
+   * @brief Returns the metadata of a file, as it is in the footer of the file.
+   *
+   * Only the row groups of the file are decoded.
+   *
+   * @param file_idx Index of the file in `files()`
+   * @return The decoded metadata of the file
+   */
+  [[nodiscard]] FileMetaData file_metadata(size_t file_idx) const;
+
+  /**
+   * @brief Writes the `_metadata` file to the sink.
+   */
+  void write_metadata(data_sink& sink) const;
+
+  /**
+   * @brief Writes the `_common_metadata` file to the sink.
+   */
+  void write_common_metadata(data_sink& sink) const;
+
+ private:
+  FileMetaData _metadata;                // File metadata without the row groups
+  std::vector<uint8_t> _encoded_schema;  // Used to check the schema of appended files
+  std::vector<uint8_t> _encoded_row_groups;
+  uint32_t _num_row_groups = 0;
+  std::vector<parquet_dataset_file> _files;
+  std::vector<size_t> _file_offsets;  // Offset of the first encoded row group of each file
+};
+
+}  // namespace cudf::io::detail::parquet
@@ -19,6 +19,7 @@
 #include "parquet_common.hpp"
 
 #include <cstdint>
+#include <memory>
 #include <optional>
 #include <string>
 #include <vector>
@@ -228,6 +229,8 @@ struct ColumnChunkMetaData {
   int64_t dictionary_page_offset =
     0;                    // Byte offset from the beginning of file to first (only) dictionary page
   Statistics statistics;  // Encoded chunk-level statistics
+  int64_t bloom_filter_offset = 0;  // Byte offset from beginning of file to Bloom filter data
+  int32_t bloom_filter_length = 0;  // Size of Bloom filter data including header, if known
 };
 
 /**
@@ -249,6 +252,9 @@ struct ColumnChunk {
 
   // Following fields are derived from other fields
   int schema_idx = -1;  // Index in flattened schema (derived from path_in_schema)
+  // Byte range of the encoded `meta_data` within the file footer, if its decoding is deferred
+  int64_t meta_data_offset = 0;
+  int32_t meta_data_length = 0;  // Zero once `meta_data` is decoded
 };
 
 /**
@@ -286,6 +292,9 @@ struct FileMetaData {
   std::vector<KeyValue> key_value_metadata;
   std::string created_by         = "";
   uint32_t column_order_listsize = 0;
+
+  // Encoded footer, retained when the decoding of column chunk metadata is deferred
+  std::shared_ptr<std::vector<uint8_t> const> encoded_footer;
 };
 
 /**
@@ -354,6 +363,50 @@ struct ColumnIndex {
   std::vector<int64_t> null_counts;              // Optional count of null values per page
 };
 
+// thrift generated code simplified.
+struct SplitBlockAlgorithm {};
+struct XxHash {};
+struct Uncompressed {};
+
+using BloomFilterAlgorithm_isset = struct BloomFilterAlgorithm_isset {
+  bool BLOCK{false};
+};
+
+struct BloomFilterAlgorithm {
+  BloomFilterAlgorithm_isset isset;
+  SplitBlockAlgorithm BLOCK;
+};
+
+using BloomFilterHash_isset = struct BloomFilterHash_isset {
+  bool XXHASH{false};
+};
+
+struct BloomFilterHash {
+  BloomFilterHash_isset isset;
+  XxHash XXHASH;
+};
+
+using BloomFilterCompression_isset = struct BloomFilterCompression_isset {
+  bool UNCOMPRESSED{false};
+};
+
+struct BloomFilterCompression {
+  BloomFilterCompression_isset isset;
+  Uncompressed UNCOMPRESSED;
+};
+
+/**
+ * @brief Thrift-derived struct describing the header of a column chunk's Bloom filter
+ *
+ * The header is followed by `num_bytes` bytes of the filter bitset.
+ */
+struct BloomFilterHeader {
+  int32_t num_bytes = 0;  // Size of the bitset in bytes
+  BloomFilterAlgorithm algorithm;
+  BloomFilterHash hash;
+  BloomFilterCompression compression;
+};
+
 // bit space we are reserving in column_buffer::user_data
 constexpr uint32_t PARQUET_COLUMN_BUFFER_SCHEMA_MASK          = (0xff'ffffu);
 constexpr uint32_t PARQUET_COLUMN_BUFFER_FLAG_LIST_TERMINATED = (1 << 24);
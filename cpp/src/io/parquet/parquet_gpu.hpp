@@ -402,6 +402,8 @@ struct EncColumnChunk {
   bool use_dictionary;    //!< True if the chunk uses dictionary encoding
   uint8_t* column_index_blob;  //!< Binary blob containing encoded column index for this chunk
   uint32_t column_index_size;  //!< Size of column index blob
+  uint32_t* bloom_filter_data;  //!< Bloom filter bitset, or nullptr if not written
+  uint32_t bloom_filter_size;   //!< Size of Bloom filter bitset in bytes
 };
 
 /**
@@ -606,6 +608,17 @@ void InitFragmentStatistics(device_span<statistics_group> groups,
  */
 void initialize_chunk_hash_maps(device_span<EncColumnChunk> chunks, rmm::cuda_stream_view stream);
 
+/**
+ * @brief Insert chunk values into the Bloom filters of their chunks
+ *
+ * Chunks without a Bloom filter bitset are skipped. Bitsets must be zero-initialized.
+ *
+ * @param frags Column fragments
+ * @param stream CUDA stream to use
+ */
+void populate_bloom_filters(cudf::detail::device_2dspan<gpu::PageFragment const> frags,
+                            rmm::cuda_stream_view stream);
+
 /**
  * @brief Insert chunk values into their respective hash maps
  *
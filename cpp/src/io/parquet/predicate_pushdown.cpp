@@ -13,8 +13,12 @@
  * See the License for the specific language governing permissions and
  * limitations under the License.
  */
+#include "bloom_filter.hpp"
 #include "reader_impl_helpers.hpp"
 
+#include <io/utilities/stats_expression_converter.hpp>
+#include <io/utilities/stats_filter.hpp>
+
 #include <cudf/ast/detail/expression_transformer.hpp>
 #include <cudf/ast/detail/operators.hpp>
 #include <cudf/ast/expressions.hpp>
@@ -23,6 +27,7 @@
 #include <cudf/detail/transform.hpp>
 #include <cudf/detail/utilities/integer_utils.hpp>
 #include <cudf/detail/utilities/vector_factories.hpp>
+#include <cudf/scalar/scalar.hpp>
 #include <cudf/utilities/default_stream.hpp>
 #include <cudf/utilities/error.hpp>
 #include <cudf/utilities/traits.hpp>
@@ -31,22 +36,29 @@
 #include <rmm/mr/device/per_device_resource.hpp>
 
 #include <algorithm>
+#include <cstring>
 #include <list>
+#include <map>
 #include <numeric>
 #include <optional>
+#include <set>
 
 namespace cudf::io::detail::parquet {
 
 namespace {
 /**
- * @brief Converts statistics in column chunks to 2 device columns - min, max values.
- *
+ * @brief Encoded min and max statistics of a column over a range of rows, i.e. a column chunk or a
+ * page. Null pointers denote missing statistics.
  */
-struct stats_caster {
-  size_type total_row_groups;
-  std::vector<metadata> const& per_file_metadata;
-  host_span<std::vector<size_type> const> row_group_indices;
+struct encoded_min_max {
+  std::vector<uint8_t> const* min = nullptr;
+  std::vector<uint8_t> const* max = nullptr;
+};
 
+/**
+ * @brief Decodes encoded column statistics to statistics values; uses storage type as T
+ */
+struct stats_decoder {
   template <typename ToType, typename FromType>
   static ToType targetType(FromType const value)
   {
@@ -123,262 +135,111 @@ struct stats_caster {
     }
   }
 
-  // Creates device columns from column statistics (min, max)
   template <typename T>
-  std::pair<std::unique_ptr<column>, std::unique_ptr<column>> operator()(
-    size_t col_idx,
-    cudf::data_type dtype,
-    rmm::cuda_stream_view stream,
-    rmm::mr::device_memory_resource* mr) const
+  std::optional<stats_value> operator()(std::vector<uint8_t> const* stats_val,
+                                        Type const physical_type) const
   {
-    // List, Struct, Dictionary types are not supported
     if constexpr (cudf::is_compound<T>() && !std::is_same_v<T, string_view>) {
       CUDF_FAIL("Compound types do not have statistics");
     } else {
-      // Local struct to hold host columns
-      struct host_column {
-        // using thrust::host_vector because std::vector<bool> uses bitmap instead of byte per bool.
-        thrust::host_vector<T> val;
-        std::vector<bitmask_type> null_mask;
-        cudf::size_type null_count = 0;
-        host_column(size_type total_row_groups)
-          : val(total_row_groups),
-            null_mask(
-              cudf::util::div_rounding_up_safe<size_type>(
-                cudf::bitmask_allocation_size_bytes(total_row_groups), sizeof(bitmask_type)),
-              ~bitmask_type{0})
-        {
-        }
-
-        void set_index(size_type index, std::vector<uint8_t> const& binary_value, Type const type)
-        {
-          if (!binary_value.empty()) {
-            val[index] = convert<T>(binary_value.data(), binary_value.size(), type);
-          }
-          if (binary_value.empty()) {
-            clear_bit_unsafe(null_mask.data(), index);
-            null_count++;
-          }
-        }
-
-        static auto make_strings_children(host_span<string_view> host_strings,
-                                          rmm::cuda_stream_view stream,
-                                          rmm::mr::device_memory_resource* mr)
-        {
-          std::vector<char> chars{};
-          std::vector<cudf::size_type> offsets(1, 0);
-          for (auto const& str : host_strings) {
-            auto tmp =
-              str.empty() ? std::string_view{} : std::string_view(str.data(), str.size_bytes());
-            chars.insert(chars.end(), std::cbegin(tmp), std::cend(tmp));
-            offsets.push_back(offsets.back() + tmp.length());
-          }
-          auto d_chars   = cudf::detail::make_device_uvector_async(chars, stream, mr);
-          auto d_offsets = cudf::detail::make_device_uvector_sync(offsets, stream, mr);
-          return std::tuple{std::move(d_chars), std::move(d_offsets)};
-        }
-
-        auto to_device(cudf::data_type dtype,
-                       rmm::cuda_stream_view stream,
-                       rmm::mr::device_memory_resource* mr)
-        {
-          if constexpr (std::is_same_v<T, string_view>) {
-            auto [d_chars, d_offsets] = make_strings_children(val, stream, mr);
-            return cudf::make_strings_column(
-              val.size(),
-              std::move(d_offsets),
-              std::move(d_chars),
-              rmm::device_buffer{
-                null_mask.data(), cudf::bitmask_allocation_size_bytes(val.size()), stream, mr},
-              null_count);
-          }
-          return std::make_unique<column>(
-            dtype,
-            val.size(),
-            cudf::detail::make_device_uvector_async(val, stream, mr).release(),
-            rmm::device_buffer{
-              null_mask.data(), cudf::bitmask_allocation_size_bytes(val.size()), stream, mr},
-            null_count);
-        }
-      };  // local struct host_column
-      host_column min(total_row_groups);
-      host_column max(total_row_groups);
-
-      size_type stats_idx = 0;
-      for (size_t src_idx = 0; src_idx < row_group_indices.size(); ++src_idx) {
-        for (auto const rg_idx : row_group_indices[src_idx]) {
-          auto const& row_group = per_file_metadata[src_idx].row_groups[rg_idx];
-          auto const& colchunk  = row_group.columns[col_idx];
-          // To support deprecated min, max fields.
-          auto const& min_value = colchunk.meta_data.statistics.min_value.size() > 0
-                                    ? colchunk.meta_data.statistics.min_value
-                                    : colchunk.meta_data.statistics.min;
-          auto const& max_value = colchunk.meta_data.statistics.max_value.size() > 0
-                                    ? colchunk.meta_data.statistics.max_value
-                                    : colchunk.meta_data.statistics.max;
-          // translate binary data to Type then to <T>
-          min.set_index(stats_idx, min_value, colchunk.meta_data.type);
-          max.set_index(stats_idx, max_value, colchunk.meta_data.type);
-          stats_idx++;
-        }
-      };
-      return {min.to_device(dtype, stream, mr), max.to_device(dtype, stream, mr)};
+      if (stats_val == nullptr || stats_val->empty()) { return std::nullopt; }
+      return to_stats_value(convert<T>(stats_val->data(), stats_val->size(), physical_type));
     }
   }
 };
 
 /**
- * @brief Converts AST expression to StatsAST for comparing with column statistics
- * This is used in row group filtering based on predicate.
- * statistics min value of a column is referenced by column_index*2
- * statistics max value of a column is referenced by column_index*2+1
+ * @brief Decodes the encoded statistics of the output columns referenced in a filter
  *
+ * @param stats Encoded statistics of each range of rows, one list per output column
+ * @param output_dtypes List of output column datatypes
+ * @param physical_types Parquet physical types of the statistics, one per output column
+ * @param filter AST expression referencing the output columns
+ * @return Statistics of each range of rows, one list per output column; empty for the columns that
+ * are not referenced by the filter
  */
-class stats_expression_converter : public ast::detail::expression_transformer {
- public:
-  stats_expression_converter(ast::expression const& expr, size_type const& num_columns)
-    : _num_columns{num_columns}
-  {
-    expr.accept(*this);
-  }
-
-  /**
-   * @copydoc ast::detail::expression_transformer::visit(ast::literal const& )
-   */
-  std::reference_wrapper<ast::expression const> visit(ast::literal const& expr) override
-  {
-    _stats_expr = std::reference_wrapper<ast::expression const>(expr);
-    return expr;
-  }
+std::vector<std::vector<stats_min_max>> decode_stats(
+  host_span<std::vector<encoded_min_max> const> stats,
+  host_span<data_type const> output_dtypes,
+  host_span<Type const> physical_types,
+  ast::expression const& filter)
+{
+  std::set<size_type> filter_columns;
+  collect_column_references(filter, filter_columns);
 
-  /**
-   * @copydoc ast::detail::expression_transformer::visit(ast::column_reference const& )
-   */
-  std::reference_wrapper<ast::expression const> visit(ast::column_reference const& expr) override
-  {
-    CUDF_EXPECTS(expr.get_table_source() == ast::table_reference::LEFT,
-                 "Statistics AST supports only left table");
-    CUDF_EXPECTS(expr.get_column_index() < _num_columns,
-                 "Column index cannot be more than number of columns in the table");
-    _stats_expr = std::reference_wrapper<ast::expression const>(expr);
-    return expr;
+  std::vector<std::vector<stats_min_max>> decoded(output_dtypes.size());
+  for (auto const col_idx : filter_columns) {
+    if (static_cast<size_t>(col_idx) >= output_dtypes.size()) { continue; }
+    auto const& dtype = output_dtypes[col_idx];
+    if (cudf::is_compound(dtype) && dtype.id() != cudf::type_id::STRING) { continue; }
+    decoded[col_idx].reserve(stats[col_idx].size());
+    for (auto const& range_stats : stats[col_idx]) {
+      decoded[col_idx].push_back(
+        {cudf::type_dispatcher<dispatch_storage_type>(
+           dtype, stats_decoder{}, range_stats.min, physical_types[col_idx]),
+         cudf::type_dispatcher<dispatch_storage_type>(
+           dtype, stats_decoder{}, range_stats.max, physical_types[col_idx])});
+    }
   }
+  return decoded;
+}
 
-  /**
-   * @copydoc ast::detail::expression_transformer::visit(ast::column_name_reference const& )
-   */
-  std::reference_wrapper<ast::expression const> visit(
-    ast::column_name_reference const& expr) override
+/**
+ * @brief Computes the Bloom filter hashes of the plain encodings of a literal value
+ *
+ * Returns all hashes under which values equal to the literal may have been inserted, e.g. both
+ * signed zeros for floating point literals, or `std::nullopt` if the type is not supported.
+ */
+struct literal_bloom_filter_hashes {
+  template <typename T>
+  static uint64_t hash_value(T value)
   {
-    CUDF_FAIL("Column name reference is not supported in statistics AST");
+    return bloom_filter_hash(reinterpret_cast<uint8_t const*>(&value), sizeof(T));
   }
 
-  /**
-   * @copydoc ast::detail::expression_transformer::visit(ast::operation const& )
-   */
-  std::reference_wrapper<ast::expression const> visit(ast::operation const& expr) override
+  template <typename T>
+  std::optional<std::vector<uint64_t>> operator()(cudf::scalar const& value,
+                                                  Type const physical_type,
+                                                  rmm::cuda_stream_view stream) const
   {
-    using cudf::ast::ast_operator;
-    auto const operands = expr.get_operands();
-    auto const op       = expr.get_operator();
-
-    if (auto* v = dynamic_cast<ast::column_reference const*>(&operands[0].get())) {
-      // First operand should be column reference, second should be literal.
-      CUDF_EXPECTS(cudf::ast::detail::ast_operator_arity(op) == 2,
-                   "Only binary operations are supported on column reference");
-      CUDF_EXPECTS(dynamic_cast<ast::literal const*>(&operands[1].get()) != nullptr,
-                   "Second operand of binary operation with column reference must be a literal");
-      v->accept(*this);
-      auto const col_index = v->get_column_index();
-      switch (op) {
-        /* transform to stats conditions. op(col, literal)
-        col1 == val --> vmin <= val && vmax >= val
-        col1 != val --> !(vmin == val && vmax == val)
-        col1 >  val --> vmax > val
-        col1 <  val --> vmin < val
-        col1 >= val --> vmax >= val
-        col1 <= val --> vmin <= val
-        */
-        case ast_operator::EQUAL: {
-          auto const& vmin = _col_ref.emplace_back(col_index * 2);
-          auto const& vmax = _col_ref.emplace_back(col_index * 2 + 1);
-          auto const& op1 =
-            _operators.emplace_back(ast_operator::LESS_EQUAL, vmin, operands[1].get());
-          auto const& op2 =
-            _operators.emplace_back(ast_operator::GREATER_EQUAL, vmax, operands[1].get());
-          _operators.emplace_back(ast::ast_operator::LOGICAL_AND, op1, op2);
-          break;
-        }
-        case ast_operator::NOT_EQUAL: {
-          auto const& vmin = _col_ref.emplace_back(col_index * 2);
-          auto const& vmax = _col_ref.emplace_back(col_index * 2 + 1);
-          auto const& op1  = _operators.emplace_back(ast_operator::NOT_EQUAL, vmin, vmax);
-          auto const& op2 =
-            _operators.emplace_back(ast_operator::NOT_EQUAL, vmax, operands[1].get());
-          _operators.emplace_back(ast_operator::LOGICAL_OR, op1, op2);
-          break;
-        }
-        case ast_operator::LESS: [[fallthrough]];
-        case ast_operator::LESS_EQUAL: {
-          auto const& vmin = _col_ref.emplace_back(col_index * 2);
-          _operators.emplace_back(op, vmin, operands[1].get());
-          break;
-        }
-        case ast_operator::GREATER: [[fallthrough]];
-        case ast_operator::GREATER_EQUAL: {
-          auto const& vmax = _col_ref.emplace_back(col_index * 2 + 1);
-          _operators.emplace_back(op, vmax, operands[1].get());
-          break;
-        }
-        default: CUDF_FAIL("Unsupported operation in Statistics AST");
+    if constexpr (std::is_same_v<T, string_view>) {
+      if (physical_type != BYTE_ARRAY) { return std::nullopt; }
+      auto const str = static_cast<cudf::string_scalar const&>(value).to_string(stream);
+      return std::vector<uint64_t>{
+        bloom_filter_hash(reinterpret_cast<uint8_t const*>(str.data()), str.size())};
+    } else if constexpr (cudf::is_integral<T>() and not cudf::is_boolean<T>()) {
+      auto const val = static_cast<cudf::scalar_type_t<T> const&>(value).value(stream);
+      switch (physical_type) {
+        case INT32: return std::vector<uint64_t>{hash_value(static_cast<int32_t>(val))};
+        case INT64: return std::vector<uint64_t>{hash_value(static_cast<int64_t>(val))};
+        default: return std::nullopt;
+      }
+    } else if constexpr (cudf::is_floating_point<T>()) {
+      auto const val = static_cast<cudf::scalar_type_t<T> const&>(value).value(stream);
+      // Signed zeros compare equal but have different encodings
+      auto const hashes = [&](auto physical_val) {
+        return val == 0 ? std::vector<uint64_t>{hash_value(physical_val), hash_value(-physical_val)}
+                        : std::vector<uint64_t>{hash_value(physical_val)};
       };
-    } else {
-      auto new_operands = visit_operands(operands);
-      if (cudf::ast::detail::ast_operator_arity(op) == 2) {
-        _operators.emplace_back(op, new_operands.front(), new_operands.back());
-      } else if (cudf::ast::detail::ast_operator_arity(op) == 1) {
-        _operators.emplace_back(op, new_operands.front());
+      switch (physical_type) {
+        case FLOAT: return hashes(static_cast<float>(val));
+        case DOUBLE: return hashes(static_cast<double>(val));
+        default: return std::nullopt;
       }
+    } else {
+      return std::nullopt;
     }
-    _stats_expr = std::reference_wrapper<ast::expression const>(_operators.back());
-    return std::reference_wrapper<ast::expression const>(_operators.back());
-  }
-
-  /**
-   * @brief Returns the AST to apply on Column chunk statistics.
-   *
-   * @return AST operation expression
-   */
-  [[nodiscard]] std::reference_wrapper<ast::expression const> get_stats_expr() const
-  {
-    return _stats_expr.value().get();
-  }
-
- private:
-  std::vector<std::reference_wrapper<ast::expression const>> visit_operands(
-    std::vector<std::reference_wrapper<ast::expression const>> operands)
-  {
-    std::vector<std::reference_wrapper<ast::expression const>> transformed_operands;
-    for (auto const& operand : operands) {
-      auto const new_operand = operand.get().accept(*this);
-      transformed_operands.push_back(new_operand);
-    }
-    return transformed_operands;
   }
-  std::optional<std::reference_wrapper<ast::expression const>> _stats_expr;
-  size_type _num_columns;
-  std::list<ast::column_reference> _col_ref;
-  std::list<ast::operation> _operators;
 };
 }  // namespace
 
 std::optional<std::vector<std::vector<size_type>>> aggregate_reader_metadata::filter_row_groups(
+  host_span<std::unique_ptr<datasource> const> sources,
   host_span<std::vector<size_type> const> row_group_indices,
   host_span<data_type const> output_dtypes,
+  host_span<int const> output_column_schemas,
   std::reference_wrapper<ast::expression const> filter) const
 {
-  auto stream = cudf::get_default_stream();
-  auto mr     = rmm::mr::get_current_device_resource();
   // Create row group indices.
   std::vector<std::vector<size_type>> filtered_row_group_indices;
   std::vector<std::vector<size_type>> all_row_group_indices;
@@ -403,67 +264,51 @@ std::optional<std::vector<std::vector<size_type>>> aggregate_reader_metadata::fi
                                                   return sum + per_file_row_groups.size();
                                                 });
 
-  // Converts Column chunk statistics to a table
-  // where min(col[i]) = columns[i*2], max(col[i])=columns[i*2+1]
-  // For each column, it contains #sources * #column_chunks_per_src rows.
-  std::vector<std::unique_ptr<column>> columns;
-  stats_caster stats_col{total_row_groups, per_file_metadata, input_row_group_indices};
+  // Collects column chunk statistics, one per row group for each output column
+  std::vector<std::vector<encoded_min_max>> stats(output_dtypes.size());
+  std::vector<Type> physical_types(output_dtypes.size());
   for (size_t col_idx = 0; col_idx < output_dtypes.size(); col_idx++) {
     auto const& dtype = output_dtypes[col_idx];
-    // Only comparable types except fixed point are supported.
-    if (cudf::is_compound(dtype) && dtype.id() != cudf::type_id::STRING) {
-      // placeholder only for unsupported types.
-      columns.push_back(cudf::make_numeric_column(
-        data_type{cudf::type_id::BOOL8}, total_row_groups, rmm::device_buffer{}, 0, stream, mr));
-      columns.push_back(cudf::make_numeric_column(
-        data_type{cudf::type_id::BOOL8}, total_row_groups, rmm::device_buffer{}, 0, stream, mr));
-      continue;
+    if (cudf::is_compound(dtype) && dtype.id() != cudf::type_id::STRING) { continue; }
+    auto const schema_idx   = output_column_schemas[col_idx];
+    physical_types[col_idx] = get_schema(schema_idx).type;
+    for (size_t src_idx = 0; src_idx < input_row_group_indices.size(); ++src_idx) {
+      for (auto const rg_idx : input_row_group_indices[src_idx]) {
+        auto const& col_meta = get_column_metadata(rg_idx, src_idx, schema_idx);
+        // To support deprecated min, max fields.
+        auto const& min_value = col_meta.statistics.min_value.size() > 0
+                                  ? col_meta.statistics.min_value
+                                  : col_meta.statistics.min;
+        auto const& max_value = col_meta.statistics.max_value.size() > 0
+                                  ? col_meta.statistics.max_value
+                                  : col_meta.statistics.max;
+        stats[col_idx].push_back({&min_value, &max_value});
+      }
     }
-    auto [min_col, max_col] =
-      cudf::type_dispatcher<dispatch_storage_type>(dtype, stats_col, col_idx, dtype, stream, mr);
-    columns.push_back(std::move(min_col));
-    columns.push_back(std::move(max_col));
-  }
-  auto stats_table = cudf::table(std::move(columns));
-
-  // Converts AST to StatsAST with reference to min, max columns in above `stats_table`.
-  stats_expression_converter stats_expr{filter, static_cast<size_type>(output_dtypes.size())};
-  auto stats_ast     = stats_expr.get_stats_expr();
-  auto predicate_col = cudf::detail::compute_column(stats_table, stats_ast.get(), stream, mr);
-  auto predicate     = predicate_col->view();
-  CUDF_EXPECTS(predicate.type().id() == cudf::type_id::BOOL8,
-               "Filter expression must return a boolean column");
-
-  auto num_bitmasks = num_bitmask_words(predicate.size());
-  std::vector<bitmask_type> host_bitmask(num_bitmasks, ~bitmask_type{0});
-  if (predicate.nullable()) {
-    CUDF_CUDA_TRY(cudaMemcpyAsync(host_bitmask.data(),
-                                  predicate.null_mask(),
-                                  num_bitmasks * sizeof(bitmask_type),
-                                  cudaMemcpyDefault,
-                                  stream.value()));
   }
-  auto validity_it = cudf::detail::make_counting_transform_iterator(
-    0, [bitmask = host_bitmask.data()](auto bit_index) { return bit_is_set(bitmask, bit_index); });
 
-  auto is_row_group_required = cudf::detail::make_std_vector_sync(
-    device_span<uint8_t const>(predicate.data<uint8_t>(), predicate.size()), stream);
+  auto const decoded_stats = decode_stats(stats, output_dtypes, physical_types, filter.get());
+  auto is_row_group_required = evaluate_stats_filter(
+    decoded_stats, output_dtypes, filter.get(), total_row_groups, cudf::get_default_stream());
+  filter_row_groups_with_bloom_filters(sources,
+                                       input_row_group_indices,
+                                       output_dtypes,
+                                       output_column_schemas,
+                                       filter,
+                                       is_row_group_required);
 
   // Return only filtered row groups based on predicate
   // if all are required or all are nulls, return.
-  if (std::all_of(is_row_group_required.cbegin(),
-                  is_row_group_required.cend(),
-                  [](auto i) { return bool(i); }) or
-      predicate.null_count() == predicate.size()) {
+  if (std::all_of(is_row_group_required.cbegin(), is_row_group_required.cend(), [](auto i) {
+        return bool(i);
+      })) {
     return std::nullopt;
   }
   size_type is_required_idx = 0;
   for (size_t src_idx = 0; src_idx < input_row_group_indices.size(); ++src_idx) {
     std::vector<size_type> filtered_row_groups;
     for (auto const rg_idx : input_row_group_indices[src_idx]) {
-      if ((!validity_it[is_required_idx]) || is_row_group_required[is_required_idx]) {
-        filtered_row_groups.push_back(rg_idx);
-      }
+      if (is_row_group_required[is_required_idx]) { filtered_row_groups.push_back(rg_idx); }
       ++is_required_idx;
     }
     filtered_row_group_indices.push_back(std::move(filtered_row_groups));
@@ -471,6 +316,392 @@ std::optional<std::vector<std::vector<size_type>>> aggregate_reader_metadata::fi
   return {std::move(filtered_row_group_indices)};
 }
 
+void aggregate_reader_metadata::filter_row_groups_with_bloom_filters(
+  host_span<std::unique_ptr<datasource> const> sources,
+  host_span<std::vector<size_type> const> row_group_indices,
+  host_span<data_type const> output_dtypes,
+  host_span<int const> output_column_schemas,
+  std::reference_wrapper<ast::expression const> filter,
+  std::vector<bool>& is_row_group_required) const
+{
+  auto stream = cudf::get_default_stream();
+
+  // Hashes of the literals compared with each column, if they can be checked in Bloom filters
+  std::map<std::pair<size_type, ast::literal const*>, std::optional<std::vector<uint64_t>>>
+    literal_hashes;
+  std::vector<size_type> bloom_filter_columns;
+  for_each_column_literal_equality(filter.get(), [&](size_type col_idx, ast::literal const& lit) {
+    auto [it, inserted] = literal_hashes.try_emplace({col_idx, &lit});
+    if (not inserted or static_cast<size_t>(col_idx) >= output_dtypes.size()) { return; }
+    auto const& scalar = lit.get_scalar();
+    auto& hashes       = it->second;
+    if (scalar.type() != output_dtypes[col_idx] or not scalar.is_valid(stream)) { return; }
+    hashes = cudf::type_dispatcher(scalar.type(),
+                                   literal_bloom_filter_hashes{},
+                                   scalar,
+                                   get_schema(output_column_schemas[col_idx]).type,
+                                   stream);
+    if (hashes.has_value()) { bloom_filter_columns.push_back(col_idx); }
+  });
+  std::sort(bloom_filter_columns.begin(), bloom_filter_columns.end());
+  bloom_filter_columns.erase(std::unique(bloom_filter_columns.begin(), bloom_filter_columns.end()),
+                             bloom_filter_columns.end());
+  if (bloom_filter_columns.empty()) { return; }
+
+  // Bitsets of the Bloom filters of each row group, one per column in `bloom_filter_columns`;
+  // empty if the column chunk has no Bloom filter
+  std::vector<std::vector<std::vector<uint32_t>>> bitsets(is_row_group_required.size());
+
+  // Header of a Bloom filter, if its total length is not in the column chunk metadata
+  constexpr size_t bloom_filter_header_max_size = 64;
+
+  size_t rg_offset = 0;
+  for (size_t src_idx = 0; src_idx < row_group_indices.size(); ++src_idx) {
+    auto const& rg_indices = row_group_indices[src_idx];
+
+    // (row group, column) of each range read from the source
+    std::vector<std::pair<size_t, size_t>> range_chunks;
+    std::vector<datasource::range> ranges;
+    for (size_t rg = 0; rg < rg_indices.size(); ++rg) {
+      auto const rg_idx = rg_offset + rg;
+      if (not is_row_group_required[rg_idx]) { continue; }
+      bitsets[rg_idx].resize(bloom_filter_columns.size());
+      for (size_t col = 0; col < bloom_filter_columns.size(); ++col) {
+        auto const& col_meta = get_column_metadata(
+          rg_indices[rg], src_idx, output_column_schemas[bloom_filter_columns[col]]);
+        if (col_meta.bloom_filter_offset <= 0) { continue; }
+        auto const length = col_meta.bloom_filter_length > 0
+                              ? static_cast<size_t>(col_meta.bloom_filter_length)
+                              : bloom_filter_header_max_size;
+        range_chunks.emplace_back(rg_idx, col);
+        ranges.push_back({static_cast<size_t>(col_meta.bloom_filter_offset), length});
+      }
+    }
+    rg_offset += rg_indices.size();
+    if (ranges.empty()) { continue; }
+
+    // Parses the headers, and reads the bitsets not contained in the first reads
+    auto const buffers = sources[src_idx]->host_read_ranges(ranges);
+    std::vector<std::pair<size_t, size_t>> bitset_chunks;
+    std::vector<datasource::range> bitset_ranges;
+    for (size_t i = 0; i < buffers.size(); ++i) {
+      BloomFilterHeader header;
+      CompactProtocolReader cp(buffers[i]->data(), buffers[i]->size());
+      auto const is_valid = cp.read(&header) and header.algorithm.isset.BLOCK and
+                            header.hash.isset.XXHASH and header.compression.isset.UNCOMPRESSED and
+                            header.num_bytes > 0 and
+                            header.num_bytes % bloom_filter_block_bytes == 0 and
+                            static_cast<uint32_t>(header.num_bytes) <= bloom_filter_max_bytes;
+      if (not is_valid) { continue; }
+      auto const [rg_idx, col] = range_chunks[i];
+      auto const bitset_offset = static_cast<size_t>(cp.bytecount());
+      auto const bitset_size   = static_cast<size_t>(header.num_bytes);
+      auto& bitset             = bitsets[rg_idx][col];
+      bitset.resize(bitset_size / sizeof(uint32_t));
+      if (bitset_offset + bitset_size <= buffers[i]->size()) {
+        std::memcpy(bitset.data(), buffers[i]->data() + bitset_offset, bitset_size);
+      } else {
+        bitset_chunks.emplace_back(rg_idx, col);
+        bitset_ranges.push_back({ranges[i].offset + bitset_offset, bitset_size});
+      }
+    }
+    if (bitset_ranges.empty()) { continue; }
+    auto const bitset_buffers = sources[src_idx]->host_read_ranges(bitset_ranges);
+    for (size_t i = 0; i < bitset_buffers.size(); ++i) {
+      auto const [rg_idx, col] = bitset_chunks[i];
+      auto& bitset             = bitsets[rg_idx][col];
+      if (bitset_buffers[i]->size() < bitset_ranges[i].size) {
+        bitset.clear();
+        continue;
+      }
+      std::memcpy(bitset.data(), bitset_buffers[i]->data(), bitset_ranges[i].size);
+    }
+  }
+
+  for (size_t rg_idx = 0; rg_idx < is_row_group_required.size(); ++rg_idx) {
+    if (not is_row_group_required[rg_idx]) { continue; }
+    auto const may_equal = [&](size_type col_idx, ast::literal const& lit) {
+      auto const& hashes = literal_hashes.at({col_idx, &lit});
+      if (not hashes.has_value()) { return true; }
+      auto const col = std::distance(
+        bloom_filter_columns.begin(),
+        std::lower_bound(bloom_filter_columns.begin(), bloom_filter_columns.end(), col_idx));
+      auto const& bitset = bitsets[rg_idx][col];
+      if (bitset.empty()) { return true; }
+      auto const num_blocks = bitset.size() / bloom_filter_block_words;
+      return std::any_of(hashes->begin(), hashes->end(), [&](auto hash) {
+        return bloom_filter_check(bitset.data(), num_blocks, hash);
+      });
+    };
+    is_row_group_required[rg_idx] = may_satisfy(filter.get(), may_equal);
+  }
+}
+
+std::optional<std::vector<row_group_info>> aggregate_reader_metadata::filter_pages(
+  host_span<std::unique_ptr<datasource> const> sources,
+  host_span<row_group_info const> row_groups_info,
+  host_span<int const> input_column_schemas,
+  host_span<data_type const> output_dtypes,
+  host_span<int const> output_column_schemas,
+  std::reference_wrapper<ast::expression const> filter) const
+{
+  // Pages of repeated columns may not start at row boundaries in the absence of page indexes;
+  // restrict pruning to columns where rows and values match
+  if (std::any_of(input_column_schemas.begin(), input_column_schemas.end(), [&](auto schema_idx) {
+        return get_schema(schema_idx).max_repetition_level > 0;
+      })) {
+    return std::nullopt;
+  }
+
+  // Page indexes of each input column in each row group
+  struct column_page_index {
+    OffsetIndex offsets;
+    std::optional<ColumnIndex> stats;
+    size_t chunk_offset = 0;  // File offset of the column chunk, including its dictionary page
+  };
+  std::vector<std::vector<column_page_index>> page_indexes(row_groups_info.size());
+  std::vector<bool> has_page_indexes(row_groups_info.size(), false);
+  for (size_t rg = 0; rg < row_groups_info.size(); ++rg) {
+    auto const& rg_info   = row_groups_info[rg];
+    auto const& row_group = get_row_group(rg_info.index, rg_info.source_index);
+    std::vector<ColumnChunk const*> col_chunks;
+    for (auto const schema_idx : input_column_schemas) {
+      auto const it =
+        std::find_if(row_group.columns.cbegin(),
+                     row_group.columns.cend(),
+                     [schema_idx](auto const& col) { return col.schema_idx == schema_idx; });
+      CUDF_EXPECTS(it != row_group.columns.cend(), "Found no metadata for schema index");
+      col_chunks.push_back(&*it);
+    }
+    if (std::any_of(col_chunks.cbegin(), col_chunks.cend(), [](auto const* chunk) {
+          return chunk->offset_index_length <= 0;
+        })) {
+      continue;
+    }
+
+    // Read all page indexes of the row group through a single vectored read
+    std::vector<datasource::range> ranges;
+    for (auto const* chunk : col_chunks) {
+      ranges.push_back({static_cast<size_t>(chunk->offset_index_offset),
+                        static_cast<size_t>(chunk->offset_index_length)});
+      if (chunk->column_index_length > 0) {
+        ranges.push_back({static_cast<size_t>(chunk->column_index_offset),
+                          static_cast<size_t>(chunk->column_index_length)});
+      }
+    }
+    auto const buffers = sources[rg_info.source_index]->host_read_ranges(ranges);
+
+    auto& rg_indexes = page_indexes[rg];
+    size_t buf_idx   = 0;
+    bool is_valid    = true;
+    for (size_t col = 0; col < col_chunks.size(); ++col) {
+      auto const* chunk = col_chunks[col];
+      auto& col_index   = rg_indexes.emplace_back();
+      CompactProtocolReader cp(buffers[buf_idx]->data(), buffers[buf_idx]->size());
+      ++buf_idx;
+      is_valid =
+        is_valid && cp.read(&col_index.offsets) && !col_index.offsets.page_locations.empty();
+      if (chunk->column_index_length > 0) {
+        cp.init(buffers[buf_idx]->data(), buffers[buf_idx]->size());
+        ++buf_idx;
+        if (cp.read(&col_index.stats.emplace()) &&
+            col_index.stats->min_values.size() == col_index.offsets.page_locations.size() &&
+            col_index.stats->max_values.size() == col_index.offsets.page_locations.size()) {
+          if (col_index.stats->null_pages.size() != col_index.stats->min_values.size()) {
+            col_index.stats->null_pages.assign(col_index.stats->min_values.size(), false);
+          }
+        } else {
+          col_index.stats.reset();
+        }
+      }
+      auto const& col_meta   = chunk->meta_data;
+      col_index.chunk_offset =
+        (col_meta.dictionary_page_offset != 0)
+          ? std::min(col_meta.data_page_offset, col_meta.dictionary_page_offset)
+          : col_meta.data_page_offset;
+      is_valid = is_valid && col_index.offsets.page_locations.front().first_row_index == 0 &&
+                 static_cast<int64_t>(col_index.chunk_offset) <=
+                   col_index.offsets.page_locations.front().offset;
+    }
+    has_page_indexes[rg] = is_valid;
+  }
+  if (std::none_of(has_page_indexes.cbegin(), has_page_indexes.cend(), [](auto b) { return b; })) {
+    return std::nullopt;
+  }
+
+  // Position of each output column among the input columns, if it is one
+  std::vector<std::optional<size_t>> output_input_idx(output_dtypes.size());
+  for (size_t col_idx = 0; col_idx < output_dtypes.size(); ++col_idx) {
+    auto const it = std::find(
+      input_column_schemas.begin(), input_column_schemas.end(), output_column_schemas[col_idx]);
+    if (it != input_column_schemas.end()) {
+      output_input_idx[col_idx] = std::distance(input_column_schemas.begin(), it);
+    }
+  }
+
+  // Split each row group at the page boundaries of the output columns, so that each segment of
+  // rows is covered by a single page of every output column
+  auto const page_first_row = [](OffsetIndex const& offsets, size_t page) {
+    return offsets.page_locations[page].first_row_index;
+  };
+  std::vector<std::vector<int64_t>> segment_bounds(row_groups_info.size());
+  size_type num_segments = 0;
+  for (size_t rg = 0; rg < row_groups_info.size(); ++rg) {
+    if (not has_page_indexes[rg]) { continue; }
+    auto const& rg_info = row_groups_info[rg];
+    auto& bounds        = segment_bounds[rg];
+    bounds.push_back(0);
+    bounds.push_back(get_row_group(rg_info.index, rg_info.source_index).num_rows);
+    for (auto const& input_idx : output_input_idx) {
+      if (not input_idx.has_value()) { continue; }
+      auto const& offsets = page_indexes[rg][input_idx.value()].offsets;
+      for (size_t page = 0; page < offsets.page_locations.size(); ++page) {
+        bounds.push_back(page_first_row(offsets, page));
+      }
+    }
+    std::sort(bounds.begin(), bounds.end());
+    bounds.erase(std::unique(bounds.begin(), bounds.end()), bounds.end());
+    num_segments += bounds.size() - 1;
+  }
+
+  // Collects page statistics, one per segment for each output column
+  std::vector<std::vector<encoded_min_max>> stats(output_dtypes.size());
+  std::vector<Type> physical_types(output_dtypes.size());
+  for (size_t col_idx = 0; col_idx < output_dtypes.size(); col_idx++) {
+    auto const& dtype = output_dtypes[col_idx];
+    if (cudf::is_compound(dtype) && dtype.id() != cudf::type_id::STRING) { continue; }
+    physical_types[col_idx] = get_schema(output_column_schemas[col_idx]).type;
+    for (size_t rg = 0; rg < row_groups_info.size(); ++rg) {
+      auto const& bounds = segment_bounds[rg];
+      for (size_t seg = 0; seg + 1 < bounds.size(); ++seg) {
+        auto& seg_stats = stats[col_idx].emplace_back();
+        if (not output_input_idx[col_idx].has_value()) { continue; }
+        auto const& col_index = page_indexes[rg][output_input_idx[col_idx].value()];
+        if (not col_index.stats.has_value()) { continue; }
+        auto const& locations = col_index.offsets.page_locations;
+        auto const page =
+          std::distance(locations.cbegin(),
+                        std::upper_bound(locations.cbegin(),
+                                         locations.cend(),
+                                         bounds[seg],
+                                         [](int64_t row, auto const& loc) {
+                                           return row < loc.first_row_index;
+                                         })) -
+          1;
+        // Pages with only nulls have no min and max values
+        if (col_index.stats->null_pages[page]) { continue; }
+        seg_stats = {&col_index.stats->min_values[page], &col_index.stats->max_values[page]};
+      }
+    }
+  }
+
+  auto const decoded_stats = decode_stats(stats, output_dtypes, physical_types, filter.get());
+  auto const is_segment_required = evaluate_stats_filter(
+    decoded_stats, output_dtypes, filter.get(), num_segments, cudf::get_default_stream());
+  if (std::all_of(is_segment_required.cbegin(), is_segment_required.cend(), [](auto i) {
+        return bool(i);
+      })) {
+    return std::nullopt;
+  }
+
+  // Each required range of rows is extended to the page boundaries of all input columns and
+  // read as a separate slice of its row group
+  std::vector<row_group_info> selection;
+  size_t start_row   = 0;
+  size_type seg_base = 0;
+  for (size_t rg = 0; rg < row_groups_info.size(); ++rg) {
+    auto const& rg_info = row_groups_info[rg];
+    auto const rg_rows  = get_row_group(rg_info.index, rg_info.source_index).num_rows;
+    if (not has_page_indexes[rg]) {
+      selection.emplace_back(rg_info.index, start_row, rg_info.source_index);
+      start_row += rg_rows;
+      continue;
+    }
+    auto const& bounds = segment_bounds[rg];
+    std::vector<std::pair<int64_t, int64_t>> row_ranges;
+    for (size_t seg = 0; seg + 1 < bounds.size(); ++seg) {
+      if (not is_segment_required[seg_base + seg]) { continue; }
+      if (not row_ranges.empty() && row_ranges.back().second == bounds[seg]) {
+        row_ranges.back().second = bounds[seg + 1];
+      } else {
+        row_ranges.emplace_back(bounds[seg], bounds[seg + 1]);
+      }
+    }
+    seg_base += bounds.size() - 1;
+
+    auto const page_range = [&](column_page_index const& col_index, int64_t begin, int64_t end) {
+      auto const& locations = col_index.offsets.page_locations;
+      auto const first      = std::upper_bound(locations.cbegin(),
+                                          locations.cend(),
+                                          begin,
+                                          [](int64_t row, auto const& loc) {
+                                            return row < loc.first_row_index;
+                                          }) -
+                         1;
+      auto const last = std::lower_bound(locations.cbegin(),
+                                         locations.cend(),
+                                         end,
+                                         [](auto const& loc, int64_t row) {
+                                           return loc.first_row_index < row;
+                                         });
+      return std::pair{first, last};
+    };
+    std::vector<std::pair<int64_t, int64_t>> slices;
+    for (auto [begin, end] : row_ranges) {
+      // Extend the range until it starts and ends at page boundaries of every input column
+      bool is_aligned = false;
+      while (not is_aligned) {
+        is_aligned = true;
+        for (auto const& col_index : page_indexes[rg]) {
+          auto const [first, last] = page_range(col_index, begin, end);
+          auto const new_begin     = first->first_row_index;
+          auto const new_end =
+            last == col_index.offsets.page_locations.cend() ? rg_rows : last->first_row_index;
+          is_aligned = is_aligned && new_begin == begin && new_end == end;
+          begin      = new_begin;
+          end        = new_end;
+        }
+      }
+      if (not slices.empty() && slices.back().second >= begin) {
+        slices.back().second = std::max(slices.back().second, end);
+      } else {
+        slices.emplace_back(begin, end);
+      }
+    }
+
+    for (auto const [begin, end] : slices) {
+      std::vector<std::vector<datasource::range>> page_ranges;
+      for (auto const& col_index : page_indexes[rg]) {
+        auto const [first, last] = page_range(col_index, begin, end);
+        auto& col_ranges         = page_ranges.emplace_back();
+        auto const& first_page   = col_index.offsets.page_locations.front();
+        // The dictionary page precedes the first data page
+        if (static_cast<int64_t>(col_index.chunk_offset) < first_page.offset) {
+          col_ranges.push_back({col_index.chunk_offset,
+                                static_cast<size_t>(first_page.offset) - col_index.chunk_offset});
+        }
+        auto const& last_page  = *(last - 1);
+        auto const pages_begin = static_cast<size_t>(first->offset);
+        auto const pages_end =
+          static_cast<size_t>(last_page.offset + last_page.compressed_page_size);
+        if (not col_ranges.empty() &&
+            col_ranges.back().offset + col_ranges.back().size == pages_begin) {
+          col_ranges.back().size += pages_end - pages_begin;
+        } else {
+          col_ranges.push_back({pages_begin, pages_end - pages_begin});
+        }
+      }
+      selection.emplace_back(rg_info.index,
+                             start_row,
+                             rg_info.source_index,
+                             static_cast<size_type>(end - begin),
+                             std::move(page_ranges));
+      start_row += end - begin;
+    }
+  }
+  return {std::move(selection)};
+}
+
 // convert column named expression to column index reference expression
 std::reference_wrapper<ast::expression const> named_to_reference_converter::visit(
   ast::literal const& expr)
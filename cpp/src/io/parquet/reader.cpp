@@ -14,8 +14,12 @@
  * limitations under the License.
  */
 
+#include "dataset_metadata.hpp"
 #include "reader_impl.hpp"
 
+#include <algorithm>
+#include <iterator>
+
 namespace cudf::io::detail::parquet {
 
 reader::reader() = default;
@@ -28,6 +32,24 @@ reader::reader(std::vector<std::unique_ptr<datasource>>&& sources,
 {
 }
 
+reader::reader(std::vector<std::unique_ptr<datasource>>&& sources,
+               parquet_dataset_metadata const& dataset,
+               host_span<size_type const> file_indices,
+               parquet_reader_options const& options,
+               rmm::cuda_stream_view stream,
+               rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(sources.size() == file_indices.size(), "Expected one file index per source");
+  std::vector<metadata> sources_metadata;
+  sources_metadata.reserve(file_indices.size());
+  std::transform(file_indices.begin(),
+                 file_indices.end(),
+                 std::back_inserter(sources_metadata),
+                 [&](auto file_idx) { return metadata(dataset._impl->file_metadata(file_idx)); });
+  _impl =
+    std::make_unique<impl>(std::move(sources), std::move(sources_metadata), options, stream, mr);
+}
+
 reader::~reader() = default;
 
 table_with_metadata reader::read(parquet_reader_options const& options)
@@ -272,15 +272,41 @@ reader::impl::impl(std::vector<std::unique_ptr<datasource>>&& sources,
 {
 }
 
+reader::impl::impl(std::vector<std::unique_ptr<datasource>>&& sources,
+                   std::vector<metadata>&& sources_metadata,
+                   parquet_reader_options const& options,
+                   rmm::cuda_stream_view stream,
+                   rmm::mr::device_memory_resource* mr)
+  : impl(0 /*chunk_read_limit*/,
+         std::move(sources),
+         std::move(sources_metadata),
+         options,
+         stream,
+         mr)
+{
+}
+
 reader::impl::impl(std::size_t chunk_read_limit,
                    std::vector<std::unique_ptr<datasource>>&& sources,
                    parquet_reader_options const& options,
                    rmm::cuda_stream_view stream,
                    rmm::mr::device_memory_resource* mr)
+  : impl(chunk_read_limit, std::move(sources), std::vector<metadata>{}, options, stream, mr)
+{
+}
+
+reader::impl::impl(std::size_t chunk_read_limit,
+                   std::vector<std::unique_ptr<datasource>>&& sources,
+                   std::vector<metadata>&& sources_metadata,
+                   parquet_reader_options const& options,
+                   rmm::cuda_stream_view stream,
+                   rmm::mr::device_memory_resource* mr)
   : _stream{stream}, _mr{mr}, _sources{std::move(sources)}, _chunk_read_limit{chunk_read_limit}
 {
-  // Open and parse the source dataset metadata
-  _metadata = std::make_unique<aggregate_reader_metadata>(_sources);
+  // Open and parse the source dataset metadata, unless it is given
+  _metadata = sources_metadata.empty()
+                ? std::make_unique<aggregate_reader_metadata>(_sources)
+                : std::make_unique<aggregate_reader_metadata>(std::move(sources_metadata));
 
   // Override output timestamp resolution if requested
   if (options.get_timestamp_type().id() != type_id::EMPTY) {
@@ -300,6 +326,14 @@ reader::impl::impl(std::size_t chunk_read_limit,
                               _strings_to_categorical,
                               _timestamp_type.id());
 
+  // Decode the column chunk metadata of the selected columns only
+  std::vector<int> input_schema_indices;
+  std::transform(_input_columns.cbegin(),
+                 _input_columns.cend(),
+                 std::back_inserter(input_schema_indices),
+                 [](auto const& col) { return col.schema_idx; });
+  _metadata->decode_column_metadata(input_schema_indices);
+
   // Save the states of the output buffers for reuse in `chunk_read()`.
   // Don't need to do it if we read the file all at once.
   if (_chunk_read_limit > 0) {
@@ -325,8 +359,41 @@ void reader::impl::prepare_data(int64_t skip_rows,
                    std::back_inserter(output_types),
                    [](auto const& col) { return col.type; });
   }
-  auto const [skip_rows_corrected, num_rows_corrected, row_groups_info] =
-    _metadata->select_row_groups(row_group_indices, skip_rows, num_rows, output_types, filter);
+  auto [skip_rows_corrected, num_rows_corrected, row_groups_info] =
+    _metadata->select_row_groups(_sources,
+                                 row_group_indices,
+                                 skip_rows,
+                                 num_rows,
+                                 output_types,
+                                 _output_column_schemas,
+                                 filter);
+
+  // Prune the pages of the selected row groups when all of their rows are read
+  if (filter.has_value() && skip_rows == 0 && not num_rows.has_value() &&
+      num_rows_corrected > 0 && _input_columns.size() != 0) {
+    std::vector<int> input_schema_indices;
+    std::transform(_input_columns.cbegin(),
+                   _input_columns.cend(),
+                   std::back_inserter(input_schema_indices),
+                   [](auto const& col) { return col.schema_idx; });
+    auto page_selection = _metadata->filter_pages(_sources,
+                                                  row_groups_info,
+                                                  input_schema_indices,
+                                                  output_types,
+                                                  _output_column_schemas,
+                                                  filter.value());
+    if (page_selection.has_value()) {
+      row_groups_info    = std::move(page_selection.value());
+      num_rows_corrected = std::accumulate(row_groups_info.cbegin(),
+                                           row_groups_info.cend(),
+                                           size_type{0},
+                                           [&](auto sum, auto const& rg) {
+                                             auto const& row_group =
+                                               _metadata->get_row_group(rg.index, rg.source_index);
+                                             return sum + rg.num_rows.value_or(row_group.num_rows);
+                                           });
+    }
+  }
 
   if (num_rows_corrected > 0 && row_groups_info.size() != 0 && _input_columns.size() != 0) {
     load_and_decompress_data(row_groups_info, num_rows_corrected);
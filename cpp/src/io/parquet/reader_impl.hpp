@@ -58,6 +58,24 @@ class reader::impl {
                 rmm::cuda_stream_view stream,
                 rmm::mr::device_memory_resource* mr);
 
+  /**
+   * @brief Constructor from an array of dataset sources and their metadata, with reader options.
+   *
+   * The footers of the sources are not read; e.g. the metadata is taken from the summary of the
+   * dataset instead. A source is only read from if some of its row groups are read.
+   *
+   * @param sources Dataset sources
+   * @param sources_metadata Metadata of each source
+   * @param options Settings for controlling reading behavior
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   * @param mr Device memory resource to use for device memory allocation
+   */
+  explicit impl(std::vector<std::unique_ptr<datasource>>&& sources,
+                std::vector<metadata>&& sources_metadata,
+                parquet_reader_options const& options,
+                rmm::cuda_stream_view stream,
+                rmm::mr::device_memory_resource* mr);
+
   /**
    * @brief Read an entire set or a subset of data and returns a set of columns
    *
@@ -117,6 +135,24 @@ class reader::impl {
   table_with_metadata read_chunk();
 
  private:
+  /**
+   * @brief Constructor shared by the public constructors.
+   *
+   * @param chunk_read_limit Limit on total number of bytes to be returned per read,
+   *        or `0` if there is no limit
+   * @param sources Dataset sources
+   * @param sources_metadata Metadata of each source; read from the sources if empty
+   * @param options Settings for controlling reading behavior
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   * @param mr Device memory resource to use for device memory allocation
+   */
+  impl(std::size_t chunk_read_limit,
+       std::vector<std::unique_ptr<datasource>>&& sources,
+       std::vector<metadata>&& sources_metadata,
+       parquet_reader_options const& options,
+       rmm::cuda_stream_view stream,
+       rmm::mr::device_memory_resource* mr);
+
   /**
    * @brief Perform the necessary data preprocessing for parsing file later on.
    *
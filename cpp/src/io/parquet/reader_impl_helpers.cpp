@@ -16,6 +16,8 @@
 
 #include "reader_impl_helpers.hpp"
 
+#include <io/utilities/config_utils.hpp>
+#include <io/utilities/metadata_cache.hpp>
 #include <io/utilities/row_selection.hpp>
 
 #include <numeric>
@@ -25,6 +27,18 @@ namespace cudf::io::detail::parquet {
 
 namespace {
 
+/**
+ * @brief Returns true if the decoding of column chunk metadata in Parquet footers is deferred until
+ * the selected columns are known.
+ */
+bool is_footer_decode_deferred()
+{
+  static auto const env_val = getenv_or<std::string>("LIBCUDF_PARQUET_FOOTER_DECODE", "EAGER");
+  if (env_val == "EAGER") return false;
+  if (env_val == "LAZY") return true;
+  CUDF_FAIL("Invalid LIBCUDF_PARQUET_FOOTER_DECODE value: " + env_val);
+}
+
 ConvertedType logical_type_to_converted_type(LogicalType const& logical)
 {
   if (logical.isset.STRING) {
@@ -177,6 +191,17 @@ type_id to_type_id(SchemaElement const& schema,
 
 metadata::metadata(datasource* source)
 {
+  auto& cache         = metadata_cache::instance();
+  auto const identity = cache.is_enabled() ? source->identity() : std::nullopt;
+  if (identity.has_value()) {
+    auto const cached =
+      cache.get<FileMetaData>(metadata_cache::file_format::PARQUET, identity.value());
+    if (cached != nullptr) {
+      static_cast<FileMetaData&>(*this) = *cached;
+      return;
+    }
+  }
+
   constexpr auto header_len = sizeof(file_header_s);
   constexpr auto ender_len  = sizeof(file_ender_s);
 
@@ -193,8 +218,50 @@ metadata::metadata(datasource* source)
 
   auto const buffer = source->host_read(len - ender->footer_len - ender_len, ender->footer_len);
   CompactProtocolReader cp(buffer->data(), ender->footer_len);
+  if (is_footer_decode_deferred()) {
+    // Column chunk metadata is decoded from a copy of the footer, once the projection is known
+    encoded_footer =
+      std::make_shared<std::vector<uint8_t> const>(buffer->data(), buffer->data() + buffer->size());
+    cp.defer_column_metadata();
+  }
   CUDF_EXPECTS(cp.read(this), "Cannot parse metadata");
   CUDF_EXPECTS(cp.InitSchema(this), "Cannot initialize schema");
+
+  if (identity.has_value()) {
+    // The entry holds the decoded metadata, plus the encoded footer when its decoding is deferred
+    auto const entry_size =
+      ender->footer_len + (encoded_footer != nullptr ? encoded_footer->size() : 0);
+    cache.insert(metadata_cache::file_format::PARQUET,
+                 identity.value(),
+                 std::make_shared<FileMetaData>(*this),
+                 entry_size);
+  }
+}
+
+metadata::metadata(FileMetaData&& file_metadata) : FileMetaData(std::move(file_metadata))
+{
+  CompactProtocolReader cp;
+  CUDF_EXPECTS(cp.InitSchema(this), "Cannot initialize schema");
+}
+
+void metadata::decode_column_metadata(host_span<int const> schema_indices)
+{
+  if (encoded_footer == nullptr) { return; }
+
+  std::vector<bool> is_selected(schema.size(), false);
+  for (auto const schema_idx : schema_indices) {
+    if (schema_idx >= 0 && static_cast<size_t>(schema_idx) < schema.size()) {
+      is_selected[schema_idx] = true;
+    }
+  }
+
+  CompactProtocolReader cp;
+  for (auto& row_group : row_groups) {
+    for (auto& chunk : row_group.columns) {
+      if (chunk.schema_idx < 0 || not is_selected[chunk.schema_idx]) { continue; }
+      CUDF_EXPECTS(cp.read_column_metadata(*this, &chunk), "Cannot parse column chunk metadata");
+    }
+  }
 }
 
 std::vector<metadata> aggregate_reader_metadata::metadatas_from_sources(
@@ -253,7 +320,12 @@ size_type aggregate_reader_metadata::calc_num_row_groups() const
 
 aggregate_reader_metadata::aggregate_reader_metadata(
   host_span<std::unique_ptr<datasource> const> sources)
-  : per_file_metadata(metadatas_from_sources(sources)),
+  : aggregate_reader_metadata(metadatas_from_sources(sources))
+{
+}
+
+aggregate_reader_metadata::aggregate_reader_metadata(std::vector<metadata>&& sources_metadata)
+  : per_file_metadata(std::move(sources_metadata)),
     keyval_maps(collect_keyval_metadata()),
     num_rows(calc_num_rows()),
     num_row_groups(calc_num_row_groups())
@@ -293,9 +365,17 @@ ColumnChunkMetaData const& aggregate_reader_metadata::get_column_metadata(size_t
                  [schema_idx](ColumnChunk const& col) { return col.schema_idx == schema_idx; });
   CUDF_EXPECTS(col != std::end(per_file_metadata[src_idx].row_groups[row_group_index].columns),
                "Found no metadata for schema index");
+  CUDF_EXPECTS(col->meta_data_length == 0, "Column chunk metadata has not been decoded");
   return col->meta_data;
 }
 
+void aggregate_reader_metadata::decode_column_metadata(host_span<int const> schema_indices)
+{
+  for (auto& pfm : per_file_metadata) {
+    pfm.decode_column_metadata(schema_indices);
+  }
+}
+
 std::string aggregate_reader_metadata::get_pandas_index() const
 {
   // Assumes that all input files have the same metadata
@@ -346,16 +426,18 @@ std::vector<std::string> aggregate_reader_metadata::get_pandas_index_names() con
 
 std::tuple<int64_t, size_type, std::vector<row_group_info>>
 aggregate_reader_metadata::select_row_groups(
+  host_span<std::unique_ptr<datasource> const> sources,
   host_span<std::vector<size_type> const> row_group_indices,
   int64_t skip_rows_opt,
   std::optional<size_type> const& num_rows_opt,
   host_span<data_type const> output_dtypes,
+  host_span<int const> output_column_schemas,
   std::optional<std::reference_wrapper<ast::expression const>> filter) const
 {
   std::optional<std::vector<std::vector<size_type>>> filtered_row_group_indices;
   if (filter.has_value()) {
-    filtered_row_group_indices =
-      filter_row_groups(row_group_indices, output_dtypes, filter.value());
+    filtered_row_group_indices = filter_row_groups(
+      sources, row_group_indices, output_dtypes, output_column_schemas, filter.value());
     if (filtered_row_group_indices.has_value()) {
       row_group_indices =
         host_span<std::vector<size_type> const>(filtered_row_group_indices.value());
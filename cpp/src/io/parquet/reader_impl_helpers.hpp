@@ -29,6 +29,7 @@
 #include <thrust/iterator/zip_iterator.h>
 
 #include <list>
+#include <optional>
 #include <tuple>
 #include <vector>
 
@@ -60,10 +61,25 @@ struct row_group_info {
   size_type const index;
   size_t const start_row;  // TODO source index
   size_type const source_index;
+  // Only set when a slice of the row group, covered by whole pages of every input column, is read
+  std::optional<size_type> const num_rows;
+  std::vector<std::vector<datasource::range>> const page_ranges;  // per input column
   row_group_info(size_type index, size_t start_row, size_type source_index)
     : index(index), start_row(start_row), source_index(source_index)
   {
   }
+  row_group_info(size_type index,
+                 size_t start_row,
+                 size_type source_index,
+                 size_type num_rows,
+                 std::vector<std::vector<datasource::range>>&& page_ranges)
+    : index(index),
+      start_row(start_row),
+      source_index(source_index),
+      num_rows(num_rows),
+      page_ranges(std::move(page_ranges))
+  {
+  }
 };
 
 /**
@@ -71,6 +87,20 @@ struct row_group_info {
  */
 struct metadata : public FileMetaData {
   explicit metadata(datasource* source);
+
+  /**
+   * @brief Constructor from metadata that was already read, e.g. from the summary of a dataset
+   *
+   * @param file_metadata Decoded metadata of the file
+   */
+  explicit metadata(FileMetaData&& file_metadata);
+
+  /**
+   * @brief Decodes the deferred column chunk metadata of the given schema leaves
+   *
+   * @param schema_indices Schema indices of the leaf columns whose chunk metadata is needed
+   */
+  void decode_column_metadata(host_span<int const> schema_indices);
 };
 
 class aggregate_reader_metadata {
@@ -104,12 +134,28 @@ class aggregate_reader_metadata {
  public:
   aggregate_reader_metadata(host_span<std::unique_ptr<datasource> const> sources);
 
+  /**
+   * @brief Constructor from the metadata of each source
+   *
+   * @param sources_metadata Metadata of each source
+   */
+  explicit aggregate_reader_metadata(std::vector<metadata>&& sources_metadata);
+
   [[nodiscard]] RowGroup const& get_row_group(size_type row_group_index, size_type src_idx) const;
 
   [[nodiscard]] ColumnChunkMetaData const& get_column_metadata(size_type row_group_index,
                                                                size_type src_idx,
                                                                int schema_idx) const;
 
+  /**
+   * @brief Decodes the deferred column chunk metadata of the given schema leaves in all sources
+   *
+   * Column chunk metadata is only retrieved through `get_column_metadata` once decoded.
+   *
+   * @param schema_indices Schema indices of the leaf columns whose chunk metadata is needed
+   */
+  void decode_column_metadata(host_span<int const> schema_indices);
+
   [[nodiscard]] auto get_num_rows() const { return num_rows; }
 
   [[nodiscard]] auto get_num_row_groups() const { return num_row_groups; }
@@ -167,14 +213,67 @@ class aggregate_reader_metadata {
   /**
    * @brief Filters the row groups based on predicate filter
    *
+   * Row groups are filtered on their column chunk statistics, and then on the Bloom filters of
+   * their column chunks.
+   *
+   * @param sources Dataset sources
    * @param row_group_indices Lists of row groups to read, one per source
    * @param output_dtypes List of output column datatypes
+   * @param output_column_schemas Schema indices of output columns
    * @param filter AST expression to filter row groups based on Column chunk statistics
    * @return Filtered row group indices, if any is filtered.
    */
   [[nodiscard]] std::optional<std::vector<std::vector<size_type>>> filter_row_groups(
+    host_span<std::unique_ptr<datasource> const> sources,
+    host_span<std::vector<size_type> const> row_group_indices,
+    host_span<data_type const> output_dtypes,
+    host_span<int const> output_column_schemas,
+    std::reference_wrapper<ast::expression const> filter) const;
+
+  /**
+   * @brief Filters the row groups based on the Bloom filters of their column chunks
+   *
+   * Evaluates equality comparisons of output columns with literals, combined with logical AND and
+   * OR operations, e.g. IN-lists. A comparison is false for all rows of a row group if the literal
+   * is absent from the Bloom filter of the column chunk. All other expressions may be true.
+   *
+   * @param sources Dataset sources
+   * @param row_group_indices Lists of row groups, one per source
+   * @param output_dtypes List of output column datatypes
+   * @param output_column_schemas Schema indices of output columns
+   * @param filter AST expression with references to output columns
+   * @param[in,out] is_row_group_required Whether each row group in `row_group_indices` is
+   * required; row groups that cannot satisfy the filter are marked as not required
+   */
+  void filter_row_groups_with_bloom_filters(
+    host_span<std::unique_ptr<datasource> const> sources,
     host_span<std::vector<size_type> const> row_group_indices,
     host_span<data_type const> output_dtypes,
+    host_span<int const> output_column_schemas,
+    std::reference_wrapper<ast::expression const> filter,
+    std::vector<bool>& is_row_group_required) const;
+
+  /**
+   * @brief Filters the pages of the selected row groups based on predicate filter
+   *
+   * Evaluates the filter on the page statistics in the ColumnIndex of the output columns. Each row
+   * group is reduced to slices of rows that start and end at page boundaries of all input columns,
+   * located through their OffsetIndex. Row groups without page indexes are read whole.
+   *
+   * @param sources Dataset sources
+   * @param row_groups_info Selected row groups, covering all of their rows
+   * @param input_column_schemas Schema indices of input columns
+   * @param output_dtypes List of output column datatypes
+   * @param output_column_schemas Schema indices of output columns
+   * @param filter AST expression to filter pages based on page statistics
+   * @return Selection of row group slices, if any page is filtered
+   */
+  [[nodiscard]] std::optional<std::vector<row_group_info>> filter_pages(
+    host_span<std::unique_ptr<datasource> const> sources,
+    host_span<row_group_info const> row_groups_info,
+    host_span<int const> input_column_schemas,
+    host_span<data_type const> output_dtypes,
+    host_span<int const> output_column_schemas,
     std::reference_wrapper<ast::expression const> filter) const;
 
   /**
@@ -183,20 +282,24 @@ class aggregate_reader_metadata {
    * The input `row_start` and `row_count` parameters will be recomputed and output as the valid
    * values based on the input row group list.
    *
+   * @param sources Dataset sources
    * @param row_group_indices Lists of row groups to read, one per source
    * @param row_start Starting row of the selection
    * @param row_count Total number of rows selected
    * @param output_dtypes List of output column datatypes
+   * @param output_column_schemas Schema indices of output columns
    * @param filter Optional AST expression to filter row groups based on Column chunk statistics
    *
    * @return A tuple of corrected row_start, row_count and list of row group indexes and its
    *         starting row
    */
   [[nodiscard]] std::tuple<int64_t, size_type, std::vector<row_group_info>> select_row_groups(
+    host_span<std::unique_ptr<datasource> const> sources,
     host_span<std::vector<size_type> const> row_group_indices,
     int64_t row_start,
     std::optional<size_type> const& row_count,
     host_span<data_type const> output_dtypes,
+    host_span<int const> output_column_schemas,
     std::optional<std::reference_wrapper<ast::expression const>> filter) const;
 
   /**
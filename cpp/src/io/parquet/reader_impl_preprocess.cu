@@ -235,6 +235,39 @@ template <typename T = uint8_t>
 {
   // Transfer chunk data, coalescing adjacent chunks
   std::vector<std::future<size_t>> read_tasks;
+
+  // Set the device pointers for all chunks covered by a single read
+  auto set_compressed_data = [&](size_t first_chunk, size_t last_chunk) {
+    auto d_compdata = page_data[first_chunk]->data();
+    for (auto c = first_chunk; c < last_chunk; ++c) {
+      chunks[c].compressed_data = d_compdata;
+      d_compdata += chunks[c].compressed_size;
+    }
+  };
+
+  // Host reads of the current row group, issued through a single vectored read
+  std::vector<datasource::range> host_ranges;
+  std::vector<std::pair<size_t, size_t>> host_range_chunks;
+  auto read_host_ranges = [&]() {
+    if (host_ranges.empty()) { return; }
+    auto& source            = sources[chunk_source_map[host_range_chunks.front().first]];
+    auto const read_buffers = source->host_read_ranges(host_ranges);
+    for (size_t r = 0; r < read_buffers.size(); ++r) {
+      auto const& read_buffer              = read_buffers[r];
+      auto const [first_chunk, last_chunk] = host_range_chunks[r];
+      // Buffer needs to be padded.
+      // Required by `gpuDecodePageData`.
+      auto tmp_buffer = rmm::device_buffer(
+        cudf::util::round_up_safe(read_buffer->size(), BUFFER_PADDING_MULTIPLE), stream);
+      CUDF_CUDA_TRY(cudaMemcpyAsync(
+        tmp_buffer.data(), read_buffer->data(), read_buffer->size(), cudaMemcpyDefault, stream));
+      page_data[first_chunk] = datasource::buffer::create(std::move(tmp_buffer));
+      set_compressed_data(first_chunk, last_chunk);
+    }
+    host_ranges.clear();
+    host_range_chunks.clear();
+  };
+
   for (size_t chunk = begin_chunk; chunk < end_chunk;) {
     size_t const io_offset   = column_chunk_offsets[chunk];
     size_t io_size           = chunks[chunk].compressed_size;
@@ -254,6 +287,16 @@ template <typename T = uint8_t>
       io_size += chunks[next_chunk].compressed_size;
       next_chunk++;
     }
+
+    // Chunks of the same row group share the source and the start row
+    if (not host_range_chunks.empty()) {
+      auto const pending_chunk = host_range_chunks.front().first;
+      if (chunk_source_map[pending_chunk] != chunk_source_map[chunk] ||
+          chunks[pending_chunk].start_row != chunks[chunk].start_row) {
+        read_host_ranges();
+      }
+    }
+
     if (io_size != 0) {
       auto& source = sources[chunk_source_map[chunk]];
       if (source->is_device_read_preferred(io_size)) {
@@ -265,25 +308,87 @@ template <typename T = uint8_t>
           io_offset, io_size, static_cast<uint8_t*>(buffer.data()), stream);
         read_tasks.emplace_back(std::move(fut_read_size));
         page_data[chunk] = datasource::buffer::create(std::move(buffer));
+        set_compressed_data(chunk, next_chunk);
       } else {
-        auto const read_buffer = source->host_read(io_offset, io_size);
-        // Buffer needs to be padded.
-        // Required by `gpuDecodePageData`.
-        auto tmp_buffer = rmm::device_buffer(
-          cudf::util::round_up_safe(read_buffer->size(), BUFFER_PADDING_MULTIPLE), stream);
-        CUDF_CUDA_TRY(cudaMemcpyAsync(
-          tmp_buffer.data(), read_buffer->data(), read_buffer->size(), cudaMemcpyDefault, stream));
-        page_data[chunk] = datasource::buffer::create(std::move(tmp_buffer));
+        host_ranges.push_back({io_offset, io_size});
+        host_range_chunks.emplace_back(chunk, next_chunk);
+      }
+    }
+    chunk = next_chunk;
+  }
+  read_host_ranges();
+
+  auto sync_fn = [](decltype(read_tasks) read_tasks) {
+    for (auto& task : read_tasks) {
+      task.wait();
+    }
+  };
+  return std::async(std::launch::deferred, sync_fn, std::move(read_tasks));
+}
+
+/**
+ * @brief Reads the pages of column chunks that cover a slice of their row group.
+ *
+ * The file ranges of each chunk are concatenated into a single buffer, so the chunk appears to
+ * consist of only its dictionary page and the selected data pages.
+ *
+ * @param source Dataset source of the row group
+ * @param page_data Buffers to hold compressed page data for each chunk
+ * @param chunks List of column chunk descriptors
+ * @param begin_chunk Index of first column chunk to read
+ * @param page_ranges File ranges of the pages to read, one list per column chunk
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ *
+ * @return A future object for reading synchronization
+ */
+[[nodiscard]] std::future<void> read_column_pages_async(
+  datasource& source,
+  std::vector<std::unique_ptr<datasource::buffer>>& page_data,
+  cudf::detail::hostdevice_vector<gpu::ColumnChunkDesc>& chunks,
+  size_t begin_chunk,
+  host_span<std::vector<datasource::range> const> page_ranges,
+  rmm::cuda_stream_view stream)
+{
+  std::vector<std::future<size_t>> read_tasks;
+  std::vector<datasource::range> host_ranges;
+  std::vector<uint8_t*> host_range_dsts;
+  for (size_t i = 0; i < page_ranges.size(); ++i) {
+    auto const chunk   = begin_chunk + i;
+    auto const io_size = std::accumulate(
+      page_ranges[i].begin(), page_ranges[i].end(), size_t{0}, [](auto sum, auto const& range) {
+        return sum + range.size;
+      });
+    // Buffer needs to be padded.
+    // Required by `gpuDecodePageData`.
+    auto buffer =
+      rmm::device_buffer(cudf::util::round_up_safe(io_size, BUFFER_PADDING_MULTIPLE), stream);
+    auto dst = static_cast<uint8_t*>(buffer.data());
+    chunks[chunk].compressed_data = dst;
+    chunks[chunk].compressed_size = io_size;
+    page_data[chunk]              = datasource::buffer::create(std::move(buffer));
+
+    for (auto const& range : page_ranges[i]) {
+      if (source.is_device_read_preferred(range.size)) {
+        read_tasks.emplace_back(source.device_read_async(range.offset, range.size, dst, stream));
+      } else {
+        host_ranges.push_back(range);
+        host_range_dsts.push_back(dst);
       }
-      auto d_compdata = page_data[chunk]->data();
-      do {
-        chunks[chunk].compressed_data = d_compdata;
-        d_compdata += chunks[chunk].compressed_size;
-      } while (++chunk != next_chunk);
-    } else {
-      chunk = next_chunk;
+      dst += range.size;
+    }
+  }
+
+  if (not host_ranges.empty()) {
+    auto const read_buffers = source.host_read_ranges(host_ranges);
+    for (size_t r = 0; r < read_buffers.size(); ++r) {
+      CUDF_CUDA_TRY(cudaMemcpyAsync(host_range_dsts[r],
+                                    read_buffers[r]->data(),
+                                    read_buffers[r]->size(),
+                                    cudaMemcpyDefault,
+                                    stream));
     }
   }
+
   auto sync_fn = [](decltype(read_tasks) read_tasks) {
     for (auto& task : read_tasks) {
       task.wait();
@@ -742,6 +847,9 @@ std::pair<bool, std::vector<std::future<void>>> reader::impl::create_and_read_co
   // Keep track of column chunk file offsets
   std::vector<size_t> column_chunk_offsets(num_chunks);
 
+  // Row groups read as slices of whole pages, with the index of their first chunk
+  std::vector<std::pair<size_t, row_group_info const*>> sliced_row_groups;
+
   // Initialize column chunk information
   size_t total_decompressed_size = 0;
   auto remaining_rows            = num_rows;
@@ -750,7 +858,9 @@ std::pair<bool, std::vector<std::future<void>>> reader::impl::create_and_read_co
     auto const& row_group       = _metadata->get_row_group(rg.index, rg.source_index);
     auto const row_group_start  = rg.start_row;
     auto const row_group_source = rg.source_index;
-    auto const row_group_rows   = std::min<int>(remaining_rows, row_group.num_rows);
+    auto const row_group_rows =
+      std::min<int>(remaining_rows, rg.num_rows.value_or(row_group.num_rows));
+    if (not rg.page_ranges.empty()) { sliced_row_groups.emplace_back(chunks.size(), &rg); }
 
     // generate ColumnChunkDesc objects for everything to be decoded (all input columns)
     for (size_t i = 0; i < num_input_columns; ++i) {
@@ -802,14 +912,29 @@ std::pair<bool, std::vector<std::future<void>>> reader::impl::create_and_read_co
   }
 
   // Read compressed chunk data to device memory
-  read_rowgroup_tasks.push_back(read_column_chunks_async(_sources,
-                                                         raw_page_data,
-                                                         chunks,
-                                                         0,
-                                                         chunks.size(),
-                                                         column_chunk_offsets,
-                                                         chunk_source_map,
-                                                         _stream));
+  size_t next_chunk = 0;
+  auto read_chunks  = [&](size_t end_chunk) {
+    if (next_chunk >= end_chunk) { return; }
+    read_rowgroup_tasks.push_back(read_column_chunks_async(_sources,
+                                                           raw_page_data,
+                                                           chunks,
+                                                           next_chunk,
+                                                           end_chunk,
+                                                           column_chunk_offsets,
+                                                           chunk_source_map,
+                                                           _stream));
+  };
+  for (auto const& [first_chunk, rg] : sliced_row_groups) {
+    read_chunks(first_chunk);
+    read_rowgroup_tasks.push_back(read_column_pages_async(*_sources[rg->source_index],
+                                                          raw_page_data,
+                                                          chunks,
+                                                          first_chunk,
+                                                          rg->page_ranges,
+                                                          _stream));
+    next_chunk = first_chunk + num_input_columns;
+  }
+  read_chunks(chunks.size());
 
   CUDF_EXPECTS(remaining_rows == 0, "All rows data must be read.");
 
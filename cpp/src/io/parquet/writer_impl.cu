@@ -19,6 +19,7 @@
  * @brief cuDF-IO parquet writer class implementation
  */
 
+#include "bloom_filter.hpp"
 #include "compact_protocol_reader.hpp"
 #include "compact_protocol_writer.hpp"
 #include "parquet_common.hpp"
@@ -29,6 +30,7 @@
 #include <io/statistics/column_statistics.cuh>
 #include <io/utilities/column_utils.cuh>
 #include <io/utilities/config_utils.hpp>
+#include <io/utilities/host_write_tasks.hpp>
 
 #include <cudf/column/column_device_view.cuh>
 #include <cudf/detail/get_value.cuh>
@@ -50,7 +52,9 @@
 #include <thrust/for_each.h>
 
 #include <algorithm>
+#include <array>
 #include <cstring>
+#include <future>
 #include <numeric>
 #include <utility>
 
@@ -168,6 +172,8 @@ struct aggregate_writer_metadata {
     std::vector<KeyValue> key_value_metadata;
     std::vector<OffsetIndex> offset_indexes;
     std::vector<std::vector<uint8_t>> column_indexes;
+    // Bloom filter bitsets, one per column chunk in row group order; empty if not written
+    std::vector<std::vector<uint8_t>> bloom_filters;
   };
   std::vector<per_file_metadata> files;
   std::string created_by         = "";
@@ -176,6 +182,10 @@ struct aggregate_writer_metadata {
 
 namespace {
 
+// Number of host buffers that column chunks are copied into; while one buffer is written to the
+// sink, the next chunk is copied to another one
+constexpr int num_bounce_buffers = 3;
+
 /**
  * @brief Function that translates GDF compression to parquet compression.
  *
@@ -247,11 +257,13 @@ bool is_col_fixed_width(column_view const& column)
  * 2. stats_dtype: datatype for statistics calculation required for the data stream of a leaf node.
  * 3. ts_scale: scale to multiply or divide timestamp by in order to convert timestamp to parquet
  *    supported types
+ * 4. bloom_filter: whether Bloom filters are written for the column chunks of a leaf node
  */
 struct schema_tree_node : public SchemaElement {
   cudf::detail::LinkedColPtr leaf_column;
   statistics_dtype stats_dtype;
   int32_t ts_scale;
+  bool bloom_filter;
 
   // TODO(fut): Think about making schema a class that holds a vector of schema_tree_nodes. The
   // function construct_schema_tree could be its constructor. It can have method to get the per
@@ -715,6 +727,19 @@ std::vector<schema_tree_node> construct_schema_tree(
         col_schema.parent_idx  = parent_idx;
         col_schema.leaf_column = col;
         set_field_id(col_schema, col_meta);
+
+        if (col_meta.is_enabled_bloom_filter()) {
+          // Values are hashed as their plain encoding, which must match the column values
+          auto const is_supported_type =
+            col->type().id() == type_id::STRING or
+            (col->type().id() != type_id::BOOL8 and col_schema.ts_scale == 0 and
+             (col_schema.type == Type::INT32 or col_schema.type == Type::INT64 or
+              col_schema.type == Type::FLOAT or col_schema.type == Type::DOUBLE));
+          CUDF_EXPECTS(is_supported_type,
+                       "Bloom filters are not supported for the type of column " +
+                         col_meta.get_name());
+          col_schema.bloom_filter = true;
+        }
         schema.push_back(col_schema);
       }
     };
@@ -749,6 +774,7 @@ struct parquet_column_view {
   [[nodiscard]] column_view cudf_column_view() const { return cudf_col; }
   [[nodiscard]] parquet::Type physical_type() const { return schema_node.type; }
   [[nodiscard]] parquet::ConvertedType converted_type() const { return schema_node.converted_type; }
+  [[nodiscard]] bool bloom_filter() const { return schema_node.bloom_filter; }
 
   std::vector<std::string> const& get_path_in_schema() { return path_in_schema; }
 
@@ -1182,6 +1208,56 @@ build_chunk_dictionaries(hostdevice_2dvector<gpu::EncColumnChunk>& chunks,
   return std::pair(std::move(dict_data), std::move(dict_index));
 }
 
+/**
+ * @brief Builds the Bloom filters of the column chunks of columns that request them.
+ *
+ * Filters are sized for the number of distinct values in the chunk, known from the dictionary, or
+ * else for the number of values.
+ *
+ * @param chunks Column chunk array
+ * @param parquet_columns Leaf columns
+ * @param frags Column fragments
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @return Device buffer holding the bitsets of all filters
+ */
+rmm::device_uvector<uint32_t> build_chunk_bloom_filters(
+  hostdevice_2dvector<gpu::EncColumnChunk>& chunks,
+  host_span<parquet_column_view const> parquet_columns,
+  device_2dspan<gpu::PageFragment const> frags,
+  rmm::cuda_stream_view stream)
+{
+  // parquet-mr defaults
+  constexpr double bloom_filter_fpp               = 0.01;
+  constexpr uint32_t chunk_bloom_filter_max_bytes = 1024 * 1024;
+
+  auto h_chunks = chunks.host_view().flat_view();
+
+  size_t total_words = 0;
+  for (auto& chunk : h_chunks) {
+    if (not parquet_columns[chunk.col_desc_id].bloom_filter()) { continue; }
+    auto const num_distinct = chunk.use_dictionary ? chunk.num_dict_entries : chunk.num_values;
+    chunk.bloom_filter_size =
+      bloom_filter_size(num_distinct, bloom_filter_fpp, chunk_bloom_filter_max_bytes);
+    total_words += chunk.bloom_filter_size / sizeof(uint32_t);
+  }
+
+  rmm::device_uvector<uint32_t> bitsets(total_words, stream);
+  if (total_words == 0) { return bitsets; }
+  CUDF_CUDA_TRY(
+    cudaMemsetAsync(bitsets.data(), 0, total_words * sizeof(uint32_t), stream.value()));
+
+  auto bitset = bitsets.data();
+  for (auto& chunk : h_chunks) {
+    if (chunk.bloom_filter_size == 0) { continue; }
+    chunk.bloom_filter_data = bitset;
+    bitset += chunk.bloom_filter_size / sizeof(uint32_t);
+  }
+  chunks.host_to_device_async(stream);
+  gpu::populate_bloom_filters(frags, stream);
+
+  return bitsets;
+}
+
 /**
  * @brief Initialize encoder pages.
  *
@@ -1704,6 +1780,27 @@ auto convert_table_to_parquet_data(table_input_metadata& table_meta,
     }
   }
 
+  // Build Bloom filters and move them to the file metadata, to be written on close
+  auto const bloom_filters =
+    build_chunk_bloom_filters(chunks, parquet_columns, row_group_fragments, stream);
+  auto const h_bloom_filters = bloom_filters.is_empty()
+                                 ? std::vector<uint32_t>{}
+                                 : cudf::detail::make_std_vector_sync(bloom_filters, stream);
+  for (size_t p = 0; p < partitions.size(); p++) {
+    auto& file_bloom_filters = agg_meta->file(p).bloom_filters;
+    file_bloom_filters.resize(global_rowgroup_base[p] * num_columns);
+    for (int rg = 0; rg < num_rg_in_part[p]; rg++) {
+      for (int col = 0; col < num_columns; col++) {
+        auto const& ck     = chunks.host_view()[first_rg_in_part[p] + rg][col];
+        auto& bloom_filter = file_bloom_filters.emplace_back();
+        if (ck.bloom_filter_size == 0) { continue; }
+        auto const first = reinterpret_cast<uint8_t const*>(h_bloom_filters.data()) +
+                           (ck.bloom_filter_data - bloom_filters.data()) * sizeof(uint32_t);
+        bloom_filter.assign(first, first + ck.bloom_filter_size);
+      }
+    }
+  }
+
   // The code preceding this used a uniform fragment size for all columns. Now recompute
   // fragments with a (potentially) varying number of fragments per column.
 
@@ -1948,8 +2045,8 @@ auto convert_table_to_parquet_data(table_input_metadata& table_meta,
     if (need_sync) { stream.synchronize(); }
   }
 
-  auto bounce_buffer =
-    cudf::detail::pinned_host_vector<uint8_t>(all_device_write ? 0 : max_write_size);
+  auto bounce_buffer = cudf::detail::pinned_host_vector<uint8_t>(
+    all_device_write ? 0 : num_bounce_buffers * static_cast<size_t>(max_write_size));
 
   return std::tuple{std::move(agg_meta),
                     std::move(pages),
@@ -2123,6 +2220,12 @@ void writer::impl::write_parquet_data_to_sink(
   _agg_meta              = std::move(updated_agg_meta);
   auto const num_columns = chunks.size().second;
 
+  // Host writes cycle through the bounce buffers, so that copying a chunk to the host overlaps
+  // with writing the previous chunks to the sink; pending writes are waited for on every exit path
+  auto const bounce_buffer_size = bounce_buffer.size() / num_bounce_buffers;
+  host_write_tasks<num_bounce_buffers> bounce_buffer_writes;
+  int next_bounce_buffer = 0;
+
   for (auto b = 0, r = 0; b < static_cast<size_type>(batch_list.size()); b++) {
     auto const rnext = r + batch_list[b];
     std::vector<std::future<void>> write_tasks;
@@ -2142,15 +2245,20 @@ void writer::impl::write_parquet_data_to_sink(
           write_tasks.push_back(_out_sink[p]->device_write_async(
             dev_bfr + ck.ck_stat_size, ck.compressed_size, _stream));
         } else {
-          CUDF_EXPECTS(bounce_buffer.size() >= ck.compressed_size,
+          CUDF_EXPECTS(bounce_buffer_size >= ck.compressed_size,
                        "Bounce buffer was not properly initialized.");
-          CUDF_CUDA_TRY(cudaMemcpyAsync(bounce_buffer.data(),
+          // Wait for the previous write from this buffer before reusing it
+          auto& write_task = bounce_buffer_writes[next_bounce_buffer];
+          if (write_task.valid()) { write_task.get(); }
+          auto const host_bfr = bounce_buffer.data() + next_bounce_buffer * bounce_buffer_size;
+          CUDF_CUDA_TRY(cudaMemcpyAsync(host_bfr,
                                         dev_bfr + ck.ck_stat_size,
                                         ck.compressed_size,
                                         cudaMemcpyDefault,
                                         _stream.value()));
           _stream.synchronize();
-          _out_sink[p]->host_write(bounce_buffer.data(), ck.compressed_size);
+          write_task         = _out_sink[p]->host_write_async(host_bfr, ck.compressed_size);
+          next_bounce_buffer = (next_bounce_buffer + 1) % num_bounce_buffers;
         }
 
         auto& column_chunk_meta = row_group.columns[i].meta_data;
@@ -2165,6 +2273,7 @@ void writer::impl::write_parquet_data_to_sink(
       task.wait();
     }
   }
+  bounce_buffer_writes.get();
 
   if (_stats_granularity == statistics_freq::STATISTICS_COLUMN) {
     // need pages on host to create offset_indexes
@@ -2228,6 +2337,29 @@ std::unique_ptr<std::vector<uint8_t>> writer::impl::close(
     CompactProtocolWriter cpw(&buffer);
     file_ender_s fendr;
 
+    // write Bloom filters, updating column metadata along the way
+    {
+      auto& fmd    = _agg_meta->file(p);
+      int chunkidx = 0;
+      for (auto& r : fmd.row_groups) {
+        for (auto& c : r.columns) {
+          auto const& bitset = fmd.bloom_filters[chunkidx++];
+          if (bitset.empty()) { continue; }
+          BloomFilterHeader header;
+          header.num_bytes                      = bitset.size();
+          header.algorithm.isset.BLOCK          = true;
+          header.hash.isset.XXHASH              = true;
+          header.compression.isset.UNCOMPRESSED = true;
+          buffer.resize(0);
+          cpw.write(header);
+          buffer.insert(buffer.end(), bitset.begin(), bitset.end());
+          c.meta_data.bloom_filter_offset = _out_sink[p]->bytes_written();
+          c.meta_data.bloom_filter_length = buffer.size();
+          _out_sink[p]->host_write(buffer.data(), buffer.size());
+        }
+      }
+    }
+
     if (_stats_granularity == statistics_freq::STATISTICS_COLUMN) {
       auto& fmd = _agg_meta->file(p);
 
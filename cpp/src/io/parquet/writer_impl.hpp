@@ -136,7 +136,7 @@ class writer::impl {
    * @param first_rg_in_part The first rowgroup in each partition
    * @param batch_list The batches of rowgroups to encode
    * @param rg_to_part A map from rowgroup to partition
-   * @param[out] bounce_buffer Temporary host output buffer
+   * @param[out] bounce_buffer Temporary host output buffers, `num_bounce_buffers` of equal size
    */
   void write_parquet_data_to_sink(std::unique_ptr<aggregate_writer_metadata>& updated_agg_meta,
                                   device_span<gpu::EncPage const> pages,
@@ -80,4 +80,76 @@ bool is_stable_enabled() { return is_all_enabled() or get_env_policy() == usage_
 
 }  // namespace nvcomp_integration
 
+namespace host_decompression_integration {
+
+namespace {
+/**
+ * @brief Defines whether block-compressed data is decompressed on the host.
+ */
+enum class usage_policy : uint8_t { OFF, ON };
+
+/**
+ * @brief Get the current usage policy.
+ */
+usage_policy get_env_policy()
+{
+  static auto const env_val = getenv_or<std::string>("LIBCUDF_HOST_DECOMPRESSION_POLICY", "OFF");
+  if (env_val == "OFF") return usage_policy::OFF;
+  if (env_val == "ON") return usage_policy::ON;
+  CUDF_FAIL("Invalid LIBCUDF_HOST_DECOMPRESSION_POLICY value: " + env_val);
+}
+}  // namespace
+
+bool is_enabled() { return get_env_policy() == usage_policy::ON; }
+
+}  // namespace host_decompression_integration
+
+namespace io_uring_integration {
+
+namespace {
+/**
+ * @brief Defines whether io_uring is used for host reads.
+ */
+enum class usage_policy : uint8_t { OFF, ON };
+
+/**
+ * @brief Get the current usage policy.
+ */
+usage_policy get_env_policy()
+{
+  static auto const env_val = getenv_or<std::string>("LIBCUDF_IO_URING_POLICY", "OFF");
+  if (env_val == "OFF") return usage_policy::OFF;
+  if (env_val == "ON") return usage_policy::ON;
+  CUDF_FAIL("Invalid LIBCUDF_IO_URING_POLICY value: " + env_val);
+}
+}  // namespace
+
+bool is_enabled() { return get_env_policy() == usage_policy::ON; }
+
+}  // namespace io_uring_integration
+
+namespace direct_io_integration {
+
+namespace {
+/**
+ * @brief Defines whether host file writes use direct I/O.
+ */
+enum class usage_policy : uint8_t { OFF, ON };
+
+/**
+ * @brief Get the current usage policy.
+ */
+usage_policy get_env_policy()
+{
+  static auto const env_val = getenv_or<std::string>("LIBCUDF_DIRECT_IO_POLICY", "OFF");
+  if (env_val == "OFF") return usage_policy::OFF;
+  if (env_val == "ON") return usage_policy::ON;
+  CUDF_FAIL("Invalid LIBCUDF_DIRECT_IO_POLICY value: " + env_val);
+}
+}  // namespace
+
+bool is_enabled() { return get_env_policy() == usage_policy::ON; }
+
+}  // namespace direct_io_integration
+
 }  // namespace cudf::io::detail
@@ -78,4 +78,32 @@ bool is_stable_enabled();
 
 }  // namespace nvcomp_integration
 
+namespace host_decompression_integration {
+
+/**
+ * @brief Returns true if data that can be decompressed on either the device or the host is
+ * decompressed on the host.
+ */
+bool is_enabled();
+
+}  // namespace host_decompression_integration
+
+namespace io_uring_integration {
+
+/**
+ * @brief Returns true if host file reads through io_uring are enabled.
+ */
+bool is_enabled();
+
+}  // namespace io_uring_integration
+
+namespace direct_io_integration {
+
+/**
+ * @brief Returns true if host file writes bypass the page cache (`O_DIRECT`).
+ */
+bool is_enabled();
+
+}  // namespace direct_io_integration
+
 }  // namespace cudf::io::detail
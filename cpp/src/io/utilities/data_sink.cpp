@@ -14,8 +14,6 @@
  * limitations under the License.
  */
 
-#include <fstream>
-
 #include "file_io_utilities.hpp"
 #include <cudf/io/data_sink.hpp>
 #include <cudf/utilities/error.hpp>
@@ -32,9 +30,10 @@ namespace io {
 class file_sink : public data_sink {
  public:
   explicit file_sink(std::string const& filepath)
+    : _host_out{filepath, detail::direct_io_integration::is_enabled()}
   {
-    _output_stream.open(filepath, std::ios::out | std::ios::binary | std::ios::trunc);
-    CUDF_EXPECTS(_output_stream.is_open(), "Cannot open output file");
+    // Device writes would bypass the staging of direct host writes
+    if (_host_out.is_direct()) { return; }
 
     if (detail::cufile_integration::is_kvikio_enabled()) {
       _kvikio_file = kvikio::FileHandle(filepath, "w");
@@ -47,14 +46,16 @@ class file_sink : public data_sink {
 
   virtual ~file_sink() { flush(); }
 
-  void host_write(void const* data, size_t size) override
+  void host_write(void const* data, size_t size) override { host_write_async(data, size).get(); }
+
+  std::future<void> host_write_async(void const* data, size_t size) override
   {
-    _output_stream.seekp(_bytes_written);
-    _output_stream.write(static_cast<char const*>(data), size);
+    auto const offset = _bytes_written;
     _bytes_written += size;
+    return _host_out.write_async(data, offset, size);
   }
 
-  void flush() override { _output_stream.flush(); }
+  void flush() override { _host_out.flush(); }
 
   size_t bytes_written() override { return _bytes_written; }
 
@@ -94,7 +95,7 @@ class file_sink : public data_sink {
   }
 
  private:
-  std::ofstream _output_stream;
+  detail::host_file_output _host_out;
   size_t _bytes_written = 0;
   std::unique_ptr<detail::cufile_output_impl> _cufile_out;
   kvikio::FileHandle _kvikio_file;
@@ -167,6 +168,11 @@ class user_sink_wrapper : public data_sink {
 
   void host_write(void const* data, size_t size) override { user_sink->host_write(data, size); }
 
+  std::future<void> host_write_async(void const* data, size_t size) override
+  {
+    return user_sink->host_write_async(data, size);
+  }
+
   [[nodiscard]] bool supports_device_write() const override
   {
     return user_sink->supports_device_write();
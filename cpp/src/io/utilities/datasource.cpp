@@ -27,12 +27,36 @@
 
 #include <fcntl.h>
 #include <sys/mman.h>
+#include <sys/stat.h>
 #include <unistd.h>
 
+#include <cstring>
+#include <numeric>
+
 namespace cudf {
 namespace io {
 namespace {
 
+/**
+ * @brief Buffer that exposes a part of a read shared by multiple ranges.
+ */
+class shared_subrange_buffer : public datasource::buffer {
+ public:
+  shared_subrange_buffer(std::shared_ptr<std::vector<uint8_t>> data, size_t offset, size_t size)
+    : _data{std::move(data)}, _offset{offset}, _size{size}
+  {
+  }
+
+  [[nodiscard]] size_t size() const override { return _size; }
+
+  [[nodiscard]] uint8_t const* data() const override { return _data->data() + _offset; }
+
+ private:
+  std::shared_ptr<std::vector<uint8_t>> _data;
+  size_t _offset;
+  size_t _size;
+};
+
 /**
  * @brief Base class for file input. Only implements direct device reads.
  */
@@ -40,6 +64,13 @@ class file_source : public datasource {
  public:
   explicit file_source(char const* filepath) : _file(filepath, O_RDONLY)
   {
+    struct stat st;
+    CUDF_EXPECTS(fstat(_file.desc(), &st) != -1, "Cannot query file status");
+    _identity = source_identity{
+      filepath,
+      _file.size(),
+      static_cast<int64_t>(st.st_mtim.tv_sec) * 1'000'000'000 + st.st_mtim.tv_nsec};
+
     if (detail::cufile_integration::is_kvikio_enabled()) {
       _kvikio_file = kvikio::FileHandle(filepath);
       CUDF_LOG_INFO("Reading a file using kvikIO, with compatibility mode {}.",
@@ -94,10 +125,13 @@ class file_source : public datasource {
 
   [[nodiscard]] size_t size() const override { return _file.size(); }
 
+  [[nodiscard]] std::optional<source_identity> identity() const override { return _identity; }
+
  protected:
   detail::file_wrapper _file;
 
  private:
+  source_identity _identity;
   std::unique_ptr<detail::cufile_input_impl> _cufile_in;
   kvikio::FileHandle _kvikio_file;
   // The read size above which GDS is faster then posix-read + h2d-copy
@@ -146,6 +180,18 @@ class memory_mapped_source : public file_source {
     return read_size;
   }
 
+  std::vector<std::unique_ptr<buffer>> host_read_ranges(
+    cudf::host_span<range const> ranges) override
+  {
+    // Mapped reads are zero-copy, so there is nothing to gain from merging the ranges
+    std::vector<std::unique_ptr<buffer>> buffers;
+    buffers.reserve(ranges.size());
+    for (auto const& range : ranges) {
+      buffers.emplace_back(host_read(range.offset, range.size));
+    }
+    return buffers;
+  }
+
  private:
   void map(int fd, size_t offset, size_t size)
   {
@@ -171,38 +217,91 @@ class memory_mapped_source : public file_source {
 };
 
 /**
- * @brief Implementation class for reading from a file using `read` calls
+ * @brief Implementation class for reading from a file using `pread` calls
  *
  * Potentially faster than `memory_mapped_source` when only a small portion of the file is read
- * through the host.
+ * through the host. Reads do not modify the file offset, so a source can be shared between
+ * threads. Large reads are split into slices that are read in parallel on a shared thread pool.
  */
 class direct_read_source : public file_source {
  public:
-  explicit direct_read_source(char const* filepath) : file_source(filepath) {}
+  explicit direct_read_source(char const* filepath)
+    : file_source(filepath), _pread_in{_file.desc()}
+  {
+  }
 
   std::unique_ptr<buffer> host_read(size_t offset, size_t size) override
   {
-    lseek(_file.desc(), offset, SEEK_SET);
-
     // Clamp length to available data
-    ssize_t const read_size = std::min(size, _file.size() - offset);
+    auto const read_size = std::min(size, _file.size() - offset);
 
     std::vector<uint8_t> v(read_size);
-    CUDF_EXPECTS(read(_file.desc(), v.data(), read_size) == read_size, "read failed");
+    CUDF_EXPECTS(host_read(offset, read_size, v.data()) == read_size, "read failed");
     return buffer::create(std::move(v));
   }
 
   size_t host_read(size_t offset, size_t size, uint8_t* dst) override
   {
-    lseek(_file.desc(), offset, SEEK_SET);
+    // Clamp length to available data
+    auto const read_size = std::min(size, _file.size() - offset);
+    return _pread_in.read(offset, read_size, dst);
+  }
 
+  [[nodiscard]] bool supports_host_read_async() const override { return true; }
+
+  std::future<size_t> host_read_async(size_t offset, size_t size, uint8_t* dst) override
+  {
     // Clamp length to available data
     auto const read_size = std::min(size, _file.size() - offset);
+    return _pread_in.read_async(offset, read_size, dst);
+  }
 
-    CUDF_EXPECTS(read(_file.desc(), dst, read_size) == static_cast<ssize_t>(read_size),
-                 "read failed");
-    return read_size;
+ private:
+  detail::pread_input_impl _pread_in;
+};
+
+/**
+ * @brief Implementation class for reading from a file using io_uring
+ *
+ * Host reads are submitted to the kernel without blocking, so readers can have many range reads in
+ * flight at once. Falls back to `read` calls if io_uring cannot be set up.
+ */
+class io_uring_source : public direct_read_source {
+ public:
+  explicit io_uring_source(char const* filepath)
+    : direct_read_source(filepath), _io_uring_in{detail::make_io_uring_input(_file.desc())}
+  {
+  }
+
+  std::unique_ptr<buffer> host_read(size_t offset, size_t size) override
+  {
+    if (_io_uring_in == nullptr) { return direct_read_source::host_read(offset, size); }
+
+    // Clamp length to available data
+    auto const read_size = std::min(size, _file.size() - offset);
+
+    std::vector<uint8_t> v(read_size);
+    CUDF_EXPECTS(host_read_async(offset, read_size, v.data()).get() == read_size, "read failed");
+    return buffer::create(std::move(v));
+  }
+
+  size_t host_read(size_t offset, size_t size, uint8_t* dst) override
+  {
+    if (_io_uring_in == nullptr) { return direct_read_source::host_read(offset, size, dst); }
+    return host_read_async(offset, size, dst).get();
+  }
+
+  std::future<size_t> host_read_async(size_t offset, size_t size, uint8_t* dst) override
+  {
+    if (_io_uring_in == nullptr) { return direct_read_source::host_read_async(offset, size, dst); }
+
+    // Clamp length to available data
+    auto const read_size = std::min(size, _file.size() - offset);
+    return _io_uring_in->read_async(offset, read_size, dst);
   }
+
+ private:
+  std::unique_ptr<detail::io_uring_input_impl> _io_uring_in;
 };
 
 /**
@@ -290,6 +389,22 @@ class user_datasource_wrapper : public datasource {
     return source->host_read(offset, size);
   }
 
+  std::vector<std::unique_ptr<buffer>> host_read_ranges(
+    cudf::host_span<range const> ranges) override
+  {
+    return source->host_read_ranges(ranges);
+  }
+
+  [[nodiscard]] bool supports_host_read_async() const override
+  {
+    return source->supports_host_read_async();
+  }
+
+  std::future<size_t> host_read_async(size_t offset, size_t size, uint8_t* dst) override
+  {
+    return source->host_read_async(offset, size, dst);
+  }
+
   [[nodiscard]] bool supports_device_read() const override
   {
     return source->supports_device_read();
@@ -312,12 +427,56 @@ class user_datasource_wrapper : public datasource {
 
   [[nodiscard]] size_t size() const override { return source->size(); }
 
+  [[nodiscard]] std::optional<source_identity> identity() const override
+  {
+    return source->identity();
+  }
+
  private:
   datasource* const source;  ///< A non-owning pointer to the user-implemented datasource
 };
 
 }  // namespace
 
+std::vector<std::unique_ptr<datasource::buffer>> datasource::host_read_ranges(
+  cudf::host_span<range const> ranges)
+{
+  static auto const max_gap = detail::getenv_or<size_t>("LIBCUDF_HOST_READ_MAX_GAP", 64 * 1024);
+
+  auto const reads = detail::coalesce_read_ranges(ranges, max_gap);
+
+  // Issue all reads before waiting on any of them
+  std::vector<std::shared_ptr<std::vector<uint8_t>>> read_data;
+  std::vector<std::vector<std::future<size_t>>> read_tasks;
+  read_data.reserve(reads.size());
+  read_tasks.reserve(reads.size());
+  for (auto const& read : reads) {
+    read_data.emplace_back(std::make_shared<std::vector<uint8_t>>(read.slice.size));
+    auto& slice_tasks = read_tasks.emplace_back();
+    auto const slices =
+      detail::make_file_io_slices(read.slice.size, detail::host_read_slice_size());
+    for (auto const& slice : slices) {
+      slice_tasks.emplace_back(host_read_async(
+        read.slice.offset + slice.offset, slice.size, read_data.back()->data() + slice.offset));
+    }
+  }
+
+  std::vector<std::unique_ptr<buffer>> buffers(ranges.size());
+  for (size_t r = 0; r < reads.size(); ++r) {
+    // Reads can only be short at the end of the source, so the valid bytes form a prefix
+    auto const bytes_read =
+      std::accumulate(read_tasks[r].begin(), read_tasks[r].end(), 0ul, [](auto sum, auto& task) {
+        return sum + task.get();
+      });
+    for (auto const idx : reads[r].range_indices) {
+      auto const offset = ranges[idx].offset - reads[r].slice.offset;
+      auto const size   = std::min(ranges[idx].size, bytes_read - std::min(bytes_read, offset));
+      buffers[idx]      = std::make_unique<shared_subrange_buffer>(read_data[r], offset, size);
+    }
+  }
+  return buffers;
+}
+
 std::unique_ptr<datasource> datasource::create(std::string const& filepath,
                                                size_t offset,
                                                size_t size)
@@ -328,6 +487,10 @@ std::unique_ptr<datasource> datasource::create(std::string const& filepath,
     return std::make_unique<direct_read_source>(filepath.c_str());
   }
 #endif
+  if (detail::io_uring_integration::is_enabled()) {
+    // avoid mmap so that host reads are submitted asynchronously through io_uring
+    return std::make_unique<io_uring_source>(filepath.c_str());
+  }
   // Use our own memory mapping implementation for direct file reads
   return std::make_unique<memory_mapped_source>(filepath.c_str(), offset, size);
 }
@@ -20,8 +20,17 @@
 #include <rmm/device_buffer.hpp>
 
 #include <dlfcn.h>
-
+#include <fcntl.h>
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
 #include <fstream>
+#include <limits>
 #include <numeric>
 
 namespace cudf {
@@ -328,6 +337,486 @@ std::unique_ptr<cufile_output_impl> make_cufile_output(std::string const& filepa
   return {};
 }
 
+namespace {
+
+int sys_io_uring_setup(unsigned entries, io_uring_params* params)
+{
+  return static_cast<int>(syscall(__NR_io_uring_setup, entries, params));
+}
+
+int sys_io_uring_enter(int ring_fd, unsigned to_submit, unsigned min_complete, unsigned flags)
+{
+  return static_cast<int>(
+    syscall(__NR_io_uring_enter, ring_fd, to_submit, min_complete, flags, nullptr, 0));
+}
+
+}  // namespace
+
+/**
+ * @brief Submission and completion rings shared with the kernel.
+ */
+struct io_uring_input_impl::ring {
+  explicit ring(unsigned entries)
+  {
+    io_uring_params params{};
+    fd = sys_io_uring_setup(entries, &params);
+    CUDF_EXPECTS(fd >= 0, "Failed to set up io_uring: " + std::string(std::strerror(errno)));
+
+    sq_size = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+    cq_size = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+    // Both rings can be mapped with a single call on kernels 5.4+
+    bool const single_mmap = (params.features & IORING_FEAT_SINGLE_MMAP) != 0;
+    if (single_mmap) { sq_size = cq_size = std::max(sq_size, cq_size); }
+
+    auto map_ring = [fd = fd](size_t size, off_t offset) {
+      return mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, offset);
+    };
+    sq_ptr              = map_ring(sq_size, IORING_OFF_SQ_RING);
+    cq_ptr              = single_mmap ? sq_ptr : map_ring(cq_size, IORING_OFF_CQ_RING);
+    sqes_size           = params.sq_entries * sizeof(io_uring_sqe);
+    auto const sqes_ptr = map_ring(sqes_size, IORING_OFF_SQES);
+    if (sq_ptr == MAP_FAILED or cq_ptr == MAP_FAILED or sqes_ptr == MAP_FAILED) {
+      release();
+      CUDF_FAIL("Cannot map io_uring rings");
+    }
+
+    auto const sq_base = static_cast<uint8_t*>(sq_ptr);
+    sq_tail            = reinterpret_cast<unsigned*>(sq_base + params.sq_off.tail);
+    sq_mask            = *reinterpret_cast<unsigned*>(sq_base + params.sq_off.ring_mask);
+    sq_array           = reinterpret_cast<unsigned*>(sq_base + params.sq_off.array);
+    sqes               = static_cast<io_uring_sqe*>(sqes_ptr);
+
+    auto const cq_base = static_cast<uint8_t*>(cq_ptr);
+    cq_head            = reinterpret_cast<unsigned*>(cq_base + params.cq_off.head);
+    cq_tail            = reinterpret_cast<unsigned*>(cq_base + params.cq_off.tail);
+    cq_mask            = *reinterpret_cast<unsigned*>(cq_base + params.cq_off.ring_mask);
+    cqes               = reinterpret_cast<io_uring_cqe*>(cq_base + params.cq_off.cqes);
+
+    sq_entries = params.sq_entries;
+    cq_entries = params.cq_entries;
+  }
+
+  ~ring() { release(); }
+
+  void release()
+  {
+    if (sqes != nullptr) { munmap(sqes, sqes_size); }
+    if (cq_ptr != nullptr and cq_ptr != MAP_FAILED and cq_ptr != sq_ptr) {
+      munmap(cq_ptr, cq_size);
+    }
+    if (sq_ptr != nullptr and sq_ptr != MAP_FAILED) { munmap(sq_ptr, sq_size); }
+    if (fd >= 0) { close(fd); }
+    sqes   = nullptr;
+    cq_ptr = sq_ptr = nullptr;
+    fd              = -1;
+  }
+
+  int fd         = -1;
+  void* sq_ptr   = nullptr;
+  void* cq_ptr   = nullptr;
+  size_t sq_size = 0;
+  size_t cq_size = 0;
+
+  unsigned* sq_tail   = nullptr;
+  unsigned sq_mask    = 0;
+  unsigned* sq_array  = nullptr;
+  io_uring_sqe* sqes  = nullptr;
+  size_t sqes_size    = 0;
+  unsigned sq_entries = 0;
+  unsigned* cq_head   = nullptr;
+  unsigned* cq_tail   = nullptr;
+  unsigned cq_mask    = 0;
+  io_uring_cqe* cqes  = nullptr;
+  unsigned cq_entries = 0;
+};
+
+/**
+ * @brief A single read slice; resubmitted until it is complete or the end of file is reached.
+ */
+struct io_uring_input_impl::read_request {
+  uint8_t* dst;
+  size_t offset;
+  size_t size;
+  size_t bytes_read = 0;
+  std::promise<size_t> promise;
+};
+
+io_uring_input_impl::io_uring_input_impl(int fd)
+  : _fd{fd},
+    // Kernel reads are limited to 32-bit sizes; smaller slices also increase parallelism
+    _max_slice_size{getenv_or<size_t>("LIBCUDF_IO_URING_SLICE_SIZE", 4 * 1024 * 1024)},
+    _ring{std::make_unique<ring>(getenv_or<unsigned>("LIBCUDF_IO_URING_QUEUE_DEPTH", 64))}
+{
+  CUDF_EXPECTS(_max_slice_size <= std::numeric_limits<uint32_t>::max(),
+               "io_uring slice size must fit in 32 bits");
+  _reaper = std::thread(&io_uring_input_impl::reap_completions, this);
+}
+
+io_uring_input_impl::~io_uring_input_impl()
+{
+  {
+    std::lock_guard lock(_mutex);
+    _shutting_down = true;
+  }
+  _cv.notify_all();
+  _reaper.join();
+}
+
+size_t io_uring_input_impl::submit_capacity() const
+{
+  // Assumes `_mutex` is held; the completion queue must have room for every request in flight
+  return std::min<size_t>(_ring->sq_entries, _ring->cq_entries - _in_flight.size());
+}
+
+void io_uring_input_impl::submit(std::vector<std::unique_ptr<read_request>>& requests,
+                                 size_t begin,
+                                 size_t count)
+{
+  // Assumes `_mutex` is held and `count` is at most `submit_capacity()`; each batch is fully
+  // consumed by the kernel before returning, so the submission queue is always empty at this point
+  auto& r   = *_ring;
+  auto tail = *r.sq_tail;
+  for (auto i = begin; i < begin + count; ++i) {
+    auto const request = requests[i].get();
+    auto const index   = tail++ & r.sq_mask;
+    auto& sqe          = r.sqes[index];
+    std::memset(&sqe, 0, sizeof(sqe));
+    sqe.opcode        = IORING_OP_READ;
+    sqe.fd            = _fd;
+    sqe.addr          = reinterpret_cast<uint64_t>(request->dst + request->bytes_read);
+    sqe.len           = static_cast<uint32_t>(request->size - request->bytes_read);
+    sqe.off           = request->offset + request->bytes_read;
+    sqe.user_data     = reinterpret_cast<uint64_t>(request);
+    r.sq_array[index] = index;
+  }
+  __atomic_store_n(r.sq_tail, tail, __ATOMIC_RELEASE);
+  // The kernel owns the requests from here on; they are tracked until their completions are reaped,
+  // or until `fail` is called if the submission below fails
+  for (auto i = begin; i < begin + count; ++i) {
+    _in_flight.insert(requests[i].release());
+  }
+
+  auto to_submit = static_cast<unsigned>(count);
+  while (to_submit > 0) {
+    auto const submitted = sys_io_uring_enter(r.fd, to_submit, 0, 0);
+    if (submitted < 0) {
+      CUDF_EXPECTS(errno == EINTR or errno == EAGAIN,
+                   "io_uring submission failed: " + std::string(std::strerror(errno)));
+      continue;
+    }
+    to_submit -= submitted;
+  }
+}
+
+bool io_uring_input_impl::complete(read_request* request, int result)
+{
+  if (result == -EINTR or result == -EAGAIN) { return false; }
+  if (result < 0) {
+    request->promise.set_exception(std::make_exception_ptr(
+      cudf::logic_error("io_uring read failed: " + std::string(std::strerror(-result)))));
+    return true;
+  }
+  request->bytes_read += result;
+  // A zero-sized result means that the end of file was reached
+  if (result == 0 or request->bytes_read == request->size) {
+    request->promise.set_value(request->bytes_read);
+    return true;
+  }
+  // Short read, submit the remainder of the slice
+  return false;
+}
+
+void io_uring_input_impl::fail(std::exception_ptr error)
+{
+  // Assumes `_mutex` is held; the reaper stops without reading any more completions, so the
+  // requests can be freed here
+  _error = error;
+  for (auto request : _in_flight) {
+    std::unique_ptr<read_request>(request)->promise.set_exception(error);
+  }
+  _in_flight.clear();
+}
+
+void io_uring_input_impl::reap_completions()
+{
+  auto& r = *_ring;
+  std::vector<std::unique_ptr<read_request>> resubmit;
+  while (true) {
+    {
+      std::unique_lock lock(_mutex);
+      _cv.wait(lock, [this] { return not _in_flight.empty() or _shutting_down or _error; });
+      if (_error) { break; }
+      if (_in_flight.empty()) { return; }
+    }
+
+    if (sys_io_uring_enter(r.fd, 0, 1, IORING_ENTER_GETEVENTS) < 0 and errno != EINTR) {
+      auto const error = std::make_exception_ptr(
+        cudf::logic_error("io_uring wait failed: " + std::string(std::strerror(errno))));
+      std::lock_guard lock(_mutex);
+      if (not _error) { fail(error); }
+      break;
+    }
+
+    {
+      std::lock_guard lock(_mutex);
+      if (_error) { break; }
+      auto head       = *r.cq_head;
+      auto const tail = __atomic_load_n(r.cq_tail, __ATOMIC_ACQUIRE);
+      for (; head != tail; ++head) {
+        auto const& cqe = r.cqes[head & r.cq_mask];
+        auto request =
+          std::unique_ptr<read_request>(reinterpret_cast<read_request*>(cqe.user_data));
+        _in_flight.erase(request.get());
+        if (not complete(request.get(), cqe.res)) { resubmit.push_back(std::move(request)); }
+      }
+      __atomic_store_n(r.cq_head, head, __ATOMIC_RELEASE);
+
+      // Resubmitted requests were all reaped above, so the completion queue has room for them
+      try {
+        for (size_t begin = 0; begin < resubmit.size();) {
+          auto const count = std::min(resubmit.size() - begin, submit_capacity());
+          submit(resubmit, begin, count);
+          begin += count;
+        }
+      } catch (cudf::logic_error const&) {
+        fail(std::current_exception());
+        // Requests after the failed batch were never handed to the kernel
+        for (auto& request : resubmit) {
+          if (request) { request->promise.set_exception(_error); }
+        }
+      }
+      resubmit.clear();
+    }
+    _cv.notify_all();
+  }
+
+  // Release the ring on failure; this cancels the reads that are still in progress in the kernel
+  {
+    std::lock_guard lock(_mutex);
+    r.release();
+  }
+  _cv.notify_all();
+}
+
+std::future<size_t> io_uring_input_impl::read_async(size_t offset, size_t size, uint8_t* dst)
+{
+  auto const slices = make_file_io_slices(size, _max_slice_size);
+  std::vector<std::unique_ptr<read_request>> requests;
+  std::vector<std::future<size_t>> slice_tasks;
+  requests.reserve(slices.size());
+  slice_tasks.reserve(slices.size());
+  for (auto const& slice : slices) {
+    requests.push_back(std::make_unique<read_request>(
+      read_request{dst + slice.offset, offset + slice.offset, slice.size}));
+    slice_tasks.emplace_back(requests.back()->promise.get_future());
+  }
+
+  {
+    std::unique_lock lock(_mutex);
+    // Submit all slices in as few system calls as the ring capacity allows
+    for (size_t begin = 0; begin < requests.size();) {
+      _cv.wait(lock, [this] { return _in_flight.size() < _ring->cq_entries or _error; });
+      if (_error) {
+        for (auto i = begin; i < requests.size(); ++i) {
+          requests[i]->promise.set_exception(_error);
+        }
+        break;
+      }
+      auto const count = std::min(requests.size() - begin, submit_capacity());
+      try {
+        submit(requests, begin, count);
+      } catch (cudf::logic_error const&) {
+        // The failed batch is in flight, so `fail` delivers the error to it
+        fail(std::current_exception());
+      }
+      begin += count;
+    }
+  }
+  _cv.notify_all();
+
+  auto waiter = [](auto slice_tasks) -> size_t {
+    return std::accumulate(slice_tasks.begin(), slice_tasks.end(), 0ul, [](auto sum, auto& task) {
+      return sum + task.get();
+    });
+  };
+  // Deferred to avoid creating a thread per call; the reads are already in flight
+  return std::async(std::launch::deferred, waiter, std::move(slice_tasks));
+}
+
+std::unique_ptr<io_uring_input_impl> make_io_uring_input(int fd)
+{
+  if (io_uring_integration::is_enabled()) {
+    try {
+      auto io_uring_in = std::make_unique<io_uring_input_impl>(fd);
+      CUDF_LOG_INFO("File successfully opened for reading with io_uring.");
+      return io_uring_in;
+    } catch (...) {
+      CUDF_LOG_INFO(
+        "Failed to set up io_uring for reading. Data will be read from the file using blocking "
+        "reads (possible performance impact).");
+    }
+  }
+  return {};
+}
+
+size_t host_read_slice_size()
+{
+  static auto const max_slice_size =
+    getenv_or<size_t>("LIBCUDF_HOST_READ_SLICE_SIZE", 4 * 1024 * 1024);
+  return max_slice_size;
+}
+
+namespace {
+
+/**
+ * @brief Returns the thread pool shared by all files for parallel host reads.
+ */
+cudf::detail::thread_pool& host_read_pool()
+{
+  static cudf::detail::thread_pool pool(getenv_or("LIBCUDF_HOST_READ_THREAD_COUNT", 8));
+  return pool;
+}
+
+/**
+ * @brief Reads a range of a file with `pread` calls, retrying on short reads.
+ *
+ * @return The number of bytes read; smaller than `size` only if the end of file is reached
+ */
+size_t pread_all(int fd, size_t offset, size_t size, uint8_t* dst)
+{
+  size_t bytes_read = 0;
+  while (bytes_read < size) {
+    auto const result = pread(fd, dst + bytes_read, size - bytes_read, offset + bytes_read);
+    if (result == 0) { break; }
+    if (result < 0) {
+      CUDF_EXPECTS(errno == EINTR, "read failed: " + std::string(std::strerror(errno)));
+      continue;
+    }
+    bytes_read += result;
+  }
+  return bytes_read;
+}
+
+}  // namespace
+
+size_t pread_input_impl::read(size_t offset, size_t size, uint8_t* dst)
+{
+  // Avoid the thread pool overhead for reads that fit in a single slice
+  if (size <= host_read_slice_size()) { return pread_all(_fd, offset, size, dst); }
+  return read_async(offset, size, dst).get();
+}
+
+std::future<size_t> pread_input_impl::read_async(size_t offset, size_t size, uint8_t* dst)
+{
+  auto const slices = make_file_io_slices(size, host_read_slice_size());
+  std::vector<std::future<size_t>> slice_tasks;
+  slice_tasks.reserve(slices.size());
+  for (auto const& slice : slices) {
+    slice_tasks.emplace_back(host_read_pool().submit(
+      pread_all, _fd, offset + slice.offset, slice.size, dst + slice.offset));
+  }
+
+  auto waiter = [](auto slice_tasks) -> size_t {
+    return std::accumulate(slice_tasks.begin(), slice_tasks.end(), 0ul, [](auto sum, auto& task) {
+      return sum + task.get();
+    });
+  };
+  // Deferred to avoid creating a thread per call; the slices are already being read
+  return std::async(std::launch::deferred, waiter, std::move(slice_tasks));
+}
+
+namespace {
+
+// Direct I/O requires the buffer address, file offset and size of writes to be aligned
+constexpr size_t direct_io_alignment    = 4096;
+constexpr size_t direct_io_staging_size = 4 << 20;  // 4MB
+
+void pwrite_all(int fd, void const* data, size_t offset, size_t size)
+{
+  auto src = static_cast<uint8_t const*>(data);
+  while (size > 0) {
+    auto const written = pwrite(fd, src, size, offset);
+    if (written == -1 and errno == EINTR) { continue; }
+    CUDF_EXPECTS(written > 0, "Failed to write to file: " + std::string(std::strerror(errno)));
+    src += written;
+    offset += written;
+    size -= written;
+  }
+}
+
+}  // namespace
+
+host_file_output::host_file_output(std::string const& filepath, bool direct_io)
+{
+  auto const flags = O_WRONLY | O_CREAT | O_TRUNC;
+  if (direct_io) {
+    _fd = open(filepath.c_str(), flags | O_DIRECT, 0644);
+    if (_fd != -1) {
+      _staging.reset(
+        static_cast<uint8_t*>(std::aligned_alloc(direct_io_alignment, direct_io_staging_size)));
+      CUDF_EXPECTS(_staging != nullptr, "Cannot allocate the direct I/O staging buffer");
+      CUDF_LOG_INFO("File successfully opened for writing with direct I/O.");
+    } else {
+      CUDF_LOG_INFO(
+        "Failed to open the file for direct I/O. Data will be written through the page cache.");
+    }
+  }
+  if (_fd == -1) { _fd = open(filepath.c_str(), flags, 0644); }
+  CUDF_EXPECTS(_fd != -1, "Cannot open output file " + filepath);
+}
+
+host_file_output::~host_file_output()
+{
+  _writer.wait_for_tasks();
+  close(_fd);
+}
+
+std::future<void> host_file_output::write_async(void const* data, size_t offset, size_t size)
+{
+  if (not is_direct()) {
+    return _writer.submit([this, data, offset, size] { pwrite_all(_fd, data, offset, size); });
+  }
+
+  return _writer.submit([this, data, offset, size] {
+    CUDF_EXPECTS(offset == _staging_offset + _staged_size, "Direct I/O writes must be sequential");
+    auto src       = static_cast<uint8_t const*>(data);
+    auto remaining = size;
+    while (remaining > 0) {
+      auto const to_copy = std::min(remaining, direct_io_staging_size - _staged_size);
+      std::memcpy(_staging.get() + _staged_size, src, to_copy);
+      _staged_size += to_copy;
+      src += to_copy;
+      remaining -= to_copy;
+      if (_staged_size == direct_io_staging_size) {
+        write_staged(direct_io_staging_size);
+        _staging_offset += direct_io_staging_size;
+        _staged_size = 0;
+      }
+    }
+  });
+}
+
+void host_file_output::write_staged(size_t size)
+{
+  pwrite_all(_fd, _staging.get(), _staging_offset, size);
+}
+
+void host_file_output::flush()
+{
+  _writer
+    .submit([this] {
+      if (not is_direct() or _staged_size == 0) { return; }
+      // Write the partial block padded to the alignment, then trim the padding from the file. The
+      // staged data is kept, so that the next writes complete the block and rewrite it.
+      auto const padded_size = util::round_up_unsafe(_staged_size, direct_io_alignment);
+      std::memset(_staging.get() + _staged_size, 0, padded_size - _staged_size);
+      write_staged(padded_size);
+      CUDF_EXPECTS(ftruncate(_fd, _staging_offset + _staged_size) == 0,
+                   "Failed to truncate file: " + std::string(std::strerror(errno)));
+    })
+    .get();
+}
+
 std::vector<file_io_slice> make_file_io_slices(size_t size, size_t max_slice_size)
 {
   max_slice_size      = std::max(1024ul, max_slice_size);
@@ -343,6 +832,32 @@ std::vector<file_io_slice> make_file_io_slices(size_t size, size_t max_slice_siz
   return slices;
 }
 
+std::vector<coalesced_read> coalesce_read_ranges(host_span<datasource::range const> ranges,
+                                                 size_t max_gap)
+{
+  std::vector<size_t> order(ranges.size());
+  std::iota(order.begin(), order.end(), 0);
+  std::stable_sort(order.begin(), order.end(), [&](auto lhs, auto rhs) {
+    return ranges[lhs].offset < ranges[rhs].offset;
+  });
+
+  std::vector<coalesced_read> reads;
+  for (auto const idx : order) {
+    auto const& range = ranges[idx];
+    if (not reads.empty()) {
+      auto& read          = reads.back();
+      auto const read_end = read.slice.offset + read.slice.size;
+      if (range.offset <= read_end + max_gap) {
+        read.slice.size = std::max(read_end, range.offset + range.size) - read.slice.offset;
+        read.range_indices.push_back(idx);
+        continue;
+      }
+    }
+    reads.push_back({file_io_slice{range.offset, range.size}, {idx}});
+  }
+  return reads;
+}
+
 }  // namespace detail
 }  // namespace io
 }  // namespace cudf
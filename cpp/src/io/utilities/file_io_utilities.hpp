@@ -16,9 +16,9 @@
 
 #pragma once
 
-#ifdef CUFILE_FOUND
 #include "thread_pool.hpp"
 
+#ifdef CUFILE_FOUND
 #include <cudf_test/file_utilities.hpp>
 #include <cufile.h>
 #endif
@@ -28,7 +28,16 @@
 #include <cudf/io/datasource.hpp>
 #include <cudf/utilities/error.hpp>
 
+#include <condition_variable>
+#include <cstdlib>
+#include <exception>
+#include <future>
+#include <memory>
+#include <mutex>
 #include <string>
+#include <thread>
+#include <unordered_set>
+#include <vector>
 
 namespace cudf {
 namespace io {
@@ -204,6 +213,193 @@ std::unique_ptr<cufile_input_impl> make_cufile_input(std::string const& filepath
  */
 std::unique_ptr<cufile_output_impl> make_cufile_output(std::string const& filepath);
 
+/**
+ * @brief Returns the maximum size of a single host read request, in bytes.
+ */
+size_t host_read_slice_size();
+
+/**
+ * @brief Reads from a file into host memory with `pread` calls.
+ *
+ * Reads do not modify the file offset, so an object can be shared between threads. Large reads are
+ * split into slices that are read in parallel on a thread pool shared by all files.
+ */
+class pread_input_impl {
+ public:
+  /**
+   * @param fd File descriptor to read from; must remain open for the lifetime of this object
+   */
+  explicit pread_input_impl(int fd) : _fd{fd} {}
+
+  /**
+   * @brief Reads into existing host memory.
+   *
+   * @param offset Number of bytes from the start
+   * @param size Number of bytes to read
+   * @param dst Address of the existing host memory
+   *
+   * @return The number of bytes read; smaller than `size` only if the end of file is reached
+   */
+  size_t read(size_t offset, size_t size, uint8_t* dst);
+
+  /**
+   * @brief Asynchronously reads into existing host memory.
+   *
+   * It is the caller's responsibility to not invalidate `dst` until the result from this function
+   * is synchronized.
+   *
+   * @param offset Number of bytes from the start
+   * @param size Number of bytes to read
+   * @param dst Address of the existing host memory
+   *
+   * @return The number of bytes read as an std::future
+   */
+  std::future<size_t> read_async(size_t offset, size_t size, uint8_t* dst);
+
+ private:
+  int const _fd;
+};
+
+/**
+ * @brief Adapter for the Linux io_uring interface.
+ *
+ * Exposes an API to asynchronously read from a file into host memory. Each call is split into
+ * slices that are all submitted to the kernel at once, so that many reads can be in flight
+ * concurrently. A background thread reaps the completions and fulfills the returned futures. If a
+ * submission or a wait for completions fails, the ring is released and the reads in flight, as well
+ * as any later reads, fail with that error.
+ *
+ * The rings are set up with raw system calls, so no additional library is required.
+ */
+class io_uring_input_impl {
+ public:
+  /**
+   * @brief Sets up an io_uring instance for reading from the given file.
+   *
+   * @throws cudf::logic_error if the kernel does not support io_uring
+   *
+   * @param fd File descriptor to read from; must remain open for the lifetime of this object
+   */
+  explicit io_uring_input_impl(int fd);
+
+  /**
+   * @brief Waits for all in-flight reads to complete, then releases the rings.
+   */
+  ~io_uring_input_impl();
+
+  io_uring_input_impl(io_uring_input_impl const&)            = delete;
+  io_uring_input_impl& operator=(io_uring_input_impl const&) = delete;
+
+  /**
+   * @brief Asynchronously reads into existing host memory.
+   *
+   * It is the caller's responsibility to not invalidate `dst` until the result from this function
+   * is synchronized.
+   *
+   * @param offset Number of bytes from the start
+   * @param size Number of bytes to read
+   * @param dst Address of the existing host memory
+   *
+   * @return The number of bytes read as an std::future
+   */
+  std::future<size_t> read_async(size_t offset, size_t size, uint8_t* dst);
+
+ private:
+  struct ring;
+  struct read_request;
+
+  [[nodiscard]] size_t submit_capacity() const;
+  void submit(std::vector<std::unique_ptr<read_request>>& requests, size_t begin, size_t count);
+  bool complete(read_request* request, int result);
+  void fail(std::exception_ptr error);
+  void reap_completions();
+
+  int const _fd;
+  size_t const _max_slice_size;
+  std::unique_ptr<ring> _ring;
+  std::mutex _mutex;
+  std::condition_variable _cv;
+  std::unordered_set<read_request*> _in_flight;
+  std::exception_ptr _error;
+  bool _shutting_down = false;
+  std::thread _reaper;
+};
+
+/**
+ * @brief Creates an `io_uring_input_impl` object
+ *
+ * Returns a null pointer if io_uring use is disabled, or if an exception occurs in the
+ * `io_uring_input_impl` constructor (e.g. the kernel does not support io_uring).
+ */
+std::unique_ptr<io_uring_input_impl> make_io_uring_input(int fd);
+
+/**
+ * @brief Writes host data to a file with `pwrite`, in a background thread.
+ *
+ * Each write targets a range of the file given by the caller, so no user-space buffering or
+ * seeking is involved, and the caller can prepare the next buffer while the previous one is being
+ * written. Each output file gets its own writer thread, so that multiple files (e.g. partitions)
+ * are written concurrently.
+ *
+ * With direct I/O, the file is opened with `O_DIRECT` to bypass the page cache. The written data is
+ * then staged in an aligned buffer and written in aligned blocks, so writes must be sequential.
+ * Falls back to buffered writes if the file system does not support direct I/O.
+ */
+class host_file_output {
+ public:
+  /**
+   * @brief Creates (or truncates) the output file.
+   *
+   * @param filepath Path of the output file
+   * @param direct_io Whether to bypass the page cache
+   */
+  host_file_output(std::string const& filepath, bool direct_io);
+
+  /**
+   * @brief Waits for the pending writes and closes the file.
+   */
+  ~host_file_output();
+
+  host_file_output(host_file_output const&)            = delete;
+  host_file_output& operator=(host_file_output const&) = delete;
+
+  /**
+   * @brief Asynchronously writes host data to the file.
+   *
+   * It is the caller's responsibility to not invalidate `data` until the result from this
+   * function is synchronized.
+   *
+   * @param data Address of the data to write
+   * @param offset Number of bytes from the start of the file; with direct I/O, must be the end of
+   * the previous write
+   * @param size Number of bytes to write
+   *
+   * @return A future that can be used to synchronize the write
+   */
+  std::future<void> write_async(void const* data, size_t offset, size_t size);
+
+  /**
+   * @brief Waits for the pending writes; with direct I/O, also writes the staged data.
+   */
+  void flush();
+
+  /**
+   * @brief Returns whether the file was opened for direct I/O.
+   */
+  [[nodiscard]] bool is_direct() const { return _staging != nullptr; }
+
+ private:
+  void write_staged(size_t size);
+
+  int _fd = -1;
+  // Aligned staging buffer of direct writes and the file offset of its start
+  std::unique_ptr<uint8_t, decltype(&std::free)> _staging{nullptr, &std::free};
+  size_t _staging_offset = 0;
+  size_t _staged_size    = 0;
+  // Declared last so that pending writes are complete before the other members are destroyed
+  cudf::detail::thread_pool _writer{1};
+};
+
 /**
  * @brief Byte range to be read/written in a single operation.
  */
@@ -219,6 +415,23 @@ struct file_io_slice {
  */
 std::vector<file_io_slice> make_file_io_slices(size_t size, size_t max_slice_size);
 
+/**
+ * @brief Single read that covers one or more of the requested byte ranges.
+ */
+struct coalesced_read {
+  file_io_slice slice;                ///< Byte range to read
+  std::vector<size_t> range_indices;  ///< Indices of the requested ranges covered by this read
+};
+
+/**
+ * @brief Merge byte ranges into fewer reads.
+ *
+ * Ranges are merged when the gap between them is not larger than `max_gap`. Overlapping ranges are
+ * always merged. The output is sorted by offset.
+ */
+std::vector<coalesced_read> coalesce_read_ranges(host_span<datasource::range const> ranges,
+                                                 size_t max_gap);
+
 }  // namespace detail
 }  // namespace io
 }  // namespace cudf
@@ -0,0 +1,66 @@
+/*
+ * Copyright (c) 2023, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <future>
+
+namespace cudf::io::detail {
+
+/**
+ * @brief Asynchronous host writes from a fixed set of host buffers, one task per buffer.
+ *
+ * The destructor waits for the pending writes, so that a writer that exits with an exception does
+ * not free the buffers, or the sink, while they are still being written.
+ *
+ * @tparam N Number of host buffers
+ */
+template <std::size_t N>
+class host_write_tasks {
+ public:
+  host_write_tasks() = default;
+
+  host_write_tasks(host_write_tasks const&)            = delete;
+  host_write_tasks& operator=(host_write_tasks const&) = delete;
+
+  ~host_write_tasks()
+  {
+    for (auto& task : _tasks) {
+      if (task.valid()) { task.wait(); }
+    }
+  }
+
+  /**
+   * @brief Returns the write task of the given host buffer.
+   */
+  std::future<void>& operator[](std::size_t buffer_idx) { return _tasks[buffer_idx]; }
+
+  /**
+   * @brief Waits for all pending writes, rethrowing the first error.
+   */
+  void get()
+  {
+    for (auto& task : _tasks) {
+      if (task.valid()) { task.get(); }
+    }
+  }
+
+ private:
+  std::array<std::future<void>, N> _tasks;
+};
+
+}  // namespace cudf::io::detail
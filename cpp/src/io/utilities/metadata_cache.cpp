@@ -0,0 +1,154 @@
+/*
+ * Copyright (c) 2023, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "metadata_cache.hpp"
+
+#include <cudf/io/metadata_cache.hpp>
+#include <io/utilities/config_utils.hpp>
+
+#include <filesystem>
+
+namespace cudf::io {
+namespace detail {
+
+namespace {
+
+/**
+ * @brief Builds the lookup key of an entry.
+ *
+ * The path is normalized so that different spellings of the same path share cache entries.
+ */
+std::string make_index_key(metadata_cache::file_format format, std::string const& path)
+{
+  return std::to_string(static_cast<int>(format)) + ':' +
+         std::filesystem::absolute(path).lexically_normal().string();
+}
+
+}  // namespace
+
+metadata_cache::metadata_cache()
+  : _size_limit{getenv_or<size_t>("LIBCUDF_METADATA_CACHE_SIZE", 0)}
+{
+}
+
+metadata_cache& metadata_cache::instance()
+{
+  static metadata_cache _instance;
+  return _instance;
+}
+
+bool metadata_cache::is_enabled() const { return size_limit() != 0; }
+
+std::shared_ptr<void const> metadata_cache::find(file_format format,
+                                                 datasource::source_identity const& identity)
+{
+  std::lock_guard lock(_mutex);
+  auto const it = _index.find(make_index_key(format, identity.path));
+  if (it == _index.end()) { return nullptr; }
+
+  auto const entry_it = it->second;
+  if (entry_it->identity.size != identity.size or
+      entry_it->identity.modification_time != identity.modification_time) {
+    // The file has been modified since the entry was inserted
+    erase(entry_it);
+    return nullptr;
+  }
+  _entries.splice(_entries.begin(), _entries, entry_it);
+  return entry_it->value;
+}
+
+void metadata_cache::insert(file_format format,
+                            datasource::source_identity const& identity,
+                            std::shared_ptr<void const> value,
+                            size_t size)
+{
+  std::lock_guard lock(_mutex);
+  if (size > _size_limit) { return; }
+
+  auto const key = make_index_key(format, identity.path);
+  if (auto const it = _index.find(key); it != _index.end()) { erase(it->second); }
+
+  _entries.push_front(entry{format, identity, size, std::move(value)});
+  _index.emplace(key, _entries.begin());
+  _size += size;
+  evict();
+}
+
+void metadata_cache::invalidate(std::string const& path)
+{
+  std::lock_guard lock(_mutex);
+  for (auto const format : {file_format::PARQUET, file_format::ORC}) {
+    if (auto const it = _index.find(make_index_key(format, path)); it != _index.end()) {
+      erase(it->second);
+    }
+  }
+}
+
+void metadata_cache::clear()
+{
+  std::lock_guard lock(_mutex);
+  _index.clear();
+  _entries.clear();
+  _size = 0;
+}
+
+void metadata_cache::set_size_limit(size_t size_limit)
+{
+  std::lock_guard lock(_mutex);
+  _size_limit = size_limit;
+  evict();
+}
+
+size_t metadata_cache::size_limit() const
+{
+  std::lock_guard lock(_mutex);
+  return _size_limit;
+}
+
+void metadata_cache::erase(entry_list::iterator it)
+{
+  _size -= it->size;
+  _index.erase(make_index_key(it->format, it->identity.path));
+  _entries.erase(it);
+}
+
+void metadata_cache::evict()
+{
+  while (_size > _size_limit) {
+    erase(std::prev(_entries.end()));
+  }
+}
+
+}  // namespace detail
+
+void set_metadata_cache_size_limit(std::size_t size_limit)
+{
+  detail::metadata_cache::instance().set_size_limit(size_limit);
+}
+
+std::size_t get_metadata_cache_size_limit()
+{
+  return detail::metadata_cache::instance().size_limit();
+}
+
+void invalidate_cached_metadata(std::string const& filepath)
+{
+  detail::metadata_cache::instance().invalidate(filepath);
+}
+
+void clear_metadata_cache() { detail::metadata_cache::instance().clear(); }
+
+}  // namespace cudf::io
@@ -0,0 +1,107 @@
+/*
+ * Copyright (c) 2023, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/io/datasource.hpp>
+
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+namespace cudf::io::detail {
+
+/**
+ * @brief Process-wide LRU cache of parsed file metadata.
+ *
+ * Entries are looked up by file format and path; an entry is only returned if the size and the
+ * modification time of the file match the ones at the time the entry was inserted.
+ */
+class metadata_cache {
+ public:
+  /**
+   * @brief File formats whose metadata can be cached.
+   */
+  enum class file_format : uint8_t { PARQUET, ORC };
+
+  /**
+   * @brief Returns the process-wide cache instance.
+   */
+  static metadata_cache& instance();
+
+  /**
+   * @brief Returns whether the cache is enabled, i.e. the size limit is not zero.
+   */
+  [[nodiscard]] bool is_enabled() const;
+
+  /**
+   * @brief Returns the cached metadata of the given source, or a null pointer on a cache miss.
+   */
+  template <typename T>
+  [[nodiscard]] std::shared_ptr<T const> get(file_format format,
+                                             datasource::source_identity const& identity)
+  {
+    return std::static_pointer_cast<T const>(find(format, identity));
+  }
+
+  /**
+   * @brief Inserts the metadata of the given source.
+   *
+   * @param format File format of the source
+   * @param identity Identity of the source
+   * @param value Parsed metadata
+   * @param size Size used to account for the entry, typically the serialized metadata size
+   */
+  void insert(file_format format,
+              datasource::source_identity const& identity,
+              std::shared_ptr<void const> value,
+              size_t size);
+
+  void invalidate(std::string const& path);
+
+  void clear();
+
+  void set_size_limit(size_t size_limit);
+
+  [[nodiscard]] size_t size_limit() const;
+
+ private:
+  metadata_cache();
+
+  std::shared_ptr<void const> find(file_format format, datasource::source_identity const& identity);
+
+  struct entry {
+    file_format format;
+    datasource::source_identity identity;
+    size_t size;
+    std::shared_ptr<void const> value;
+  };
+  using entry_list = std::list<entry>;
+
+  void erase(entry_list::iterator it);
+  void evict();
+
+  mutable std::mutex _mutex;
+  size_t _size_limit;
+  size_t _size = 0;
+  entry_list _entries;  ///< Most recently used entries first
+  std::unordered_map<std::string, entry_list::iterator> _index;
+};
+
+}  // namespace cudf::io::detail
@@ -0,0 +1,260 @@
+/*
+ * Copyright (c) 2023, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cudf/ast/detail/expression_transformer.hpp>
+#include <cudf/ast/detail/operators.hpp>
+#include <cudf/ast/expressions.hpp>
+#include <cudf/types.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <functional>
+#include <list>
+#include <optional>
+#include <set>
+#include <utility>
+#include <vector>
+
+namespace cudf::io::detail {
+
+/**
+ * @brief Converts AST expression to StatsAST for comparing with column statistics
+ * This is used in row group and stripe filtering based on predicate.
+ * statistics min value of a column is referenced by column_index*2
+ * statistics max value of a column is referenced by column_index*2+1
+ *
+ */
+class stats_expression_converter : public ast::detail::expression_transformer {
+ public:
+  stats_expression_converter(ast::expression const& expr, size_type const& num_columns)
+    : _num_columns{num_columns}
+  {
+    expr.accept(*this);
+  }
+
+  /**
+   * @copydoc ast::detail::expression_transformer::visit(ast::literal const& )
+   */
+  std::reference_wrapper<ast::expression const> visit(ast::literal const& expr) override
+  {
+    _stats_expr = std::reference_wrapper<ast::expression const>(expr);
+    return expr;
+  }
+
+  /**
+   * @copydoc ast::detail::expression_transformer::visit(ast::column_reference const& )
+   */
+  std::reference_wrapper<ast::expression const> visit(ast::column_reference const& expr) override
+  {
+    CUDF_EXPECTS(expr.get_table_source() == ast::table_reference::LEFT,
+                 "Statistics AST supports only left table");
+    CUDF_EXPECTS(expr.get_column_index() < _num_columns,
+                 "Column index cannot be more than number of columns in the table");
+    _stats_expr = std::reference_wrapper<ast::expression const>(expr);
+    return expr;
+  }
+
+  /**
+   * @copydoc ast::detail::expression_transformer::visit(ast::column_name_reference const& )
+   */
+  std::reference_wrapper<ast::expression const> visit(
+    ast::column_name_reference const& expr) override
+  {
+    CUDF_FAIL("Column name reference is not supported in statistics AST");
+  }
+
+  /**
+   * @copydoc ast::detail::expression_transformer::visit(ast::operation const& )
+   */
+  std::reference_wrapper<ast::expression const> visit(ast::operation const& expr) override
+  {
+    using cudf::ast::ast_operator;
+    auto const operands = expr.get_operands();
+    auto const op       = expr.get_operator();
+
+    if (auto* v = dynamic_cast<ast::column_reference const*>(&operands[0].get())) {
+      // First operand should be column reference, second should be literal.
+      CUDF_EXPECTS(cudf::ast::detail::ast_operator_arity(op) == 2,
+                   "Only binary operations are supported on column reference");
+      CUDF_EXPECTS(dynamic_cast<ast::literal const*>(&operands[1].get()) != nullptr,
+                   "Second operand of binary operation with column reference must be a literal");
+      v->accept(*this);
+      auto const col_index = v->get_column_index();
+      switch (op) {
+        /* transform to stats conditions. op(col, literal)
+        col1 == val --> vmin <= val && vmax >= val
+        col1 != val --> !(vmin == val && vmax == val)
+        col1 >  val --> vmax > val
+        col1 <  val --> vmin < val
+        col1 >= val --> vmax >= val
+        col1 <= val --> vmin <= val
+        */
+        case ast_operator::EQUAL: {
+          auto const& vmin = _col_ref.emplace_back(col_index * 2);
+          auto const& vmax = _col_ref.emplace_back(col_index * 2 + 1);
+          auto const& op1 =
+            _operators.emplace_back(ast_operator::LESS_EQUAL, vmin, operands[1].get());
+          auto const& op2 =
+            _operators.emplace_back(ast_operator::GREATER_EQUAL, vmax, operands[1].get());
+          _operators.emplace_back(ast::ast_operator::LOGICAL_AND, op1, op2);
+          break;
+        }
+        case ast_operator::NOT_EQUAL: {
+          auto const& vmin = _col_ref.emplace_back(col_index * 2);
+          auto const& vmax = _col_ref.emplace_back(col_index * 2 + 1);
+          auto const& op1  = _operators.emplace_back(ast_operator::NOT_EQUAL, vmin, vmax);
+          auto const& op2 =
+            _operators.emplace_back(ast_operator::NOT_EQUAL, vmax, operands[1].get());
+          _operators.emplace_back(ast_operator::LOGICAL_OR, op1, op2);
+          break;
+        }
+        case ast_operator::LESS: [[fallthrough]];
+        case ast_operator::LESS_EQUAL: {
+          auto const& vmin = _col_ref.emplace_back(col_index * 2);
+          _operators.emplace_back(op, vmin, operands[1].get());
+          break;
+        }
+        case ast_operator::GREATER: [[fallthrough]];
+        case ast_operator::GREATER_EQUAL: {
+          auto const& vmax = _col_ref.emplace_back(col_index * 2 + 1);
+          _operators.emplace_back(op, vmax, operands[1].get());
+          break;
+        }
+        default: CUDF_FAIL("Unsupported operation in Statistics AST");
+      };
+    } else {
+      auto new_operands = visit_operands(operands);
+      if (cudf::ast::detail::ast_operator_arity(op) == 2) {
+        _operators.emplace_back(op, new_operands.front(), new_operands.back());
+      } else if (cudf::ast::detail::ast_operator_arity(op) == 1) {
+        _operators.emplace_back(op, new_operands.front());
+      }
+    }
+    _stats_expr = std::reference_wrapper<ast::expression const>(_operators.back());
+    return std::reference_wrapper<ast::expression const>(_operators.back());
+  }
+
+  /**
+   * @brief Returns the AST to apply on Column chunk statistics.
+   *
+   * @return AST operation expression
+   */
+  [[nodiscard]] std::reference_wrapper<ast::expression const> get_stats_expr() const
+  {
+    return _stats_expr.value().get();
+  }
+
+ private:
+  std::vector<std::reference_wrapper<ast::expression const>> visit_operands(
+    std::vector<std::reference_wrapper<ast::expression const>> operands)
+  {
+    std::vector<std::reference_wrapper<ast::expression const>> transformed_operands;
+    for (auto const& operand : operands) {
+      auto const new_operand = operand.get().accept(*this);
+      transformed_operands.push_back(new_operand);
+    }
+    return transformed_operands;
+  }
+  std::optional<std::reference_wrapper<ast::expression const>> _stats_expr;
+  size_type _num_columns;
+  std::list<ast::column_reference> _col_ref;
+  std::list<ast::operation> _operators;
+};
+
+/**
+ * @brief Collects the indices of the columns referenced in an expression
+ */
+inline void collect_column_references(ast::expression const& expr, std::set<size_type>& columns)
+{
+  if (auto const* col = dynamic_cast<ast::column_reference const*>(&expr)) {
+    columns.insert(col->get_column_index());
+  } else if (auto const* op = dynamic_cast<ast::operation const*>(&expr)) {
+    for (auto const& operand : op->get_operands()) {
+      collect_column_references(operand.get(), columns);
+    }
+  }
+}
+
+/**
+ * @brief Returns the column index and literal of an equality comparison of a column with a literal
+ */
+inline std::optional<std::pair<size_type, ast::literal const*>> column_literal_equality(
+  ast::expression const& expr)
+{
+  auto const* op = dynamic_cast<ast::operation const*>(&expr);
+  if (op == nullptr || op->get_operator() != ast::ast_operator::EQUAL) { return std::nullopt; }
+  auto const operands = op->get_operands();
+  auto const* col     = dynamic_cast<ast::column_reference const*>(&operands[0].get());
+  auto const* lit     = dynamic_cast<ast::literal const*>(&operands[1].get());
+  if (col == nullptr || lit == nullptr || col->get_table_source() != ast::table_reference::LEFT) {
+    return std::nullopt;
+  }
+  return std::pair{col->get_column_index(), lit};
+}
+
+/**
+ * @brief Calls `fn` on each equality comparison of a column with a literal that is combined with
+ * the others by logical AND and OR operations only
+ */
+template <typename Fn>
+void for_each_column_literal_equality(ast::expression const& expr, Fn&& fn)
+{
+  using cudf::ast::ast_operator;
+  if (auto const equality = column_literal_equality(expr)) {
+    fn(equality->first, *equality->second);
+    return;
+  }
+  auto const* op = dynamic_cast<ast::operation const*>(&expr);
+  if (op == nullptr) { return; }
+  switch (op->get_operator()) {
+    case ast_operator::LOGICAL_AND:
+    case ast_operator::NULL_LOGICAL_AND:
+    case ast_operator::LOGICAL_OR:
+    case ast_operator::NULL_LOGICAL_OR:
+      for (auto const& operand : op->get_operands()) {
+        for_each_column_literal_equality(operand.get(), fn);
+      }
+      break;
+    default: break;
+  }
+}
+
+/**
+ * @brief Returns whether any row may satisfy an expression, given a predicate that returns false
+ * if a column definitely never equals a literal
+ */
+template <typename MayEqual>
+bool may_satisfy(ast::expression const& expr, MayEqual const& may_equal)
+{
+  using cudf::ast::ast_operator;
+  if (auto const equality = column_literal_equality(expr)) {
+    return may_equal(equality->first, *equality->second);
+  }
+  auto const* op = dynamic_cast<ast::operation const*>(&expr);
+  if (op == nullptr) { return true; }
+  auto const operands = op->get_operands();
+  switch (op->get_operator()) {
+    case ast_operator::LOGICAL_AND:
+    case ast_operator::NULL_LOGICAL_AND:
+      return may_satisfy(operands[0].get(), may_equal) && may_satisfy(operands[1].get(), may_equal);
+    case ast_operator::LOGICAL_OR:
+    case ast_operator::NULL_LOGICAL_OR:
+      return may_satisfy(operands[0].get(), may_equal) || may_satisfy(operands[1].get(), may_equal);
+    default: return true;
+  }
+}
+
+}  // namespace cudf::io::detail
@@ -0,0 +1,379 @@
+/*
+ * Copyright (c) 2023, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "stats_filter.hpp"
+
+#include <io/utilities/config_utils.hpp>
+#include <io/utilities/stats_expression_converter.hpp>
+
+#include <cudf/column/column_factories.hpp>
+#include <cudf/detail/transform.hpp>
+#include <cudf/detail/utilities/vector_factories.hpp>
+#include <cudf/null_mask.hpp>
+#include <cudf/scalar/scalar.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/utilities/bit.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
+
+#include <rmm/mr/device/per_device_resource.hpp>
+
+#include <thrust/host_vector.h>
+
+#include <functional>
+
+namespace cudf::io::detail {
+
+namespace {
+
+/**
+ * @brief Converts statistics values to 2 device columns - min, max values; uses storage type as T
+ */
+struct stats_caster {
+  template <typename T>
+  static T from_stats_value(stats_value const& value)
+  {
+    if constexpr (cudf::is_timestamp<T>()) {
+      return T{typename T::duration{std::get<typename T::rep>(value)}};
+    } else if constexpr (cudf::is_duration<T>()) {
+      return T{std::get<typename T::rep>(value)};
+    } else if constexpr (std::is_same_v<T, string_view>) {
+      auto const str = std::get<std::string_view>(value);
+      return string_view(str.data(), str.size());
+    } else {
+      return std::get<T>(value);
+    }
+  }
+
+  template <typename T>
+  std::pair<std::unique_ptr<column>, std::unique_ptr<column>> operator()(
+    host_span<stats_min_max const> stats,
+    data_type dtype,
+    rmm::cuda_stream_view stream,
+    rmm::mr::device_memory_resource* mr) const
+  {
+    // List, Struct, Dictionary types are not supported
+    if constexpr (cudf::is_compound<T>() && !std::is_same_v<T, string_view>) {
+      CUDF_FAIL("Compound types do not have statistics");
+    } else {
+      auto const num_ranges = static_cast<size_type>(stats.size());
+
+      // using thrust::host_vector because std::vector<bool> uses bitmap instead of byte per bool.
+      thrust::host_vector<T> min(num_ranges);
+      thrust::host_vector<T> max(num_ranges);
+      std::vector<bitmask_type> min_null_mask(num_bitmask_words(num_ranges), ~bitmask_type{0});
+      std::vector<bitmask_type> max_null_mask(num_bitmask_words(num_ranges), ~bitmask_type{0});
+      size_type min_null_count = 0;
+      size_type max_null_count = 0;
+
+      auto const set_value = [](auto& values,
+                                auto& null_mask,
+                                auto& null_count,
+                                size_type idx,
+                                std::optional<stats_value> const& value) {
+        if (value.has_value()) {
+          values[idx] = from_stats_value<T>(value.value());
+        } else {
+          clear_bit_unsafe(null_mask.data(), idx);
+          null_count++;
+        }
+      };
+      for (size_type idx = 0; idx < num_ranges; ++idx) {
+        set_value(min, min_null_mask, min_null_count, idx, stats[idx].min);
+        set_value(max, max_null_mask, max_null_count, idx, stats[idx].max);
+      }
+
+      auto const to_device = [&](thrust::host_vector<T> const& values,
+                                 std::vector<bitmask_type> const& null_mask,
+                                 size_type null_count) -> std::unique_ptr<column> {
+        rmm::device_buffer d_null_mask{
+          null_mask.data(), cudf::bitmask_allocation_size_bytes(num_ranges), stream, mr};
+        if constexpr (std::is_same_v<T, string_view>) {
+          std::vector<char> chars;
+          std::vector<size_type> offsets(1, 0);
+          for (auto const& str : values) {
+            chars.insert(chars.end(), str.data(), str.data() + str.size_bytes());
+            offsets.push_back(offsets.back() + str.size_bytes());
+          }
+          auto d_chars   = cudf::detail::make_device_uvector_async(chars, stream, mr);
+          auto d_offsets = cudf::detail::make_device_uvector_sync(offsets, stream, mr);
+          return cudf::make_strings_column(num_ranges,
+                                           std::move(d_offsets),
+                                           std::move(d_chars),
+                                           std::move(d_null_mask),
+                                           null_count);
+        } else {
+          return std::make_unique<column>(
+            dtype,
+            num_ranges,
+            cudf::detail::make_device_uvector_sync(values, stream, mr).release(),
+            std::move(d_null_mask),
+            null_count);
+        }
+      };
+      return {to_device(min, min_null_mask, min_null_count),
+              to_device(max, max_null_mask, max_null_count)};
+    }
+  }
+};
+
+/**
+ * @brief Copies the value of a literal scalar to host
+ */
+struct literal_to_stats_value {
+  template <typename T>
+  stats_value operator()(cudf::scalar const& value,
+                         std::string& string_storage,
+                         rmm::cuda_stream_view stream) const
+  {
+    if constexpr (std::is_same_v<T, string_view>) {
+      string_storage = static_cast<cudf::string_scalar const&>(value).to_string(stream);
+      return std::string_view(string_storage);
+    } else if constexpr (cudf::is_fixed_width<T>()) {
+      return to_stats_value(static_cast<cudf::scalar_type_t<T> const&>(value).value(stream));
+    } else {
+      CUDF_FAIL("Unsupported literal type");
+    }
+  }
+};
+
+/**
+ * @brief Evaluates the filter on the device, on a table of the min/max statistics
+ */
+std::vector<bool> evaluate_stats_filter_on_device(
+  host_span<std::vector<stats_min_max> const> stats,
+  host_span<data_type const> output_dtypes,
+  ast::expression const& stats_expr,
+  size_type num_ranges,
+  rmm::cuda_stream_view stream)
+{
+  auto mr = rmm::mr::get_current_device_resource();
+
+  // Converts statistics to a table
+  // where min(col[i]) = columns[i*2], max(col[i])=columns[i*2+1]
+  // For each column, it contains one row per range of rows.
+  std::vector<std::unique_ptr<column>> columns;
+  for (size_t col_idx = 0; col_idx < output_dtypes.size(); col_idx++) {
+    auto const& dtype = output_dtypes[col_idx];
+    // Only comparable types except fixed point are supported.
+    if ((cudf::is_compound(dtype) && dtype.id() != cudf::type_id::STRING) ||
+        stats[col_idx].empty()) {
+      // placeholder only for unsupported types and unreferenced columns.
+      for (int i = 0; i < 2; ++i) {
+        columns.push_back(cudf::make_numeric_column(
+          data_type{cudf::type_id::BOOL8}, num_ranges, rmm::device_buffer{}, 0, stream, mr));
+      }
+      continue;
+    }
+    CUDF_EXPECTS(stats[col_idx].size() == static_cast<size_t>(num_ranges),
+                 "Statistics are required for each range of rows");
+    auto [min_col, max_col] =
+      cudf::type_dispatcher<dispatch_storage_type>(dtype,
+                                                   stats_caster{},
+                                                   host_span<stats_min_max const>(stats[col_idx]),
+                                                   dtype,
+                                                   stream,
+                                                   mr);
+    columns.push_back(std::move(min_col));
+    columns.push_back(std::move(max_col));
+  }
+  auto stats_table   = cudf::table(std::move(columns));
+  auto predicate_col = cudf::detail::compute_column(stats_table, stats_expr, stream, mr);
+  auto predicate     = predicate_col->view();
+  CUDF_EXPECTS(predicate.type().id() == cudf::type_id::BOOL8,
+               "Filter expression must return a boolean column");
+
+  auto num_bitmasks = num_bitmask_words(predicate.size());
+  std::vector<bitmask_type> host_bitmask(num_bitmasks, ~bitmask_type{0});
+  if (predicate.nullable()) {
+    CUDF_CUDA_TRY(cudaMemcpyAsync(host_bitmask.data(),
+                                  predicate.null_mask(),
+                                  num_bitmasks * sizeof(bitmask_type),
+                                  cudaMemcpyDefault,
+                                  stream.value()));
+  }
+  auto is_range_required = cudf::detail::make_std_vector_sync(
+    device_span<uint8_t const>(predicate.data<uint8_t>(), predicate.size()), stream);
+
+  std::vector<bool> required(num_ranges);
+  for (size_type idx = 0; idx < num_ranges; ++idx) {
+    required[idx] = !bit_is_set(host_bitmask.data(), idx) || is_range_required[idx];
+  }
+  return required;
+}
+
+}  // namespace
+
+size_type host_stats_filter_threshold()
+{
+  static auto const threshold =
+    getenv_or<size_type>("LIBCUDF_HOST_STATS_FILTER_THRESHOLD", 10'000);
+  return threshold;
+}
+
+std::optional<type_id> host_stats_evaluator::prepare(ast::expression const& expr,
+                                                     rmm::cuda_stream_view stream)
+{
+  using cudf::ast::ast_operator;
+  if (auto const* lit = dynamic_cast<ast::literal const*>(&expr)) {
+    auto const& scalar = lit->get_scalar();
+    auto const type    = scalar.type().id();
+    if (cudf::is_nested(scalar.type()) || cudf::is_dictionary(scalar.type())) {
+      return std::nullopt;
+    }
+    _literals[lit] = scalar.is_valid(stream)
+                       ? std::make_optional(cudf::type_dispatcher(scalar.type(),
+                                                                  literal_to_stats_value{},
+                                                                  scalar,
+                                                                  _string_storage.emplace_back(),
+                                                                  stream))
+                       : std::nullopt;
+    return type;
+  }
+  if (auto const* col = dynamic_cast<ast::column_reference const*>(&expr)) {
+    auto const col_idx = static_cast<size_t>(col->get_column_index() / 2);
+    if (col->get_table_source() != ast::table_reference::LEFT ||
+        col_idx >= _output_dtypes.size() || col_idx >= _stats.size()) {
+      return std::nullopt;
+    }
+    auto const& dtype = _output_dtypes[col_idx];
+    if (cudf::is_compound(dtype) && dtype.id() != type_id::STRING) { return std::nullopt; }
+    return dtype.id();
+  }
+  auto const* op = dynamic_cast<ast::operation const*>(&expr);
+  if (op == nullptr) { return std::nullopt; }
+
+  std::vector<std::optional<type_id>> operand_types;
+  for (auto const& operand : op->get_operands()) {
+    auto const type = prepare(operand.get(), stream);
+    if (not type.has_value()) { return std::nullopt; }
+    operand_types.push_back(type);
+  }
+  switch (op->get_operator()) {
+    case ast_operator::EQUAL:
+    case ast_operator::NOT_EQUAL:
+    case ast_operator::LESS:
+    case ast_operator::GREATER:
+    case ast_operator::LESS_EQUAL:
+    case ast_operator::GREATER_EQUAL:
+      if (operand_types[0] != operand_types[1]) { return std::nullopt; }
+      return type_id::BOOL8;
+    case ast_operator::LOGICAL_AND:
+    case ast_operator::LOGICAL_OR:
+    case ast_operator::NULL_LOGICAL_AND:
+    case ast_operator::NULL_LOGICAL_OR:
+      if (operand_types[0] != type_id::BOOL8 || operand_types[1] != type_id::BOOL8) {
+        return std::nullopt;
+      }
+      return type_id::BOOL8;
+    case ast_operator::NOT:
+      if (operand_types[0] != type_id::BOOL8) { return std::nullopt; }
+      return type_id::BOOL8;
+    case ast_operator::IDENTITY: return operand_types[0];
+    default: return std::nullopt;
+  }
+}
+
+std::optional<stats_value> host_stats_evaluator::evaluate(ast::expression const& expr,
+                                                          size_type range) const
+{
+  using cudf::ast::ast_operator;
+  if (auto const* lit = dynamic_cast<ast::literal const*>(&expr)) { return _literals.at(lit); }
+  if (auto const* col = dynamic_cast<ast::column_reference const*>(&expr)) {
+    auto const col_idx = col->get_column_index() / 2;
+    // Columns without statistics have unknown values
+    if (_stats[col_idx].empty()) { return std::nullopt; }
+    auto const& range_stat = _stats[col_idx][range];
+    return col->get_column_index() % 2 == 0 ? range_stat.min : range_stat.max;
+  }
+
+  auto const& op      = dynamic_cast<ast::operation const&>(expr);
+  auto const operands = op.get_operands();
+  auto const lhs      = evaluate(operands[0].get(), range);
+  auto const as_bool  = [](std::optional<stats_value> const& v) { return std::get<bool>(*v); };
+  auto const op_type  = op.get_operator();
+  if (op_type == ast_operator::IDENTITY) { return lhs; }
+  if (op_type == ast_operator::NOT) {
+    return lhs.has_value() ? std::make_optional<stats_value>(!as_bool(lhs)) : std::nullopt;
+  }
+  auto const rhs = evaluate(operands[1].get(), range);
+  switch (op_type) {
+    case ast_operator::NULL_LOGICAL_AND:
+      if ((lhs.has_value() && !as_bool(lhs)) || (rhs.has_value() && !as_bool(rhs))) {
+        return stats_value{false};
+      }
+      break;
+    case ast_operator::NULL_LOGICAL_OR:
+      if ((lhs.has_value() && as_bool(lhs)) || (rhs.has_value() && as_bool(rhs))) {
+        return stats_value{true};
+      }
+      break;
+    default: break;
+  }
+  if (not lhs.has_value() || not rhs.has_value()) { return std::nullopt; }
+
+  auto const compare = [&](auto const& cmp) {
+    return std::visit(
+      [&](auto const& l, auto const& r) -> stats_value {
+        if constexpr (std::is_same_v<std::decay_t<decltype(l)>, std::decay_t<decltype(r)>>) {
+          return cmp(l, r);
+        } else {
+          CUDF_FAIL("Mismatched operand types in statistics AST");
+        }
+      },
+      *lhs,
+      *rhs);
+  };
+  switch (op_type) {
+    case ast_operator::EQUAL: return compare(std::equal_to<>{});
+    case ast_operator::NOT_EQUAL: return compare(std::not_equal_to<>{});
+    case ast_operator::LESS: return compare(std::less<>{});
+    case ast_operator::GREATER: return compare(std::greater<>{});
+    case ast_operator::LESS_EQUAL: return compare(std::less_equal<>{});
+    case ast_operator::GREATER_EQUAL: return compare(std::greater_equal<>{});
+    case ast_operator::LOGICAL_AND:
+    case ast_operator::NULL_LOGICAL_AND: return stats_value{as_bool(lhs) && as_bool(rhs)};
+    case ast_operator::LOGICAL_OR:
+    case ast_operator::NULL_LOGICAL_OR: return stats_value{as_bool(lhs) || as_bool(rhs)};
+    default: CUDF_FAIL("Unsupported operation in host statistics AST");
+  }
+}
+
+std::vector<bool> evaluate_stats_filter(host_span<std::vector<stats_min_max> const> stats,
+                                        host_span<data_type const> output_dtypes,
+                                        ast::expression const& filter,
+                                        size_type num_ranges,
+                                        rmm::cuda_stream_view stream)
+{
+  // Converts AST to StatsAST with reference to min, max columns of the statistics
+  stats_expression_converter stats_expr{filter, static_cast<size_type>(output_dtypes.size())};
+  auto stats_ast = stats_expr.get_stats_expr();
+
+  // Ranges with unknown predicate values are required
+  if (num_ranges <= host_stats_filter_threshold()) {
+    host_stats_evaluator evaluator{stats, output_dtypes};
+    if (evaluator.prepare(stats_ast.get(), stream) == type_id::BOOL8) {
+      std::vector<bool> required(num_ranges);
+      for (size_type idx = 0; idx < num_ranges; ++idx) {
+        auto const value = evaluator.evaluate(stats_ast.get(), idx);
+        required[idx]    = !value.has_value() || std::get<bool>(value.value());
+      }
+      return required;
+    }
+  }
+  return evaluate_stats_filter_on_device(stats, output_dtypes, stats_ast.get(), num_ranges, stream);
+}
+
+}  // namespace cudf::io::detail
@@ -0,0 +1,153 @@
+/*
+ * Copyright (c) 2023, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cudf/ast/expressions.hpp>
+#include <cudf/strings/string_view.hpp>
+#include <cudf/types.hpp>
+#include <cudf/utilities/span.hpp>
+#include <cudf/utilities/traits.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+
+#include <cstdint>
+#include <list>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <variant>
+#include <vector>
+
+namespace cudf::io::detail {
+
+/**
+ * @brief Host value of a statistic or a literal; chrono values are represented by their count
+ * and fixed point values by their representation
+ */
+using stats_value = std::variant<bool,
+                                 int8_t,
+                                 int16_t,
+                                 int32_t,
+                                 int64_t,
+                                 uint8_t,
+                                 uint16_t,
+                                 uint32_t,
+                                 uint64_t,
+                                 float,
+                                 double,
+                                 __int128_t,
+                                 std::string_view>;
+
+/**
+ * @brief Converts a value of a column storage type to a statistics value
+ */
+template <typename T>
+stats_value to_stats_value(T const& value)
+{
+  if constexpr (cudf::is_timestamp<T>()) {
+    return value.time_since_epoch().count();
+  } else if constexpr (cudf::is_duration<T>()) {
+    return value.count();
+  } else if constexpr (std::is_same_v<T, string_view>) {
+    return std::string_view(value.data(), value.size_bytes());
+  } else {
+    return value;
+  }
+}
+
+/**
+ * @brief Minimum and maximum statistics of a column over a range of rows, i.e. a row group, a page
+ * or a stripe; `std::nullopt` denotes a missing statistic.
+ *
+ * Values hold the alternative of `to_stats_value` for the storage type of the column. String
+ * values reference memory owned by the caller.
+ */
+struct stats_min_max {
+  std::optional<stats_value> min;
+  std::optional<stats_value> max;
+};
+
+/**
+ * @brief Returns the maximum number of ranges of rows whose statistics are filtered on host.
+ */
+size_type host_stats_filter_threshold();
+
+/**
+ * @brief Evaluates a statistics AST on host, one range of rows at a time
+ *
+ * The AST references the minimum of column `i` as column `2 * i` and its maximum as column
+ * `2 * i + 1` (see `stats_expression_converter`). Supports comparisons, logical operations and
+ * identity. Follows the null semantics of `cudf::compute_column`: operations on null values are
+ * null, except for the null-aware logical operations.
+ */
+class host_stats_evaluator {
+ public:
+  /**
+   * @param stats Statistics of each range of rows, one list per output column; empty for the
+   * columns that are not referenced by the expression
+   * @param output_dtypes Data types of the output columns
+   */
+  host_stats_evaluator(host_span<std::vector<stats_min_max> const> stats,
+                       host_span<data_type const> output_dtypes)
+    : _stats{stats}, _output_dtypes{output_dtypes}
+  {
+  }
+
+  /**
+   * @brief Validates the expression and copies its literal values to host
+   *
+   * @return Type of the expression result, or `std::nullopt` if it cannot be evaluated on host
+   */
+  std::optional<type_id> prepare(ast::expression const& expr, rmm::cuda_stream_view stream);
+
+  /**
+   * @brief Evaluates a prepared expression on the statistics of a range of rows
+   *
+   * @return Value of the expression, or `std::nullopt` if null
+   */
+  [[nodiscard]] std::optional<stats_value> evaluate(ast::expression const& expr,
+                                                    size_type range) const;
+
+ private:
+  host_span<std::vector<stats_min_max> const> _stats;
+  host_span<data_type const> _output_dtypes;
+  std::unordered_map<ast::literal const*, std::optional<stats_value>> _literals;
+  std::list<std::string> _string_storage;
+};
+
+/**
+ * @brief Evaluates a filter on the min/max statistics of ranges of rows
+ *
+ * Up to `host_stats_filter_threshold()` ranges are evaluated on host with `host_stats_evaluator`;
+ * larger counts, and expressions the host evaluator does not support, are evaluated on the device
+ * with `cudf::compute_column`.
+ *
+ * @param stats Statistics of each range of rows, one list per output column; empty for the columns
+ * that are not referenced by the filter
+ * @param output_dtypes Data types of the output columns
+ * @param filter AST expression referencing the output columns
+ * @param num_ranges Number of ranges of rows
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @return Whether each range of rows may contain rows that satisfy the filter
+ */
+std::vector<bool> evaluate_stats_filter(host_span<std::vector<stats_min_max> const> stats,
+                                        host_span<data_type const> output_dtypes,
+                                        ast::expression const& filter,
+                                        size_type num_ranges,
+                                        rmm::cuda_stream_view stream);
+
+}  // namespace cudf::io::detail
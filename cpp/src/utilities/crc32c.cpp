@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) 2023, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/detail/utilities/crc32c.hpp>
+
+#include <array>
+
+namespace cudf::detail {
+
+namespace {
+
+constexpr uint32_t crc32c_polynomial = 0x82f63b78;  // Reflected Castagnoli polynomial
+
+using crc32c_tables = std::array<std::array<uint32_t, 256>, 8>;
+
+/**
+ * @brief Builds the lookup tables for the slicing-by-8 algorithm.
+ */
+crc32c_tables make_tables()
+{
+  crc32c_tables tables{};
+  for (uint32_t i = 0; i < 256; ++i) {
+    auto crc = i;
+    for (int bit = 0; bit < 8; ++bit) {
+      crc = (crc >> 1) ^ ((crc & 1) ? crc32c_polynomial : 0);
+    }
+    tables[0][i] = crc;
+  }
+  for (uint32_t i = 0; i < 256; ++i) {
+    for (std::size_t t = 1; t < tables.size(); ++t) {
+      tables[t][i] = (tables[t - 1][i] >> 8) ^ tables[0][tables[t - 1][i] & 0xff];
+    }
+  }
+  return tables;
+}
+
+}  // namespace
+
+uint32_t crc32c(host_span<uint8_t const> data, uint32_t crc)
+{
+  static crc32c_tables const tables = make_tables();
+
+  auto ptr       = data.data();
+  auto remaining = data.size();
+  crc            = ~crc;
+  // Process eight bytes at a time; the bytes are consumed in order, so this is byte-order agnostic
+  for (; remaining >= 8; remaining -= 8, ptr += 8) {
+    auto const lo = crc ^ (static_cast<uint32_t>(ptr[0]) | static_cast<uint32_t>(ptr[1]) << 8 |
+                           static_cast<uint32_t>(ptr[2]) << 16 |
+                           static_cast<uint32_t>(ptr[3]) << 24);
+    crc = tables[7][lo & 0xff] ^ tables[6][(lo >> 8) & 0xff] ^ tables[5][(lo >> 16) & 0xff] ^
+          tables[4][lo >> 24] ^ tables[3][ptr[4]] ^ tables[2][ptr[5]] ^ tables[1][ptr[6]] ^
+          tables[0][ptr[7]];
+  }
+  for (; remaining > 0; --remaining, ++ptr) {
+    crc = (crc >> 8) ^ tables[0][(crc ^ *ptr) & 0xff];
+  }
+  return ~crc;
+}
+
+}  // namespace cudf::detail
@@ -19,6 +19,13 @@
 #include <cudf_test/table_utilities.hpp>
 
 #include <cudf/contiguous_split.hpp>
+#include <cudf/detail/utilities/crc32c.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <cuda_runtime.h>
+
+#include <string>
+#include <vector>
 
 struct PackUnpackTest : public cudf::test::BaseFixture {
   void run_test(cudf::table_view const& t)
@@ -27,6 +34,9 @@ struct PackUnpackTest : public cudf::test::BaseFixture {
     auto packed   = cudf::pack(t);
     auto unpacked = cudf::unpack(packed);
     CUDF_TEST_EXPECT_TABLES_EQUAL(t, unpacked);
+    if (not packed.metadata->empty()) {
+      EXPECT_NO_THROW(cudf::validate_packed(*packed.metadata, packed.gpu_data->size()));
+    }
 
     // verify pack_metadata itself works
     auto metadata = cudf::pack_metadata(
@@ -540,3 +550,102 @@ TEST_F(PackUnpackTest, SlicedEmpty)
   auto sliced = cudf::split(t, {0});
   this->run_test(sliced[0]);
 }
+
+namespace {
+
+std::vector<uint8_t> copy_to_host(rmm::device_buffer const& buffer)
+{
+  std::vector<uint8_t> result(buffer.size());
+  CUDF_CUDA_TRY(cudaMemcpyAsync(
+    result.data(), buffer.data(), buffer.size(), cudaMemcpyDefault, buffer.stream().value()));
+  buffer.stream().synchronize();
+  return result;
+}
+
+}  // namespace
+
+TEST_F(PackUnpackTest, ValidateMetadata)
+{
+  cudf::test::fixed_width_column_wrapper<int64_t> a({1, 2, 3, 4, 5, 6, 7}, {1, 1, 1, 0, 1, 0, 1});
+  cudf::test::strings_column_wrapper b{"abc", "def", "ghi", "jkl", "mno", "", "st"};
+  cudf::table_view const t({a, b});
+  auto const packed    = cudf::pack(t);
+  auto const data_size = packed.gpu_data->size();
+  auto const& metadata = *packed.metadata;
+  EXPECT_NO_THROW(cudf::validate_packed(metadata, data_size));
+
+  // Data buffer too small for the column offsets
+  EXPECT_THROW(cudf::validate_packed(metadata, 1), cudf::logic_error);
+
+  // Data buffer large enough for the column offsets, but not for the column buffers; the data and
+  // the null mask of a single column are at offsets 0 and 64
+  auto const packed_a = cudf::pack(cudf::table_view({a}));
+  EXPECT_EQ(packed_a.gpu_data->size(), 128u);
+  EXPECT_NO_THROW(cudf::validate_packed(*packed_a.metadata, 128));
+  EXPECT_THROW(cudf::validate_packed(*packed_a.metadata, 65), cudf::logic_error);
+
+  // Truncated metadata
+  auto const truncated = cudf::host_span<uint8_t const>(metadata.data(), metadata.size() - 1);
+  EXPECT_THROW(cudf::validate_packed(truncated, data_size), cudf::logic_error);
+
+  // Corrupted column description
+  auto corrupted = metadata;
+  corrupted.back() ^= 0x1;
+  EXPECT_THROW(cudf::validate_packed(corrupted, data_size), cudf::logic_error);
+
+  // Corrupted magic number
+  corrupted = metadata;
+  corrupted.front() ^= 0x1;
+  EXPECT_THROW(cudf::validate_packed(corrupted, data_size), cudf::logic_error);
+  EXPECT_THROW(cudf::unpack(corrupted.data(), static_cast<uint8_t const*>(packed.gpu_data->data())),
+               cudf::logic_error);
+}
+
+TEST_F(PackUnpackTest, Crc32c)
+{
+  auto const crc32c = [](std::string const& data, uint32_t crc = 0) {
+    return cudf::detail::crc32c({reinterpret_cast<uint8_t const*>(data.data()), data.size()}, crc);
+  };
+  // Check values of the CRC-32C catalogue and of RFC 3720 (iSCSI)
+  EXPECT_EQ(crc32c(""), 0u);
+  EXPECT_EQ(crc32c("123456789"), 0xE3069283u);
+  EXPECT_EQ(crc32c(std::string(32, '\x00')), 0x8A9136AAu);
+  EXPECT_EQ(crc32c(std::string(32, '\xFF')), 0x62A8AB43u);
+  // Checksum of data split into several buffers
+  EXPECT_EQ(crc32c("56789", crc32c("1234")), 0xE3069283u);
+}
+
+TEST_F(PackUnpackTest, DataChecksum)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> a({1, 2, 3, 4, 5, 6, 7}, {1, 1, 1, 0, 1, 0, 1});
+  cudf::table_view const t({a});
+  auto packed          = cudf::pack(t);
+  auto const host_data = copy_to_host(*packed.gpu_data);
+
+  // No data checksum is stored by default
+  auto corrupted_data = host_data;
+  corrupted_data.front() ^= 0x1;
+  EXPECT_NO_THROW(cudf::validate_packed(*packed.metadata, corrupted_data));
+
+  cudf::set_packed_data_checksum(*packed.metadata, host_data);
+  EXPECT_NO_THROW(cudf::validate_packed(*packed.metadata, host_data));
+  EXPECT_THROW(cudf::validate_packed(*packed.metadata, corrupted_data), cudf::logic_error);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(cudf::unpack(packed), t);
+}
+
+TEST_F(PackUnpackTest, UnalignedMetadata)
+{
+  cudf::test::fixed_width_column_wrapper<int64_t> a({1, 2, 3, 4, 5, 6, 7}, {1, 1, 1, 0, 1, 0, 1});
+  cudf::test::lists_column_wrapper<int> b{{0, 1}, {2}, {3, 4, 5}, {6, 7}, {8, 9}, {10}, {11, 12}};
+  cudf::table_view const t({a, b});
+  auto const packed = cudf::pack(t);
+
+  // Metadata received at an arbitrary offset within a message
+  std::vector<uint8_t> message(packed.metadata->size() + 1);
+  std::copy(packed.metadata->begin(), packed.metadata->end(), message.begin() + 1);
+  auto const metadata = cudf::host_span<uint8_t const>(message.data() + 1, packed.metadata->size());
+  EXPECT_NO_THROW(cudf::validate_packed(metadata, packed.gpu_data->size()));
+  auto const unpacked =
+    cudf::unpack(metadata.data(), static_cast<uint8_t const*>(packed.gpu_data->data()));
+  CUDF_TEST_EXPECT_TABLES_EQUAL(t, unpacked);
+}
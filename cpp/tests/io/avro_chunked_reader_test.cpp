@@ -0,0 +1,306 @@
+/*
+ * Copyright (c) 2023, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_utilities.hpp>
+#include <cudf_test/column_wrapper.hpp>
+#include <cudf_test/cudf_gtest.hpp>
+#include <cudf_test/table_utilities.hpp>
+
+#include <cudf/concatenate.hpp>
+#include <cudf/io/avro.hpp>
+#include <cudf/strings/strings_column_view.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_view.hpp>
+
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <zlib.h>
+
+namespace {
+
+using int64s_col  = cudf::test::fixed_width_column_wrapper<int64_t>;
+using strings_col = cudf::test::strings_column_wrapper;
+
+void append_long(std::string& out, int64_t value)
+{
+  auto zigzag = (static_cast<uint64_t>(value) << 1) ^ static_cast<uint64_t>(value >> 63);
+  while (zigzag >= 0x80) {
+    out.push_back(static_cast<char>((zigzag & 0x7f) | 0x80));
+    zigzag >>= 7;
+  }
+  out.push_back(static_cast<char>(zigzag));
+}
+
+void append_string(std::string& out, std::string const& value)
+{
+  append_long(out, static_cast<int64_t>(value.size()));
+  out += value;
+}
+
+std::string const sync_marker = "0123456789abcdef";
+
+/**
+ * @brief Returns the name of a row; some names contain the sync marker, which must not be mistaken
+ * for the end of a block
+ */
+std::string row_name(int row)
+{
+  return "row_" + std::to_string(row) + (row % 13 == 0 ? sync_marker : "");
+}
+
+/**
+ * @brief Compresses an Avro block with the `deflate` codec, i.e. as raw DEFLATE data
+ */
+std::string deflate_block(std::string const& block)
+{
+  z_stream strm{};
+  EXPECT_EQ(deflateInit2(&strm, Z_DEFAULT_COMPRESSION, Z_DEFLATED, -15, 8, Z_DEFAULT_STRATEGY),
+            Z_OK);
+  std::string compressed(deflateBound(&strm, block.size()), '\0');
+  strm.next_in   = reinterpret_cast<Bytef*>(const_cast<char*>(block.data()));
+  strm.avail_in  = block.size();
+  strm.next_out  = reinterpret_cast<Bytef*>(compressed.data());
+  strm.avail_out = compressed.size();
+  EXPECT_EQ(deflate(&strm, Z_FINISH), Z_STREAM_END);
+  compressed.resize(strm.total_out);
+  deflateEnd(&strm);
+  return compressed;
+}
+
+/**
+ * @brief Encodes an Avro file with `long` and `string` columns
+ *
+ * @param codec "null" for uncompressed blocks, or "deflate"
+ */
+std::string make_avro_file(int num_blocks, int rows_per_block, std::string const& codec = "null")
+{
+  std::string file = "Obj\x01";
+  append_long(file, 2);
+  append_string(file, "avro.schema");
+  append_string(file,
+                R"({"type":"record","name":"test","fields":[)"
+                R"({"name":"id","type":"long"},{"name":"name","type":"string"}]})");
+  append_string(file, "avro.codec");
+  append_string(file, codec);
+  append_long(file, 0);
+  file += sync_marker;
+
+  for (int b = 0; b < num_blocks; ++b) {
+    std::string block;
+    for (int r = b * rows_per_block; r < (b + 1) * rows_per_block; ++r) {
+      append_long(block, r);
+      append_string(block, row_name(r));
+    }
+    if (codec == "deflate") { block = deflate_block(block); }
+    append_long(file, rows_per_block);
+    append_long(file, static_cast<int64_t>(block.size()));
+    file += block;
+    file += sync_marker;
+  }
+  return file;
+}
+
+std::unique_ptr<cudf::table> make_expected_table(int first_row, int num_rows)
+{
+  std::vector<int64_t> ids;
+  std::vector<std::string> names;
+  for (int r = first_row; r < first_row + num_rows; ++r) {
+    ids.push_back(r);
+    names.push_back(row_name(r));
+  }
+  std::vector<std::unique_ptr<cudf::column>> columns;
+  columns.emplace_back(int64s_col(ids.begin(), ids.end()).release());
+  columns.emplace_back(strings_col(names.begin(), names.end()).release());
+  return std::make_unique<cudf::table>(std::move(columns));
+}
+
+auto chunked_read(cudf::io::avro_reader_options const& options, std::size_t chunk_read_limit)
+{
+  auto reader = cudf::io::chunked_avro_reader(chunk_read_limit, options);
+
+  auto num_chunks = 0;
+  auto out_tables = std::vector<std::unique_ptr<cudf::table>>{};
+
+  do {
+    auto chunk = reader.read_chunk();
+    EXPECT_EQ(chunk.metadata.schema_info.size(), 2);
+    out_tables.emplace_back(std::move(chunk.tbl));
+    ++num_chunks;
+  } while (reader.has_next());
+
+  auto out_tviews = std::vector<cudf::table_view>{};
+  for (auto const& tbl : out_tables) {
+    out_tviews.emplace_back(tbl->view());
+  }
+
+  return std::pair(cudf::concatenate(out_tviews), num_chunks);
+}
+
+}  // namespace
+
+struct AvroChunkedReaderTest : public cudf::test::BaseFixture {};
+
+TEST_F(AvroChunkedReaderTest, TestChunkedReadNoData)
+{
+  auto const file = make_avro_file(0, 0);
+  auto const options =
+    cudf::io::avro_reader_options::builder(cudf::io::source_info{file.data(), file.size()})
+      .build();
+
+  auto const [result, num_chunks] = chunked_read(options, 1'000);
+  EXPECT_EQ(num_chunks, 1);
+  EXPECT_EQ(result->num_rows(), 0);
+  EXPECT_EQ(result->num_columns(), 2);
+}
+
+TEST_F(AvroChunkedReaderTest, TestChunkedReadBlocks)
+{
+  auto constexpr num_blocks     = 10;
+  auto constexpr rows_per_block = 100;
+
+  auto const file = make_avro_file(num_blocks, rows_per_block);
+  auto const options =
+    cudf::io::avro_reader_options::builder(cudf::io::source_info{file.data(), file.size()})
+      .build();
+  auto const expected = make_expected_table(0, num_blocks * rows_per_block);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(*expected, cudf::io::read_avro(options).tbl->view());
+
+  // No limit
+  {
+    auto const [result, num_chunks] = chunked_read(options, 0);
+    EXPECT_EQ(num_chunks, 1);
+    CUDF_TEST_EXPECT_TABLES_EQUAL(*expected, *result);
+  }
+
+  // Limit smaller than a block; each chunk holds a single block
+  {
+    auto const [result, num_chunks] = chunked_read(options, 1);
+    EXPECT_EQ(num_chunks, num_blocks);
+    CUDF_TEST_EXPECT_TABLES_EQUAL(*expected, *result);
+  }
+
+  // Limit of a few blocks
+  {
+    auto const [result, num_chunks] = chunked_read(options, 10'000);
+    EXPECT_GT(num_chunks, 1);
+    EXPECT_LT(num_chunks, num_blocks);
+    CUDF_TEST_EXPECT_TABLES_EQUAL(*expected, *result);
+  }
+
+  // Limit larger than the file
+  {
+    auto const [result, num_chunks] = chunked_read(options, 1'000'000);
+    EXPECT_EQ(num_chunks, 1);
+    CUDF_TEST_EXPECT_TABLES_EQUAL(*expected, *result);
+  }
+}
+
+TEST_F(AvroChunkedReaderTest, TestChunkedReadSkipRows)
+{
+  auto constexpr num_blocks     = 10;
+  auto constexpr rows_per_block = 100;
+  auto constexpr skip_rows      = 150;
+  auto constexpr num_rows       = 500;
+
+  auto const file    = make_avro_file(num_blocks, rows_per_block);
+  auto const options = cudf::io::avro_reader_options::builder(
+                         cudf::io::source_info{file.data(), file.size()})
+                         .skip_rows(skip_rows)
+                         .num_rows(num_rows)
+                         .build();
+  auto const expected = make_expected_table(skip_rows, num_rows);
+
+  // Rows 150-649 are in blocks 1-6
+  auto const [result, num_chunks] = chunked_read(options, 1);
+  EXPECT_EQ(num_chunks, 6);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(*expected, *result);
+}
+
+TEST_F(AvroChunkedReaderTest, TestChunkedReadCompressed)
+{
+  auto constexpr num_blocks       = 50;
+  auto constexpr rows_per_block   = 100;
+  auto constexpr chunk_read_limit = std::size_t{20'000};
+
+  auto const file = make_avro_file(num_blocks, rows_per_block, "deflate");
+  auto const options =
+    cudf::io::avro_reader_options::builder(cudf::io::source_info{file.data(), file.size()})
+      .build();
+  auto reader = cudf::io::chunked_avro_reader(chunk_read_limit, options);
+
+  std::vector<std::unique_ptr<cudf::table>> chunks;
+  do {
+    chunks.emplace_back(reader.read_chunk().tbl);
+  } while (reader.has_next());
+
+  // The decoded size of the string data is unknown until a block has been decompressed, so the
+  // first chunk is a single block; the other chunks are estimated from the compression ratio
+  ASSERT_GT(chunks.size(), std::size_t{2});
+  EXPECT_EQ(chunks.front()->num_rows(), rows_per_block);
+  for (std::size_t i = 0; i < chunks.size(); ++i) {
+    auto const chunk = chunks[i]->view();
+    auto const chunk_size =
+      chunk.num_rows() * (sizeof(int64_t) + sizeof(cudf::size_type)) +
+      static_cast<std::size_t>(cudf::strings_column_view(chunk.column(1)).chars_size());
+    EXPECT_LE(chunk_size, chunk_read_limit);
+    if (i > 0 and i + 1 < chunks.size()) { EXPECT_GT(chunk.num_rows(), rows_per_block); }
+  }
+
+  std::vector<cudf::table_view> views;
+  for (auto const& chunk : chunks) {
+    views.emplace_back(chunk->view());
+  }
+  CUDF_TEST_EXPECT_TABLES_EQUAL(*make_expected_table(0, num_blocks * rows_per_block),
+                                *cudf::concatenate(views));
+}
+
+// Files with more than 256 blocks are indexed by searching for the sync markers in parallel (see
+// `container::index_blocks`); also run with LIBCUDF_HOST_DECOMPRESSION_POLICY=ON, to decompress
+// the deflate blocks on the host (see AVRO_HOST_DECOMPRESSION_TEST in tests/CMakeLists.txt)
+TEST_F(AvroChunkedReaderTest, TestReadManyBlocks)
+{
+  auto constexpr num_blocks     = 1'000;
+  auto constexpr rows_per_block = 20;
+  auto constexpr skip_rows      = 7'010;
+  auto constexpr num_rows       = 5'000;
+
+  for (std::string const codec : {"null", "deflate"}) {
+    auto const file   = make_avro_file(num_blocks, rows_per_block, codec);
+    auto const source = cudf::io::source_info{file.data(), file.size()};
+
+    auto const options  = cudf::io::avro_reader_options::builder(source).build();
+    auto const expected = make_expected_table(0, num_blocks * rows_per_block);
+    CUDF_TEST_EXPECT_TABLES_EQUAL(*expected, cudf::io::read_avro(options).tbl->view());
+
+    auto const [result, num_chunks] = chunked_read(options, 100'000);
+    EXPECT_GT(num_chunks, 1);
+    CUDF_TEST_EXPECT_TABLES_EQUAL(*expected, *result);
+
+    // Rows in the blocks past the serially indexed ones
+    auto const range_options = cudf::io::avro_reader_options::builder(source)
+                                 .skip_rows(skip_rows)
+                                 .num_rows(num_rows)
+                                 .build();
+    CUDF_TEST_EXPECT_TABLES_EQUAL(*make_expected_table(skip_rows, num_rows),
+                                  cudf::io::read_avro(range_options).tbl->view());
+  }
+}
+
+CUDF_TEST_PROGRAM_MAIN()
@@ -15,9 +15,12 @@
  */
 
 #include <io/comp/gpuinflate.hpp>
+#include <io/comp/io_uncomp.hpp>
 #include <io/utilities/hostdevice_vector.hpp>
 #include <src/io/comp/nvcomp_adapter.hpp>
 
+#include <cudf/io/datasource.hpp>
+#include <cudf/io/text/detail/bgzip_utils.hpp>
 #include <cudf/utilities/default_stream.hpp>
 
 #include <cudf_test/base_fixture.hpp>
@@ -25,8 +28,16 @@
 #include <rmm/device_buffer.hpp>
 #include <rmm/device_uvector.hpp>
 
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <sstream>
+#include <string>
 #include <vector>
 
+#include <zlib.h>
+#include <zstd.h>
+
 using cudf::device_span;
 
 /**
@@ -121,6 +132,79 @@ struct BrotliDecompressTest : public DecompressTest<BrotliDecompressTest> {
 
 struct NvcompConfigTest : public cudf::test::BaseFixture {};
 
+struct HostDecompressTest : public cudf::test::BaseFixture {
+  /**
+   * @brief Compresses the data as a sequence of GZIP members
+   */
+  std::string gzip_members(std::string const& data, size_t num_members, int level = 6) const
+  {
+    std::string compressed;
+    auto const member_size = data.size() / num_members + 1;
+    for (size_t ofs = 0; ofs < data.size(); ofs += member_size) {
+      auto const size = std::min(member_size, data.size() - ofs);
+      z_stream strm{};
+      EXPECT_EQ(deflateInit2(&strm, level, Z_DEFLATED, 15 + 16, 8, Z_DEFAULT_STRATEGY), Z_OK);
+      auto const pos = compressed.size();
+      compressed.resize(pos + deflateBound(&strm, size));
+      strm.next_in   = reinterpret_cast<Bytef*>(const_cast<char*>(data.data() + ofs));
+      strm.avail_in  = size;
+      strm.next_out  = reinterpret_cast<Bytef*>(compressed.data() + pos);
+      strm.avail_out = compressed.size() - pos;
+      EXPECT_EQ(deflate(&strm, Z_FINISH), Z_STREAM_END);
+      compressed.resize(pos + strm.total_out);
+      deflateEnd(&strm);
+    }
+    return compressed;
+  }
+
+  /**
+   * @brief Compresses the data as a sequence of BGZF blocks
+   */
+  std::string bgzf_blocks(std::string const& data, size_t block_size) const
+  {
+    std::ostringstream compressed;
+    for (size_t ofs = 0; ofs < data.size(); ofs += block_size) {
+      cudf::io::text::detail::bgzip::write_compressed_block(
+        compressed, {data.data() + ofs, std::min(block_size, data.size() - ofs)});
+    }
+    return compressed.str();
+  }
+
+  /**
+   * @brief Decompresses the whole buffer at once, in parallel where the format allows it
+   */
+  std::string decompress(cudf::io::compression_type compression, std::string const& src) const
+  {
+    auto const output = cudf::io::decompress(
+      compression, {reinterpret_cast<uint8_t const*>(src.data()), src.size()});
+    return {output.begin(), output.end()};
+  }
+
+  /**
+   * @brief Decompresses the buffer with the streaming decompressor used by the text readers
+   */
+  std::string decompress_stream(cudf::io::compression_type compression,
+                                std::string const& src) const
+  {
+    auto const source = cudf::io::datasource::create(
+      cudf::host_span<std::byte const>{reinterpret_cast<std::byte const*>(src.data()), src.size()});
+    auto const output = cudf::io::decompress_range(compression, *source, 0, 0, nullptr);
+    return {output.begin(), output.end()};
+  }
+};
+
+/**
+ * @brief Returns text data of the given number of lines
+ */
+std::string make_lines(int num_lines)
+{
+  std::string data;
+  for (int i = 0; i < num_lines; ++i) {
+    data += std::to_string(i) + "\n";
+  }
+  return data;
+}
+
 TEST_F(GzipDecompressTest, HelloWorld)
 {
   constexpr char uncompressed[]  = "hello world";
@@ -169,6 +253,154 @@ TEST_F(BrotliDecompressTest, HelloWorld)
   EXPECT_EQ(output, input);
 }
 
+TEST_F(HostDecompressTest, Bzip2MultiBlock)
+{
+  // Lines of the characters whose byte values make the symbol map in each block header contain the
+  // block signature 0x314159265359, so that the block scan also finds a false positive in each of
+  // the three 100KB blocks
+  std::string const line = "BCGIOQSTWZ]^acfgiklo\n";
+  std::string uncompressed;
+  for (int i = 0; i < 12000; ++i) {
+    uncompressed += line;
+  }
+  // Produced by `bzip2 -1`
+  constexpr uint8_t compressed[] = {
+    0x42, 0x5a, 0x68, 0x31, 0x31, 0x41, 0x59, 0x26, 0x53, 0x59, 0x98, 0x23, 0xbe, 0xa6, 0x00, 0x12,
+    0x98, 0xc7, 0x00, 0x00, 0x10, 0x18, 0xa0, 0xac, 0x93, 0x29, 0xac, 0xb0, 0x00, 0xd8, 0x05, 0x03,
+    0x4d, 0x0c, 0x8c, 0x98, 0x85, 0x03, 0x4d, 0x0c, 0x8c, 0x98, 0x81, 0x4a, 0xa8, 0x64, 0x60, 0x4d,
+    0x06, 0x73, 0x14, 0x48, 0xed, 0x14, 0x48, 0xef, 0x14, 0x48, 0xf1, 0x14, 0x48, 0xc2, 0x28, 0x91,
+    0x8c, 0x51, 0x23, 0xcc, 0x51, 0x23, 0xd4, 0x51, 0x23, 0x28, 0xa2, 0x46, 0x71, 0x44, 0x8d, 0x22,
+    0x89, 0x1a, 0xc5, 0x12, 0x36, 0x8a, 0x24, 0x6f, 0x14, 0x48, 0xf7, 0x14, 0x48, 0xe2, 0x28, 0x91,
+    0xf2, 0x28, 0x91, 0xf6, 0x28, 0x91, 0xfa, 0x28, 0x91, 0xfe, 0x28, 0x91, 0xcc, 0x51, 0x23, 0xa3,
+    0x14, 0x15, 0x92, 0x65, 0x35, 0x99, 0x82, 0x3b, 0xea, 0x60, 0x01, 0x29, 0x8c, 0x70, 0x00, 0x01,
+    0x01, 0x8a, 0x0a, 0xc9, 0x32, 0x9a, 0xcb, 0x00, 0x0d, 0x80, 0x50, 0x34, 0xd0, 0xc8, 0xc9, 0x88,
+    0x50, 0x34, 0xd0, 0xc8, 0xc9, 0x88, 0x14, 0xaa, 0x86, 0x46, 0x04, 0xd0, 0x67, 0x31, 0x44, 0x8e,
+    0xd1, 0x44, 0x8e, 0xf1, 0x44, 0x8f, 0x11, 0x44, 0x8c, 0x22, 0x89, 0x18, 0xc5, 0x12, 0x3c, 0xc5,
+    0x12, 0x3d, 0x45, 0x12, 0x32, 0x8a, 0x24, 0x67, 0x14, 0x48, 0xd2, 0x28, 0x91, 0xac, 0x51, 0x23,
+    0x68, 0xa2, 0x46, 0xf1, 0x44, 0x8f, 0x71, 0x44, 0x8e, 0x22, 0x89, 0x1f, 0x22, 0x89, 0x1f, 0x62,
+    0x89, 0x1f, 0xa2, 0x89, 0x1f, 0xe2, 0x89, 0x1c, 0xc5, 0x12, 0x3a, 0x31, 0x41, 0x59, 0x26, 0x53,
+    0x59, 0x10, 0x63, 0xc7, 0x95, 0x00, 0x09, 0xad, 0xc7, 0x00, 0x00, 0x10, 0x18, 0xa0, 0xac, 0x93,
+    0x29, 0xac, 0xb0, 0x00, 0xd0, 0x0a, 0x06, 0x9a, 0x19, 0x19, 0x31, 0x04, 0xd5, 0x54, 0x32, 0x30,
+    0x26, 0x83, 0x0a, 0x06, 0x9a, 0x19, 0x19, 0x31, 0x39, 0x84, 0x8a, 0xed, 0x09, 0x15, 0xde, 0x12,
+    0x2b, 0xc4, 0x24, 0x56, 0x10, 0x91, 0x58, 0xc2, 0x45, 0x79, 0x84, 0x8a, 0xf5, 0x09, 0x15, 0x94,
+    0x24, 0x56, 0x70, 0x91, 0x5a, 0x42, 0x45, 0x6b, 0x09, 0x15, 0xb4, 0x24, 0x56, 0xf0, 0x91, 0x5e,
+    0xe1, 0x22, 0xb8, 0x84, 0x8a, 0xf9, 0x09, 0x15, 0xf6, 0x12, 0x2b, 0xf4, 0x24, 0x57, 0xf8, 0x48,
+    0xae, 0x61, 0x22, 0xba, 0x17, 0x72, 0x45, 0x38, 0x50, 0x90, 0x40, 0xaa, 0x40, 0x42};
+
+  auto const output = cudf::io::decompress(cudf::io::compression_type::BZIP2,
+                                           {compressed, sizeof(compressed)});
+  EXPECT_EQ(std::string(output.begin(), output.end()), uncompressed);
+
+  // The block signatures are also found when the compression type is detected
+  auto const detected = cudf::io::decompress(cudf::io::compression_type::AUTO,
+                                             {compressed, sizeof(compressed)});
+  EXPECT_EQ(detected, output);
+}
+
+TEST_F(HostDecompressTest, ZstdFrames)
+{
+  std::string uncompressed;
+  for (int i = 0; i < 100'000; ++i) {
+    uncompressed += std::to_string(i) + "\n";
+  }
+
+  // Compresses the data as a sequence of frames, recording the decompressed size of the frames in
+  // their headers if `record_size` is true
+  auto const compress_frames = [&](size_t num_frames, bool record_size) {
+    std::unique_ptr<ZSTD_CCtx, decltype(&ZSTD_freeCCtx)> cctx{ZSTD_createCCtx(), ZSTD_freeCCtx};
+    auto const err = ZSTD_CCtx_setParameter(cctx.get(), ZSTD_c_contentSizeFlag, record_size);
+    EXPECT_FALSE(ZSTD_isError(err));
+    std::vector<uint8_t> compressed;
+    auto const frame_size = uncompressed.size() / num_frames + 1;
+    for (size_t ofs = 0; ofs < uncompressed.size(); ofs += frame_size) {
+      auto const size = std::min(frame_size, uncompressed.size() - ofs);
+      auto const pos  = compressed.size();
+      compressed.resize(pos + ZSTD_compressBound(size));
+      auto const res = ZSTD_compress2(cctx.get(),
+                                      compressed.data() + pos,
+                                      compressed.size() - pos,
+                                      uncompressed.data() + ofs,
+                                      size);
+      EXPECT_FALSE(ZSTD_isError(res));
+      compressed.resize(pos + res);
+    }
+    return compressed;
+  };
+
+  for (auto const record_size : {true, false}) {
+    for (auto const num_frames : {1, 7, 64}) {
+      auto const compressed = compress_frames(num_frames, record_size);
+      // Frames with recorded sizes are decompressed in parallel, others as a stream
+      auto const output = cudf::io::decompress(cudf::io::compression_type::ZSTD, compressed);
+      EXPECT_EQ(std::string(output.begin(), output.end()), uncompressed);
+    }
+  }
+}
+
+TEST_F(HostDecompressTest, GzipMembers)
+{
+  auto const data = make_lines(200'000);
+  for (auto const num_members : {1, 5, 100}) {
+    auto const compressed = gzip_members(data, num_members);
+    EXPECT_EQ(decompress(cudf::io::compression_type::GZIP, compressed), data);
+    EXPECT_EQ(decompress(cudf::io::compression_type::AUTO, compressed), data);
+    EXPECT_EQ(decompress_stream(cudf::io::compression_type::GZIP, compressed), data);
+  }
+}
+
+TEST_F(HostDecompressTest, AutoUnrecognized)
+{
+  auto const data = make_lines(1'000);
+  EXPECT_THROW(decompress(cudf::io::compression_type::AUTO, data), cudf::logic_error);
+
+  // Raw DEFLATE data is only decompressed when requested explicitly; strip the 10-byte header and
+  // the 8-byte trailer of a GZIP member written by zlib
+  auto const member  = gzip_members(data, 1);
+  auto const deflate = member.substr(10, member.size() - 18);
+  EXPECT_EQ(decompress(cudf::io::compression_type::ZLIB, deflate), data);
+  EXPECT_THROW(decompress(cudf::io::compression_type::AUTO, deflate), cudf::logic_error);
+}
+
+TEST_F(HostDecompressTest, GzipFakeMemberHeaders)
+{
+  // Stored (level 0) DEFLATE blocks hold the data as is, so the compressed data contains the GZIP
+  // member headers that are in the data
+  std::string const fake_header("\x1f\x8b\x08\x00\x00\x00\x00\x00\x00\xff", 10);
+  std::string data;
+  for (int i = 0; i < 10'000; ++i) {
+    data += std::to_string(i) + fake_header;
+  }
+  auto const compressed = gzip_members(data, 4, 0);
+  ASSERT_NE(compressed.find(fake_header, 1), std::string::npos);
+
+  EXPECT_EQ(decompress(cudf::io::compression_type::GZIP, compressed), data);
+  EXPECT_EQ(decompress_stream(cudf::io::compression_type::GZIP, compressed), data);
+}
+
+TEST_F(HostDecompressTest, BgzfBlocks)
+{
+  auto const data       = make_lines(200'000);
+  auto const compressed = bgzf_blocks(data, 32 * 1024);
+  EXPECT_EQ(decompress(cudf::io::compression_type::GZIP, compressed), data);
+  EXPECT_EQ(decompress_stream(cudf::io::compression_type::GZIP, compressed), data);
+
+  // An ordinary GZIP member after the BGZF blocks
+  auto const tail  = make_lines(1'000);
+  auto const mixed = compressed + gzip_members(tail, 1);
+  EXPECT_EQ(decompress(cudf::io::compression_type::GZIP, mixed), data + tail);
+  EXPECT_EQ(decompress_stream(cudf::io::compression_type::GZIP, mixed), data + tail);
+}
+
+TEST_F(HostDecompressTest, BgzfInvalidBlockSize)
+{
+  auto const data = make_lines(1'000);
+  auto compressed = bgzf_blocks(data, data.size());
+  // The decompressed size of the block, recorded at its end, is larger than a BGZF block can hold
+  uint32_t const isize = 64 * 1024 + 1;
+  std::memcpy(compressed.data() + compressed.size() - sizeof(isize), &isize, sizeof(isize));
+  EXPECT_THROW(decompress(cudf::io::compression_type::GZIP, compressed), cudf::logic_error);
+}
+
 TEST_F(NvcompConfigTest, Compression)
 {
   using cudf::io::nvcomp::compression_type;
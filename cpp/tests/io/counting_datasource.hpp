@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) 2023, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/io/datasource.hpp>
+#include <cudf/utilities/span.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Records the ranges read from the wrapped source
+ *
+ * The ranges passed to `host_read_ranges` are read one at a time, so that the recorded ranges are
+ * the ones requested by the reader rather than the coalesced reads.
+ */
+class counting_datasource : public cudf::io::datasource {
+ public:
+  explicit counting_datasource(std::string const& filepath)
+    : source{cudf::io::datasource::create(filepath)}
+  {
+  }
+  std::unique_ptr<buffer> host_read(size_t offset, size_t size) override
+  {
+    record(offset, size);
+    return source->host_read(offset, size);
+  }
+  size_t host_read(size_t offset, size_t size, uint8_t* dst) override
+  {
+    record(offset, size);
+    return source->host_read(offset, size, dst);
+  }
+  std::vector<std::unique_ptr<buffer>> host_read_ranges(
+    cudf::host_span<range const> ranges) override
+  {
+    std::vector<std::unique_ptr<buffer>> buffers;
+    for (auto const& range : ranges) {
+      buffers.push_back(host_read(range.offset, range.size));
+    }
+    return buffers;
+  }
+  [[nodiscard]] size_t size() const override { return source->size(); }
+
+  /**
+   * @brief Returns whether any read overlaps the range [offset, offset + size)
+   */
+  [[nodiscard]] bool was_read(size_t offset, size_t size) const
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    return std::any_of(reads.cbegin(), reads.cend(), [&](auto const& read) {
+      return read.offset < offset + size and offset < read.offset + read.size;
+    });
+  }
+
+  std::unique_ptr<cudf::io::datasource> source;
+  std::atomic<size_t> bytes_read{0};
+
+ private:
+  void record(size_t offset, size_t size)
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    reads.push_back({offset, size});
+    bytes_read += size;
+  }
+
+  mutable std::mutex mutex;
+  std::vector<range> reads;
+};
@@ -22,9 +22,12 @@
 #include <cudf_test/type_lists.hpp>
 
 #include <cudf/detail/iterator.cuh>
+#include <cudf/concatenate.hpp>
 #include <cudf/fixed_point/fixed_point.hpp>
 #include <cudf/io/csv.hpp>
 #include <cudf/io/datasource.hpp>
+#include <cudf/io/seek_index.hpp>
+#include <cudf/io/text/detail/bgzip_utils.hpp>
 #include <cudf/strings/convert/convert_datetime.hpp>
 #include <cudf/strings/convert/convert_fixed_point.hpp>
 #include <cudf/strings/strings_column_view.hpp>
@@ -40,6 +43,7 @@
 #include <thrust/iterator/counting_iterator.h>
 
 #include <algorithm>
+#include <cstring>
 #include <fstream>
 #include <iostream>
 #include <iterator>
@@ -49,6 +53,11 @@
 #include <string>
 #include <vector>
 
+#include <lz4frame.h>
+#include <lzma.h>
+#include <zlib.h>
+#include <zstd.h>
+
 using cudf::data_type;
 using cudf::type_id;
 using cudf::type_to_id;
@@ -2497,4 +2506,342 @@ TEST_F(CsvReaderTest, UTF8BOM)
   CUDF_TEST_EXPECT_TABLES_EQUIVALENT(result_view, expected);
 }
 
+TEST_F(CsvReaderTest, MultiMemberGzip)
+{
+  constexpr int num_rows = 100'000;
+  std::string data       = "a,b\n";
+  for (int i = 0; i < num_rows; ++i) {
+    data += std::to_string(i) + "," + std::to_string(i * 2) + "\n";
+  }
+  // Split the data into multiple GZIP members, with member boundaries inside rows
+  std::ostringstream compressed;
+  auto const num_members = 3;
+  auto const member_size = data.size() / num_members + 1;
+  for (size_t ofs = 0; ofs < data.size(); ofs += member_size) {
+    cudf::io::text::detail::bgzip::write_compressed_block(
+      compressed, {data.data() + ofs, std::min(member_size, data.size() - ofs)});
+  }
+  auto const buffer = compressed.str();
+
+  cudf::io::csv_reader_options in_opts =
+    cudf::io::csv_reader_options::builder(cudf::io::source_info{buffer.c_str(), buffer.size()})
+      .compression(cudf::io::compression_type::GZIP);
+  auto const result      = cudf::io::read_csv(in_opts);
+  auto const result_view = result.tbl->view();
+  EXPECT_EQ(result.metadata.schema_info.front().name, "a");
+
+  auto const seq_a = thrust::make_counting_iterator<int64_t>(0);
+  auto const seq_b =
+    cudf::detail::make_counting_transform_iterator(0, [](int64_t i) { return i * 2; });
+  auto col_a = cudf::test::fixed_width_column_wrapper<int64_t>(seq_a, seq_a + num_rows);
+  auto col_b = cudf::test::fixed_width_column_wrapper<int64_t>(seq_b, seq_b + num_rows);
+  CUDF_TEST_EXPECT_TABLES_EQUIVALENT(result_view, cudf::table_view({col_a, col_b}));
+}
+
+std::string gzip_compress(std::string const& data)
+{
+  z_stream strm{};
+  EXPECT_EQ(deflateInit2(&strm, Z_DEFAULT_COMPRESSION, Z_DEFLATED, 15 + 16, 8, Z_DEFAULT_STRATEGY),
+            Z_OK);
+  std::string compressed(deflateBound(&strm, data.size()), '\0');
+  strm.next_in   = reinterpret_cast<Bytef*>(const_cast<char*>(data.data()));
+  strm.avail_in  = data.size();
+  strm.next_out  = reinterpret_cast<Bytef*>(compressed.data());
+  strm.avail_out = compressed.size();
+  EXPECT_EQ(deflate(&strm, Z_FINISH), Z_STREAM_END);
+  compressed.resize(strm.total_out);
+  deflateEnd(&strm);
+  return compressed;
+}
+
+TEST_F(CsvReaderTest, CompressedUTF8BOM)
+{
+  std::string const data = "\xEF\xBB\xBFMonth,Day\nJune,6\nAugust,25\nMay,1\n";
+  auto const buffer      = gzip_compress(data);
+  cudf::io::csv_reader_options in_opts =
+    cudf::io::csv_reader_options::builder(cudf::io::source_info{buffer.c_str(), buffer.size()})
+      .compression(cudf::io::compression_type::GZIP);
+  auto const result      = cudf::io::read_csv(in_opts);
+  auto const result_view = result.tbl->view();
+  EXPECT_EQ(result.metadata.schema_info.front().name, "Month");
+
+  auto col1 = cudf::test::strings_column_wrapper({"June", "August", "May"});
+  auto col2 = cudf::test::fixed_width_column_wrapper<int64_t>({6, 25, 1});
+  CUDF_TEST_EXPECT_TABLES_EQUIVALENT(result_view, cudf::table_view({col1, col2}));
+}
+
+// Also run with LIBCUDF_CSV_CHUNK_SIZE=16384, so that the input is parsed in many chunks and rows,
+// quoted terminators and a field longer than a chunk are carried over to the next chunk (see
+// CSV_SMALL_CHUNK_TEST in tests/CMakeLists.txt)
+TEST_F(CsvReaderTest, ChunkedInput)
+{
+  constexpr int num_rows = 20'000;
+  std::string data       = "id,name\n";
+  std::vector<int64_t> ids;
+  std::vector<std::string> names;
+  for (int i = 0; i < num_rows; ++i) {
+    auto name = "name_" + std::to_string(i);
+    if (i % 1000 == 0) { name += "\nnext_line"; }
+    if (i == 2500) { name = std::string(40'000, 'x'); }
+    data += std::to_string(i) + ",\"" + name + "\"\n";
+    ids.push_back(i);
+    names.push_back(name);
+  }
+  auto col_id         = cudf::test::fixed_width_column_wrapper<int64_t>(ids.begin(), ids.end());
+  auto col_name       = cudf::test::strings_column_wrapper(names.begin(), names.end());
+  auto const expected = cudf::table_view({col_id, col_name});
+
+  auto const filepath = temp_env->get_temp_filepath("ChunkedInput.csv");
+  {
+    std::ofstream outfile(filepath, std::ofstream::out | std::ofstream::binary);
+    outfile << data;
+  }
+  auto const result = cudf::io::read_csv(
+    cudf::io::csv_reader_options::builder(cudf::io::source_info{filepath}).build());
+  CUDF_TEST_EXPECT_TABLES_EQUIVALENT(result.tbl->view(), expected);
+
+  auto const buffer            = gzip_compress(data);
+  auto const compressed_result = cudf::io::read_csv(
+    cudf::io::csv_reader_options::builder(cudf::io::source_info{buffer.c_str(), buffer.size()})
+      .compression(cudf::io::compression_type::GZIP)
+      .build());
+  CUDF_TEST_EXPECT_TABLES_EQUIVALENT(compressed_result.tbl->view(), expected);
+}
+
+TEST_F(CsvReaderTest, CompressedByteRange)
+{
+  constexpr int num_rows = 100'000;
+  std::string data;
+  for (int i = 0; i < num_rows; ++i) {
+    data += std::to_string(i) + "," + std::to_string(i * 2) + "\n";
+  }
+  auto const filepath = temp_env->get_temp_filepath("CompressedByteRange.csv.gz");
+  {
+    std::ofstream outfile(filepath, std::ofstream::out | std::ofstream::binary);
+    outfile << gzip_compress(data);
+  }
+
+  // Store the seek index in a sidecar file
+  auto const index_filepath = filepath + ".idx";
+  cudf::io::write_seek_index(
+    cudf::io::build_seek_index(
+      cudf::io::source_info{filepath}, cudf::io::compression_type::GZIP, 64 * 1024),
+    cudf::io::sink_info{index_filepath});
+  auto const index = std::make_shared<cudf::io::compressed_seek_index const>(
+    cudf::io::read_seek_index(cudf::io::source_info{index_filepath}));
+  EXPECT_GT(index->points().size(), 1);
+  EXPECT_EQ(index->uncompressed_size(), data.size());
+
+  std::vector<std::unique_ptr<cudf::table>> tables;
+  std::vector<cudf::table_view> views;
+  size_t const range_size = data.size() / 4 + 1;
+  for (size_t offset = 0; offset < data.size(); offset += range_size) {
+    cudf::io::csv_reader_options in_opts =
+      cudf::io::csv_reader_options::builder(cudf::io::source_info{filepath})
+        .header(-1)
+        .byte_range_offset(offset)
+        .byte_range_size(range_size)
+        .seek_index(index);
+    tables.push_back(cudf::io::read_csv(in_opts).tbl);
+    views.push_back(tables.back()->view());
+  }
+  auto const result = cudf::concatenate(views);
+
+  auto const seq_a = thrust::make_counting_iterator<int64_t>(0);
+  auto const seq_b =
+    cudf::detail::make_counting_transform_iterator(0, [](int64_t i) { return i * 2; });
+  auto col_a = cudf::test::fixed_width_column_wrapper<int64_t>(seq_a, seq_a + num_rows);
+  auto col_b = cudf::test::fixed_width_column_wrapper<int64_t>(seq_b, seq_b + num_rows);
+  CUDF_TEST_EXPECT_TABLES_EQUIVALENT(result->view(), cudf::table_view({col_a, col_b}));
+}
+
+TEST_F(CsvReaderTest, InvalidSeekIndex)
+{
+  std::string data;
+  for (int i = 0; i < 10'000; ++i) {
+    data += std::to_string(i) + "\n";
+  }
+  auto const compressed = gzip_compress(data);
+  auto const serialized =
+    cudf::io::build_seek_index(cudf::io::source_info{compressed.data(), compressed.size()})
+      .serialize();
+
+  // Truncated index
+  EXPECT_THROW(cudf::io::compressed_seek_index::deserialize(
+                 {serialized.data(), serialized.size() - 1}),
+               cudf::logic_error);
+
+  // Point count that does not fit in the index; rejected before allocating the points
+  constexpr size_t num_points_pos = 24;
+  auto corrupted                  = serialized;
+  auto const num_points           = std::numeric_limits<uint64_t>::max() / 2;
+  std::memcpy(corrupted.data() + num_points_pos, &num_points, sizeof(num_points));
+  EXPECT_THROW(cudf::io::compressed_seek_index::deserialize(corrupted), cudf::logic_error);
+}
+
+TEST_F(CsvReaderTest, BgzfWithGzipMemberByteRange)
+{
+  constexpr int num_rows = 20'000;
+  std::string data;
+  for (int i = 0; i < num_rows; ++i) {
+    data += std::to_string(i) + "," + std::to_string(i * 2) + "\n";
+  }
+  // BGZF blocks for the first half of the data, followed by an ordinary GZIP member
+  auto const split = data.find('\n', data.size() / 2) + 1;
+  std::ostringstream compressed_stream;
+  cudf::io::text::detail::bgzip::write_compressed_block(compressed_stream,
+                                                        {data.data(), split / 2});
+  cudf::io::text::detail::bgzip::write_compressed_block(
+    compressed_stream, {data.data() + split / 2, split - split / 2});
+  auto const compressed = compressed_stream.str() + gzip_compress(data.substr(split));
+  auto const source     = cudf::io::source_info{compressed.data(), compressed.size()};
+
+  // Indexed by decompressing the source, as the BGZF block sizes do not cover all of it
+  auto const index = std::make_shared<cudf::io::compressed_seek_index const>(
+    cudf::io::build_seek_index(source, cudf::io::compression_type::GZIP, 16 * 1024));
+  EXPECT_EQ(index->uncompressed_size(), data.size());
+
+  std::vector<std::unique_ptr<cudf::table>> tables;
+  std::vector<cudf::table_view> views;
+  size_t const range_size = data.size() / 3 + 1;
+  for (size_t offset = 0; offset < data.size(); offset += range_size) {
+    cudf::io::csv_reader_options in_opts = cudf::io::csv_reader_options::builder(source)
+                                             .header(-1)
+                                             .compression(cudf::io::compression_type::GZIP)
+                                             .byte_range_offset(offset)
+                                             .byte_range_size(range_size)
+                                             .seek_index(index);
+    tables.push_back(cudf::io::read_csv(in_opts).tbl);
+    views.push_back(tables.back()->view());
+  }
+  auto const result = cudf::concatenate(views);
+
+  auto const seq_a = thrust::make_counting_iterator<int64_t>(0);
+  auto const seq_b =
+    cudf::detail::make_counting_transform_iterator(0, [](int64_t i) { return i * 2; });
+  auto col_a = cudf::test::fixed_width_column_wrapper<int64_t>(seq_a, seq_a + num_rows);
+  auto col_b = cudf::test::fixed_width_column_wrapper<int64_t>(seq_b, seq_b + num_rows);
+  CUDF_TEST_EXPECT_TABLES_EQUIVALENT(result->view(), cudf::table_view({col_a, col_b}));
+}
+
+// Compresses the data as a sequence of independent frames (or streams, for XZ; members, for GZIP)
+std::string compress_frames(cudf::io::compression_type compression,
+                            std::string const& data,
+                            size_t num_frames)
+{
+  std::string compressed;
+  auto const frame_size = data.size() / num_frames + 1;
+  for (size_t ofs = 0; ofs < data.size(); ofs += frame_size) {
+    auto const size = std::min(frame_size, data.size() - ofs);
+    auto const pos  = compressed.size();
+    switch (compression) {
+      case cudf::io::compression_type::GZIP:
+        compressed += gzip_compress(data.substr(ofs, size));
+        break;
+      case cudf::io::compression_type::ZSTD: {
+        compressed.resize(pos + ZSTD_compressBound(size));
+        auto const res = ZSTD_compress(
+          compressed.data() + pos, compressed.size() - pos, data.data() + ofs, size, 1);
+        EXPECT_FALSE(ZSTD_isError(res));
+        compressed.resize(pos + res);
+        break;
+      }
+      case cudf::io::compression_type::LZ4: {
+        compressed.resize(pos + LZ4F_compressFrameBound(size, nullptr));
+        auto const res = LZ4F_compressFrame(
+          compressed.data() + pos, compressed.size() - pos, data.data() + ofs, size, nullptr);
+        EXPECT_FALSE(LZ4F_isError(res));
+        compressed.resize(pos + res);
+        break;
+      }
+      case cudf::io::compression_type::XZ: {
+        compressed.resize(pos + lzma_stream_buffer_bound(size));
+        size_t out_pos = pos;
+        EXPECT_EQ(lzma_easy_buffer_encode(1,
+                                          LZMA_CHECK_CRC64,
+                                          nullptr,
+                                          reinterpret_cast<uint8_t const*>(data.data() + ofs),
+                                          size,
+                                          reinterpret_cast<uint8_t*>(compressed.data()),
+                                          &out_pos,
+                                          compressed.size()),
+                  LZMA_OK);
+        compressed.resize(out_pos);
+        break;
+      }
+      default: CUDF_FAIL("Unsupported compression type");
+    }
+  }
+  return compressed;
+}
+
+TEST_F(CsvReaderTest, HostDecompressedFormats)
+{
+  constexpr int num_rows = 100'000;
+  std::string data;
+  for (int i = 0; i < num_rows; ++i) {
+    data += std::to_string(i) + "," + std::to_string(i * 2) + "\n";
+  }
+  auto const seq_a = thrust::make_counting_iterator<int64_t>(0);
+  auto const seq_b =
+    cudf::detail::make_counting_transform_iterator(0, [](int64_t i) { return i * 2; });
+  auto col_a = cudf::test::fixed_width_column_wrapper<int64_t>(seq_a, seq_a + num_rows);
+  auto col_b = cudf::test::fixed_width_column_wrapper<int64_t>(seq_b, seq_b + num_rows);
+
+  for (auto const compression : {cudf::io::compression_type::GZIP,
+                                 cudf::io::compression_type::ZSTD,
+                                 cudf::io::compression_type::LZ4,
+                                 cudf::io::compression_type::XZ}) {
+    auto const compressed = compress_frames(compression, data, 3);
+    cudf::io::csv_reader_options in_opts =
+      cudf::io::csv_reader_options::builder(
+        cudf::io::source_info{compressed.data(), compressed.size()})
+        .header(-1)
+        .compression(compression);
+    auto const result = cudf::io::read_csv(in_opts);
+    CUDF_TEST_EXPECT_TABLES_EQUIVALENT(result.tbl->view(), cudf::table_view({col_a, col_b}));
+  }
+}
+
+TEST_F(CsvReaderTest, ZstdByteRange)
+{
+  constexpr int num_rows      = 100'000;
+  constexpr size_t num_frames = 16;
+  std::string data;
+  for (int i = 0; i < num_rows; ++i) {
+    data += std::to_string(i) + "," + std::to_string(i * 2) + "\n";
+  }
+  auto const compressed = compress_frames(cudf::io::compression_type::ZSTD, data, num_frames);
+  auto const source     = cudf::io::source_info{compressed.data(), compressed.size()};
+
+  // Seek points at the start of the frames, detected from the contents
+  auto const index = std::make_shared<cudf::io::compressed_seek_index const>(
+    cudf::io::build_seek_index(source, cudf::io::compression_type::AUTO, 1));
+  EXPECT_EQ(index->compression(), cudf::io::compression_type::ZSTD);
+  EXPECT_EQ(index->points().size(), num_frames);
+  EXPECT_EQ(index->uncompressed_size(), data.size());
+
+  std::vector<std::unique_ptr<cudf::table>> tables;
+  std::vector<cudf::table_view> views;
+  size_t const range_size = data.size() / 5 + 1;
+  for (size_t offset = 0; offset < data.size(); offset += range_size) {
+    cudf::io::csv_reader_options in_opts = cudf::io::csv_reader_options::builder(source)
+                                             .header(-1)
+                                             .compression(cudf::io::compression_type::ZSTD)
+                                             .byte_range_offset(offset)
+                                             .byte_range_size(range_size)
+                                             .seek_index(index);
+    tables.push_back(cudf::io::read_csv(in_opts).tbl);
+    views.push_back(tables.back()->view());
+  }
+  auto const result = cudf::concatenate(views);
+
+  auto const seq_a = thrust::make_counting_iterator<int64_t>(0);
+  auto const seq_b =
+    cudf::detail::make_counting_transform_iterator(0, [](int64_t i) { return i * 2; });
+  auto col_a = cudf::test::fixed_width_column_wrapper<int64_t>(seq_a, seq_a + num_rows);
+  auto col_b = cudf::test::fixed_width_column_wrapper<int64_t>(seq_b, seq_b + num_rows);
+  CUDF_TEST_EXPECT_TABLES_EQUIVALENT(result->view(), cudf::table_view({col_a, col_b}));
+}
+
 CUDF_TEST_PROGRAM_MAIN()
@@ -16,9 +16,16 @@
 
 #include <cudf_test/base_fixture.hpp>
 #include <cudf_test/cudf_gtest.hpp>
+#include <cudf_test/file_utilities.hpp>
 
 #include <src/io/utilities/file_io_utilities.hpp>
 
+#include <fcntl.h>
+
+#include <fstream>
+#include <future>
+#include <iterator>
+#include <numeric>
 #include <type_traits>
 
 // Base test fixture for tests
@@ -42,4 +49,139 @@ TEST_F(CuFileIOTest, SliceSize)
   }
 }
 
+TEST_F(CuFileIOTest, CoalesceReadRanges)
+{
+  using range = cudf::io::datasource::range;
+  std::vector<range> const ranges{{1000, 100}, {0, 10}, {15, 5}, {2000, 10}, {1050, 10}, {40, 0}};
+
+  auto const reads = cudf::io::detail::coalesce_read_ranges(ranges, 20);
+  ASSERT_EQ(reads.size(), 3);
+  // Gap of 5 bytes is merged; the empty range at offset 40 is within the gap as well
+  EXPECT_EQ(reads[0].slice.offset, 0);
+  EXPECT_EQ(reads[0].slice.size, 40);
+  EXPECT_EQ(reads[0].range_indices, (std::vector<size_t>{1, 2, 5}));
+  // Overlapping ranges are merged
+  EXPECT_EQ(reads[1].slice.offset, 1000);
+  EXPECT_EQ(reads[1].slice.size, 100);
+  EXPECT_EQ(reads[1].range_indices, (std::vector<size_t>{0, 4}));
+  EXPECT_EQ(reads[2].slice.offset, 2000);
+  EXPECT_EQ(reads[2].slice.size, 10);
+  EXPECT_EQ(reads[2].range_indices, (std::vector<size_t>{3}));
+
+  // No gap allowed; only touching and overlapping ranges are merged
+  EXPECT_EQ(cudf::io::detail::coalesce_read_ranges(ranges, 0).size(), 5);
+}
+
+TEST_F(CuFileIOTest, IoUringReads)
+{
+  temp_directory const tmpdir{"io_uring_test"};
+  auto const filepath = tmpdir.path() + "data.bin";
+
+  std::vector<uint8_t> data(3 << 20);
+  std::iota(data.begin(), data.end(), 0);
+  std::ofstream(filepath, std::ios::binary)
+    .write(reinterpret_cast<char const*>(data.data()), data.size());
+
+  cudf::io::detail::file_wrapper const file(filepath, O_RDONLY);
+  std::unique_ptr<cudf::io::detail::io_uring_input_impl> reader;
+  try {
+    reader = std::make_unique<cudf::io::detail::io_uring_input_impl>(file.desc());
+  } catch (cudf::logic_error const&) {
+    GTEST_SKIP() << "io_uring is not supported on this system";
+  }
+
+  // Ranges are submitted together, including one that extends past the end of the file
+  std::vector<std::pair<size_t, size_t>> const ranges{
+    {0, 1 << 20}, {12345, 100}, {(1 << 20) + 7, 2 << 20}, {data.size() - 10, 100}, {42, 0}};
+  std::vector<std::vector<uint8_t>> outputs;
+  std::vector<std::future<size_t>> reads;
+  for (auto const& [offset, size] : ranges) {
+    outputs.emplace_back(size);
+    reads.emplace_back(reader->read_async(offset, size, outputs.back().data()));
+  }
+  for (size_t i = 0; i < ranges.size(); ++i) {
+    auto const [offset, size] = ranges[i];
+    auto const expected_size  = std::min(size, data.size() - offset);
+    ASSERT_EQ(reads[i].get(), expected_size);
+    EXPECT_TRUE(std::equal(
+      outputs[i].begin(), outputs[i].begin() + expected_size, data.begin() + offset));
+  }
+}
+
+TEST_F(CuFileIOTest, PreadReads)
+{
+  temp_directory const tmpdir{"pread_test"};
+  auto const filepath = tmpdir.path() + "data.bin";
+
+  // Larger than the default slice size, so that reads are split across the thread pool
+  std::vector<uint8_t> data((11 << 20) + 321);
+  std::iota(data.begin(), data.end(), 0);
+  std::ofstream(filepath, std::ios::binary)
+    .write(reinterpret_cast<char const*>(data.data()), data.size());
+
+  cudf::io::detail::file_wrapper const file(filepath, O_RDONLY);
+  cudf::io::detail::pread_input_impl reader(file.desc());
+
+  // Several threads read through the same object, including reads past the end of the file
+  std::vector<std::pair<size_t, size_t>> const ranges{{0, data.size()},
+                                                      {12345, 100},
+                                                      {(1 << 20) + 7, 9 << 20},
+                                                      {data.size() - 10, 100},
+                                                      {42, 0},
+                                                      {(5 << 20) - 1, 5 << 20}};
+  auto const check_read = [&](size_t i, bool async) {
+    auto const [offset, size] = ranges[i];
+    std::vector<uint8_t> output(size);
+    auto const bytes_read = async ? reader.read_async(offset, size, output.data()).get()
+                                  : reader.read(offset, size, output.data());
+    auto const expected_size = std::min(size, data.size() - offset);
+    return bytes_read == expected_size &&
+           std::equal(output.begin(), output.begin() + expected_size, data.begin() + offset);
+  };
+  std::vector<std::future<bool>> readers;
+  for (int repeat = 0; repeat < 4; ++repeat) {
+    for (size_t i = 0; i < ranges.size(); ++i) {
+      readers.emplace_back(std::async(std::launch::async, check_read, i, repeat % 2 == 0));
+    }
+  }
+  for (auto& read : readers) {
+    EXPECT_TRUE(read.get());
+  }
+}
+
+TEST_F(CuFileIOTest, HostFileOutput)
+{
+  temp_directory const tmpdir{"host_file_output_test"};
+
+  std::vector<uint8_t> data((9 << 20) + 123);
+  std::iota(data.begin(), data.end(), 0);
+  // Sizes that are not aligned, and that span the direct I/O staging buffer
+  std::vector<size_t> const write_sizes{1000, 5 << 20, 1, 0, (4 << 20) - 1001};
+
+  for (auto const direct_io : {false, true}) {
+    auto const filepath = tmpdir.path() + (direct_io ? "direct.bin" : "buffered.bin");
+    {
+      cudf::io::detail::host_file_output output(filepath, direct_io);
+      std::vector<std::future<void>> writes;
+      size_t offset = 0;
+      for (auto const size : write_sizes) {
+        writes.emplace_back(output.write_async(data.data() + offset, offset, size));
+        offset += size;
+      }
+      for (auto& write : writes) {
+        write.get();
+      }
+      // Flush a partial block, then append to it
+      output.flush();
+      output.write_async(data.data() + offset, offset, data.size() - offset).get();
+      output.flush();
+    }
+
+    std::ifstream infile(filepath, std::ios::binary);
+    std::vector<uint8_t> const written((std::istreambuf_iterator<char>(infile)),
+                                       std::istreambuf_iterator<char>());
+    EXPECT_EQ(written, data);
+  }
+}
+
 CUDF_TEST_PROGRAM_MAIN()
@@ -22,9 +22,14 @@
 #include <cudf_test/table_utilities.hpp>
 #include <cudf_test/type_lists.hpp>
 
+#include <io/comp/io_uncomp.hpp>
+
+#include <cudf/concatenate.hpp>
 #include <cudf/detail/iterator.cuh>
 #include <cudf/io/datasource.hpp>
 #include <cudf/io/json.hpp>
+#include <cudf/io/seek_index.hpp>
+#include <cudf/io/text/detail/bgzip_utils.hpp>
 #include <cudf/strings/convert/convert_fixed_point.hpp>
 #include <cudf/strings/strings_column_view.hpp>
 #include <cudf/table/table.hpp>
@@ -36,7 +41,9 @@
 
 #include <arrow/io/api.h>
 
+#include <algorithm>
 #include <fstream>
+#include <sstream>
 #include <type_traits>
 
 #define wrapper cudf::test::fixed_width_column_wrapper
@@ -1773,6 +1780,118 @@ TEST_F(JsonReaderTest, UnsupportedMultipleFileInputs)
   EXPECT_THROW(cudf::io::read_json(comp_opts), cudf::logic_error);
 }
 
+TEST_F(JsonReaderTest, MultiMemberGzip)
+{
+  constexpr int num_rows = 100'000;
+  std::string data;
+  for (int i = 0; i < num_rows; ++i) {
+    data += "{\"a\":" + std::to_string(i) + "}\n";
+  }
+  // Split the data into multiple GZIP members, with member boundaries inside records
+  std::ostringstream compressed;
+  auto const num_members = 3;
+  auto const member_size = data.size() / num_members + 1;
+  for (size_t ofs = 0; ofs < data.size(); ofs += member_size) {
+    cudf::io::text::detail::bgzip::write_compressed_block(
+      compressed, {data.data() + ofs, std::min(member_size, data.size() - ofs)});
+  }
+  auto const buffer = compressed.str();
+
+  cudf::io::json_reader_options const in_opts =
+    cudf::io::json_reader_options::builder(cudf::io::source_info{buffer.c_str(), buffer.size()})
+      .lines(true)
+      .compression(cudf::io::compression_type::GZIP);
+  auto const result = cudf::io::read_json(in_opts);
+
+  auto const seq = thrust::make_counting_iterator<int64_t>(0);
+  auto expected  = cudf::test::fixed_width_column_wrapper<int64_t>(seq, seq + num_rows);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(result.tbl->view().column(0), expected);
+}
+
+TEST_F(JsonReaderTest, BgzfByteRange)
+{
+  constexpr int num_rows = 100'000;
+  std::string data;
+  for (int i = 0; i < num_rows; ++i) {
+    data += "{\"a\":" + std::to_string(i) + "}\n";
+  }
+  std::ostringstream compressed;
+  constexpr size_t block_size = 32 * 1024;
+  for (size_t ofs = 0; ofs < data.size(); ofs += block_size) {
+    cudf::io::text::detail::bgzip::write_compressed_block(
+      compressed, {data.data() + ofs, std::min(block_size, data.size() - ofs)});
+  }
+  auto const buffer = compressed.str();
+  auto const source = cudf::io::source_info{buffer.c_str(), buffer.size()};
+
+  auto const index =
+    std::make_shared<cudf::io::compressed_seek_index const>(cudf::io::build_seek_index(source));
+  EXPECT_GT(index->points().size(), 1);
+  EXPECT_EQ(index->uncompressed_size(), data.size());
+
+  std::vector<std::unique_ptr<cudf::table>> tables;
+  std::vector<cudf::column_view> columns;
+  cudf::size_type const range_size = data.size() / 3 + 1;
+  for (cudf::size_type offset = 0; offset < static_cast<cudf::size_type>(data.size());
+       offset += range_size) {
+    cudf::io::json_reader_options const in_opts =
+      cudf::io::json_reader_options::builder(source)
+        .lines(true)
+        .compression(cudf::io::compression_type::GZIP)
+        .byte_range_offset(offset)
+        .byte_range_size(range_size)
+        .seek_index(index);
+    tables.push_back(cudf::io::read_json(in_opts).tbl);
+    columns.push_back(tables.back()->view().column(0));
+  }
+  auto const result = cudf::concatenate(columns);
+
+  auto const seq = thrust::make_counting_iterator<int64_t>(0);
+  auto expected  = cudf::test::fixed_width_column_wrapper<int64_t>(seq, seq + num_rows);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(result->view(), expected);
+}
+
+TEST_F(JsonReaderTest, MultiSourceGzip)
+{
+  // More sources than decompression threads, each with several BGZF blocks, so that the blocks are
+  // decompressed from within the tasks that decompress the sources
+  auto const num_sources =
+    std::max<int>(16, 2 * cudf::io::host_decompression_pool().get_thread_count());
+
+  constexpr int rows_per_source   = 1'000;
+  constexpr int blocks_per_source = 4;
+  std::vector<std::string> filepaths;
+  for (int f = 0; f < num_sources; ++f) {
+    std::string data;
+    for (int i = 0; i < rows_per_source; ++i) {
+      data += "{\"a\":" + std::to_string(f * rows_per_source + i) + "}\n";
+    }
+    // Some sources do not end with a line delimiter
+    if (f % 2 == 1) { data.pop_back(); }
+    std::ostringstream compressed;
+    auto const block_size = data.size() / blocks_per_source + 1;
+    for (size_t ofs = 0; ofs < data.size(); ofs += block_size) {
+      cudf::io::text::detail::bgzip::write_compressed_block(
+        compressed, {data.data() + ofs, std::min(block_size, data.size() - ofs)});
+    }
+    filepaths.push_back(temp_env->get_temp_dir() + "MultiSourceGzip" + std::to_string(f) +
+                        ".json.gz");
+    std::ofstream outfile(filepaths.back(), std::ofstream::out | std::ofstream::binary);
+    outfile << compressed.str();
+  }
+
+  cudf::io::json_reader_options const in_opts =
+    cudf::io::json_reader_options::builder(cudf::io::source_info{filepaths})
+      .lines(true)
+      .compression(cudf::io::compression_type::GZIP);
+  auto const result = cudf::io::read_json(in_opts);
+
+  auto const seq = thrust::make_counting_iterator<int64_t>(0);
+  auto expected =
+    cudf::test::fixed_width_column_wrapper<int64_t>(seq, seq + num_sources * rows_per_source);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(result.tbl->view().column(0), expected);
+}
+
 TEST_F(JsonReaderTest, TrailingCommas)
 {
   std::vector<std::string> const json_lines_valid{
@@ -0,0 +1,188 @@
+/*
+ * Copyright (c) 2023, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_utilities.hpp>
+#include <cudf_test/column_wrapper.hpp>
+#include <cudf_test/cudf_gtest.hpp>
+#include <cudf_test/table_utilities.hpp>
+
+#include <cudf/concatenate.hpp>
+#include <cudf/detail/iterator.cuh>
+#include <cudf/io/orc.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_view.hpp>
+
+#include <thrust/iterator/counting_iterator.h>
+
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace {
+
+using int32s_col  = cudf::test::fixed_width_column_wrapper<int32_t>;
+using strings_col = cudf::test::strings_column_wrapper;
+
+auto constexpr rows_per_stripe = 1000;
+
+auto write_buffer(cudf::table_view const& input, cudf::io::compression_type compression)
+{
+  std::vector<char> buffer;
+  auto const write_opts =
+    cudf::io::orc_writer_options::builder(cudf::io::sink_info{&buffer}, input)
+      .compression(compression)
+      .stripe_size_rows(rows_per_stripe)
+      .build();
+  cudf::io::write_orc(write_opts);
+  return buffer;
+}
+
+auto make_input(int num_rows)
+{
+  auto const value_iter = thrust::make_counting_iterator(0);
+  auto const str_iter   = cudf::detail::make_counting_transform_iterator(
+    0, [](auto i) { return "value_" + std::to_string(i); });
+
+  std::vector<std::unique_ptr<cudf::column>> input_columns;
+  input_columns.emplace_back(int32s_col(value_iter, value_iter + num_rows).release());
+  input_columns.emplace_back(strings_col(str_iter, str_iter + num_rows).release());
+  return std::make_unique<cudf::table>(std::move(input_columns));
+}
+
+auto chunked_read(cudf::io::orc_reader_options const& options,
+                  std::size_t chunk_read_limit,
+                  std::size_t pass_read_limit = 0)
+{
+  auto reader = cudf::io::chunked_orc_reader(chunk_read_limit, pass_read_limit, options);
+
+  auto num_chunks = 0;
+  auto out_tables = std::vector<std::unique_ptr<cudf::table>>{};
+
+  do {
+    auto chunk = reader.read_chunk();
+    out_tables.emplace_back(std::move(chunk.tbl));
+    ++num_chunks;
+  } while (reader.has_next());
+
+  auto out_tviews = std::vector<cudf::table_view>{};
+  for (auto const& tbl : out_tables) {
+    out_tviews.emplace_back(tbl->view());
+  }
+
+  return std::pair(cudf::concatenate(out_tviews), num_chunks);
+}
+
+}  // namespace
+
+struct OrcChunkedReaderTest : public cudf::test::BaseFixture {};
+
+TEST_F(OrcChunkedReaderTest, TestChunkedReadNoData)
+{
+  auto const input  = make_input(0);
+  auto const buffer = write_buffer(input->view(), cudf::io::compression_type::NONE);
+  auto const options =
+    cudf::io::orc_reader_options::builder(cudf::io::source_info{buffer.data(), buffer.size()})
+      .build();
+
+  auto const [result, num_chunks] = chunked_read(options, 1'000);
+  EXPECT_EQ(num_chunks, 1);
+  EXPECT_EQ(result->num_rows(), 0);
+  EXPECT_EQ(result->num_columns(), 2);
+}
+
+TEST_F(OrcChunkedReaderTest, TestChunkedReadStripes)
+{
+  auto constexpr num_stripes = 10;
+  auto const input           = make_input(num_stripes * rows_per_stripe);
+
+  for (auto const compression :
+       {cudf::io::compression_type::NONE, cudf::io::compression_type::SNAPPY}) {
+    auto const buffer = write_buffer(input->view(), compression);
+    auto const options =
+      cudf::io::orc_reader_options::builder(cudf::io::source_info{buffer.data(), buffer.size()})
+        .build();
+
+    // No limit
+    {
+      auto const [result, num_chunks] = chunked_read(options, 0);
+      EXPECT_EQ(num_chunks, 1);
+      CUDF_TEST_EXPECT_TABLES_EQUAL(input->view(), *result);
+    }
+
+    // Output limit smaller than a stripe; each chunk holds a single stripe
+    {
+      auto const [result, num_chunks] = chunked_read(options, 1);
+      EXPECT_EQ(num_chunks, num_stripes);
+      CUDF_TEST_EXPECT_TABLES_EQUAL(input->view(), *result);
+    }
+
+    // Pass limit smaller than a stripe; each chunk holds a single stripe
+    {
+      auto const [result, num_chunks] = chunked_read(options, 0, 1);
+      EXPECT_EQ(num_chunks, num_stripes);
+      CUDF_TEST_EXPECT_TABLES_EQUAL(input->view(), *result);
+    }
+
+    // Output limit of a few stripes
+    {
+      auto const [result, num_chunks] = chunked_read(options, 50'000);
+      EXPECT_GT(num_chunks, 1);
+      EXPECT_LT(num_chunks, num_stripes);
+      CUDF_TEST_EXPECT_TABLES_EQUAL(input->view(), *result);
+    }
+
+    // Output limit larger than the output
+    {
+      auto const [result, num_chunks] = chunked_read(options, 100'000'000);
+      EXPECT_LE(num_chunks, 2);
+      CUDF_TEST_EXPECT_TABLES_EQUAL(input->view(), *result);
+    }
+  }
+}
+
+TEST_F(OrcChunkedReaderTest, TestChunkedReadSkipRows)
+{
+  auto constexpr num_stripes = 10;
+  auto constexpr skip_rows   = 1500;
+  auto constexpr num_rows    = 5000;
+
+  auto const input   = make_input(num_stripes * rows_per_stripe);
+  auto const buffer  = write_buffer(input->view(), cudf::io::compression_type::NONE);
+  auto const options = cudf::io::orc_reader_options::builder(
+                         cudf::io::source_info{buffer.data(), buffer.size()})
+                         .skip_rows(skip_rows)
+                         .num_rows(num_rows)
+                         .build();
+  auto const expected = cudf::io::read_orc(options);
+
+  // Rows 1500-6499 are in stripes 1-6
+  {
+    auto const [result, num_chunks] = chunked_read(options, 1);
+    EXPECT_EQ(num_chunks, 6);
+    EXPECT_EQ(result->num_rows(), num_rows);
+    CUDF_TEST_EXPECT_TABLES_EQUAL(expected.tbl->view(), *result);
+  }
+
+  // No limits; the rows are still selected by the chunked reader
+  {
+    auto reader = cudf::io::chunked_orc_reader(0, options);
+    ASSERT_TRUE(reader.has_next());
+    auto const chunk = reader.read_chunk();
+    EXPECT_FALSE(reader.has_next());
+    CUDF_TEST_EXPECT_TABLES_EQUAL(expected.tbl->view(), chunk.tbl->view());
+  }
+}
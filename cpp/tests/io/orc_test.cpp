@@ -26,14 +26,23 @@
 #include <cudf/concatenate.hpp>
 #include <cudf/copying.hpp>
 #include <cudf/detail/iterator.cuh>
+#include <cudf/io/metadata_cache.hpp>
 #include <cudf/io/orc.hpp>
 #include <cudf/io/orc_metadata.hpp>
+#include <cudf/stream_compaction.hpp>
 #include <cudf/strings/strings_column_view.hpp>
 #include <cudf/table/table.hpp>
 #include <cudf/table/table_view.hpp>
+#include <cudf/transform.hpp>
+#include <cudf/utilities/default_stream.hpp>
 #include <cudf/utilities/span.hpp>
 #include <src/io/comp/nvcomp_adapter.hpp>
+#include <src/io/orc/bloom_filter.hpp>
+#include <src/io/orc/orc.hpp>
+#include <tests/io/counting_datasource.hpp>
 
+#include <algorithm>
+#include <limits>
 #include <type_traits>
 
 template <typename T, typename SourceElementT = T>
@@ -1861,4 +1870,231 @@ TEST_F(OrcWriterTest, EmptyChildStringColumn)
   CUDF_TEST_EXPECT_TABLES_EQUAL(expected, result.tbl->view());
 }
 
+TEST_F(OrcReaderTest, MetadataCache)
+{
+  auto const original_limit = cudf::io::get_metadata_cache_size_limit();
+  cudf::io::set_metadata_cache_size_limit(1 << 20);
+
+  auto const filepath = temp_env->get_temp_filepath("MetadataCache.orc");
+  auto write_and_read = [&](table_view const& expected) {
+    cudf::io::write_orc(
+      cudf::io::orc_writer_options::builder(cudf::io::sink_info{filepath}, expected));
+    // Read twice; the second read uses the cached file tail
+    for (int i = 0; i < 2; ++i) {
+      auto const result = cudf::io::read_orc(
+        cudf::io::orc_reader_options::builder(cudf::io::source_info{filepath}));
+      CUDF_TEST_EXPECT_TABLES_EQUAL(expected, result.tbl->view());
+    }
+  };
+
+  int32_col col0{1, 2, 3};
+  write_and_read(table_view{{col0}});
+
+  // Overwriting the file changes its size and modification time; the cached tail is not used
+  int64_col col1{4, 5, 6, 7};
+  str_col col2{"a", "bb", "ccc", "dddd"};
+  write_and_read(table_view{{col1, col2}});
+
+  cudf::io::invalidate_cached_metadata(filepath);
+  write_and_read(table_view{{col2}});
+
+  cudf::io::clear_metadata_cache();
+  cudf::io::set_metadata_cache_size_limit(original_limit);
+}
+
+namespace {
+/**
+ * @brief Returns the indices of the stripes whose data streams were read from a source
+ */
+std::vector<size_t> stripes_read(counting_datasource& source)
+{
+  cudf::io::orc::metadata const md(source.source.get(), cudf::get_default_stream());
+  std::vector<size_t> stripes;
+  for (size_t stripe = 0; stripe < md.ff.stripes.size(); ++stripe) {
+    auto const& info = md.ff.stripes[stripe];
+    if (source.was_read(info.offset + info.indexLength, info.dataLength)) {
+      stripes.push_back(stripe);
+    }
+  }
+  return stripes;
+}
+
+}  // namespace
+
+TEST_F(OrcReaderTest, Filter)
+{
+  constexpr auto num_rows    = 20000;
+  constexpr auto stripe_rows = 5000;
+  constexpr auto stride      = 1000;
+  // col0 is sorted; col1 is constant within each row group, so that the statistics of a stripe
+  // span values that none of its row groups contain
+  auto sequence = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i; });
+  auto rowgroup_values =
+    cudf::detail::make_counting_transform_iterator(0, [](auto i) { return (i / stride) * 2; });
+  auto strings = cudf::detail::make_counting_transform_iterator(
+    0, [](auto i) { return "str" + std::to_string(100000 + i); });
+  int64_col col0(sequence, sequence + num_rows);
+  int32_col col1(rowgroup_values, rowgroup_values + num_rows);
+  str_col col2(strings, strings + num_rows);
+  auto const expected = table_view{{col0, col1, col2}};
+
+  auto const filepath = temp_env->get_temp_filepath("OrcFilter.orc");
+  cudf::io::write_orc(cudf::io::orc_writer_options::builder(cudf::io::sink_info{filepath}, expected)
+                        .stripe_size_rows(stripe_rows)
+                        .row_index_stride(stride));
+
+  // Returns the stripes whose data was read
+  auto test_expr = [&](auto& expr) {
+    auto predicate     = cudf::compute_column(expected, expr);
+    auto const matches = cudf::apply_boolean_mask(expected, *predicate);
+
+    counting_datasource source{filepath};
+    auto const result = cudf::io::read_orc(
+      cudf::io::orc_reader_options::builder(cudf::io::source_info{&source}).filter(expr));
+    CUDF_TEST_EXPECT_TABLES_EQUAL(matches->view(), result.tbl->view());
+    return stripes_read(source);
+  };
+
+  auto filter_col0 = cudf::ast::column_reference(0);
+  auto filter_col1 = cudf::ast::column_reference(1);
+  auto filter_col2 = cudf::ast::column_reference(2);
+  auto v0          = cudf::numeric_scalar<int64_t>(7500);
+  auto v1          = cudf::numeric_scalar<int32_t>(3);
+  auto v2          = cudf::numeric_scalar<int32_t>(24);
+  auto v3          = cudf::string_scalar("str112345");
+  auto lit0        = cudf::ast::literal(v0);
+  auto lit1        = cudf::ast::literal(v1);
+  auto lit2        = cudf::ast::literal(v2);
+  auto lit3        = cudf::ast::literal(v3);
+
+  // Filtering AST - table[0] < 7500; prunes the last two stripes
+  auto expr0 = cudf::ast::operation(cudf::ast::ast_operator::LESS, filter_col0, lit0);
+  EXPECT_EQ(test_expr(expr0), (std::vector<size_t>{0, 1}));
+  // Filtering AST - table[1] == 3; matches the statistics of the first stripe but none of its row
+  // groups
+  auto expr1 = cudf::ast::operation(cudf::ast::ast_operator::EQUAL, filter_col1, lit1);
+  EXPECT_TRUE(test_expr(expr1).empty());
+  // Filtering AST - table[1] == 24 OR table[2] == "str112345"; both only match the third stripe
+  auto expr2 = cudf::ast::operation(cudf::ast::ast_operator::EQUAL, filter_col1, lit2);
+  auto expr3 = cudf::ast::operation(cudf::ast::ast_operator::EQUAL, filter_col2, lit3);
+  auto expr4 = cudf::ast::operation(cudf::ast::ast_operator::LOGICAL_OR, expr2, expr3);
+  EXPECT_EQ(test_expr(expr4), (std::vector<size_t>{2}));
+
+  // Row selection disables stripe pruning; the filter is still applied to the rows read
+  auto predicate     = cudf::compute_column(expected, expr0);
+  auto const matches = cudf::apply_boolean_mask(expected, *predicate);
+  auto const result  = cudf::io::read_orc(
+    cudf::io::orc_reader_options::builder(cudf::io::source_info{filepath})
+      .num_rows(num_rows)
+      .filter(expr0));
+  CUDF_TEST_EXPECT_TABLES_EQUAL(matches->view(), result.tbl->view());
+}
+
+TEST_F(OrcReaderTest, FilterBloomFilter)
+{
+  constexpr auto num_rows    = 20000;
+  constexpr auto stripe_rows = 5000;
+  constexpr auto stride      = 1000;
+  // Every row group spans almost the whole value range, so statistics alone cannot prune stripes
+  auto values = cudf::detail::make_counting_transform_iterator(
+    0, [](auto i) { return static_cast<int64_t>((i * 7919) % num_rows); });
+  auto doubles = cudf::detail::make_counting_transform_iterator(
+    0, [](auto i) { return static_cast<double>((i * 7919) % num_rows) / 2; });
+  auto strings = cudf::detail::make_counting_transform_iterator(
+    0, [](auto i) { return "key" + std::to_string(100000 + (i * 7919) % num_rows); });
+  int64_col col0(values, values + num_rows);
+  float64_col col1(doubles, doubles + num_rows);
+  str_col col2(strings, strings + num_rows);
+  auto const expected = table_view{{col0, col1, col2}};
+
+  cudf::io::table_input_metadata expected_metadata(expected);
+  expected_metadata.column_metadata[0].set_bloom_filter(true);
+  expected_metadata.column_metadata[1].set_bloom_filter(true);
+  expected_metadata.column_metadata[2].set_bloom_filter(true);
+
+  for (auto const compression :
+       {cudf::io::compression_type::NONE, cudf::io::compression_type::SNAPPY}) {
+    auto const filepath = temp_env->get_temp_filepath("OrcFilterBloomFilter.orc");
+    cudf::io::write_orc(
+      cudf::io::orc_writer_options::builder(cudf::io::sink_info{filepath}, expected)
+        .metadata(expected_metadata)
+        .compression(compression)
+        .stripe_size_rows(stripe_rows)
+        .row_index_stride(stride));
+
+    // Returns the stripes whose data was read
+    auto test_expr = [&](auto& expr) {
+      auto predicate     = cudf::compute_column(expected, expr);
+      auto const matches = cudf::apply_boolean_mask(expected, *predicate);
+
+      counting_datasource source{filepath};
+      auto const result = cudf::io::read_orc(
+        cudf::io::orc_reader_options::builder(cudf::io::source_info{&source}).filter(expr));
+      CUDF_TEST_EXPECT_TABLES_EQUAL(matches->view(), result.tbl->view());
+      return stripes_read(source);
+    };
+
+    auto filter_col0 = cudf::ast::column_reference(0);
+    auto filter_col1 = cudf::ast::column_reference(1);
+    auto filter_col2 = cudf::ast::column_reference(2);
+    auto v0          = cudf::numeric_scalar<int64_t>(1234);
+    auto v1          = cudf::numeric_scalar<int64_t>(5678);
+    auto v2          = cudf::numeric_scalar<double>(617.0);
+    auto v3          = cudf::string_scalar("key112345");
+    auto v4          = cudf::string_scalar("key11234");
+    auto lit0        = cudf::ast::literal(v0);
+    auto lit1        = cudf::ast::literal(v1);
+    auto lit2        = cudf::ast::literal(v2);
+    auto lit3        = cudf::ast::literal(v3);
+    auto lit4        = cudf::ast::literal(v4);
+
+    // Filtering AST - table[0] IN (1234, 5678)
+    auto expr0 = cudf::ast::operation(cudf::ast::ast_operator::EQUAL, filter_col0, lit0);
+    auto expr1 = cudf::ast::operation(cudf::ast::ast_operator::EQUAL, filter_col0, lit1);
+    auto expr2 = cudf::ast::operation(cudf::ast::ast_operator::LOGICAL_OR, expr0, expr1);
+    test_expr(expr2);
+    // Single values are present in one stripe, and within the statistics of all of them, so the
+    // other stripes are pruned by their Bloom filters unless each of their row groups is a false
+    // positive
+    constexpr size_t num_stripes = num_rows / stripe_rows;
+    // Filtering AST - table[1] == 617.0
+    auto expr3 = cudf::ast::operation(cudf::ast::ast_operator::EQUAL, filter_col1, lit2);
+    EXPECT_LT(test_expr(expr3).size(), num_stripes);
+    // Filtering AST - table[2] == "key112345"
+    auto expr4 = cudf::ast::operation(cudf::ast::ast_operator::EQUAL, filter_col2, lit3);
+    EXPECT_LT(test_expr(expr4).size(), num_stripes);
+    // Filtering AST - table[2] == "key11234"; within the statistics range but not present
+    auto expr5 = cudf::ast::operation(cudf::ast::ast_operator::EQUAL, filter_col2, lit4);
+    EXPECT_LT(test_expr(expr5).size(), num_stripes);
+    // Filtering AST - table[0] == 1234 AND table[2] == "key11234"
+    auto expr6 = cudf::ast::operation(cudf::ast::ast_operator::LOGICAL_AND, expr0, expr5);
+    EXPECT_LT(test_expr(expr6).size(), num_stripes);
+  }
+}
+
+TEST_F(OrcReaderTest, BloomFilterHash)
+{
+  using cudf::io::orc::bloom_filter_double_hash;
+  using cudf::io::orc::bloom_filter_long_hash;
+
+  // Values of BloomFilter.getLongHash in ORC Java, which operates on `long`, with arithmetic right
+  // shifts; negative values and zero differ from a hash computed with logical shifts
+  EXPECT_EQ(bloom_filter_long_hash(0), 0x0ul);
+  EXPECT_EQ(bloom_filter_long_hash(1), 0x5bca7c69b794f8ceul);
+  EXPECT_EQ(bloom_filter_long_hash(42), 0x0f3db82f1e7b6f7aul);
+  EXPECT_EQ(bloom_filter_long_hash(-1), 0x5bca868437950d03ul);
+  EXPECT_EQ(bloom_filter_long_hash(-1000), 0xb93f62c4727eb04eul);
+  EXPECT_EQ(bloom_filter_long_hash(std::numeric_limits<int64_t>::min()), 0x3be7d0f7780de548ul);
+  EXPECT_EQ(bloom_filter_long_hash(std::numeric_limits<int64_t>::max()), 0x81ad52718398e837ul);
+
+  // Doubles are hashed through Double.doubleToLongBits
+  EXPECT_EQ(bloom_filter_double_hash(0.0), 0x0ul);
+  EXPECT_EQ(bloom_filter_double_hash(-0.0), 0x3be7d0f7780de548ul);
+  EXPECT_EQ(bloom_filter_double_hash(1.5), 0x3dddff49a005b9c8ul);
+  EXPECT_EQ(bloom_filter_double_hash(-1.5), 0xe4a8253924e5fe37ul);
+  EXPECT_EQ(bloom_filter_double_hash(-1000.25), 0x73fc961cbc5cf481ul);
+  EXPECT_EQ(bloom_filter_double_hash(-std::numeric_limits<double>::infinity()),
+            0x96e782fc7639e1bcul);
+}
+
 CUDF_TEST_PROGRAM_MAIN()
@@ -0,0 +1,127 @@
+/*
+ * Copyright (c) 2023, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_wrapper.hpp>
+#include <cudf_test/cudf_gtest.hpp>
+#include <cudf_test/table_utilities.hpp>
+
+#include <cudf/contiguous_split.hpp>
+#include <cudf/io/packed.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_view.hpp>
+
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+
+#include <string>
+#include <vector>
+
+namespace {
+// Global environment for temporary files
+auto const temp_env = static_cast<cudf::test::TempDirTestEnvironment*>(
+  ::testing::AddGlobalTestEnvironment(new cudf::test::TempDirTestEnvironment));
+
+using int64s_col  = cudf::test::fixed_width_column_wrapper<int64_t>;
+using strings_col = cudf::test::strings_column_wrapper;
+
+// Spans several 1MB bounce buffers
+auto constexpr num_rows           = 500'000;
+auto constexpr bounce_buffer_size = 1024 * 1024;
+
+std::unique_ptr<cudf::table> make_table()
+{
+  auto const values = thrust::make_counting_iterator(0);
+  auto const valids =
+    thrust::make_transform_iterator(values, [](auto i) { return i % 7 != 0; });
+  std::vector<std::string> names;
+  for (int r = 0; r < num_rows; ++r) {
+    names.push_back("row_" + std::to_string(r));
+  }
+  std::vector<std::unique_ptr<cudf::column>> columns;
+  columns.emplace_back(int64s_col(values, values + num_rows, valids).release());
+  columns.emplace_back(strings_col(names.begin(), names.end()).release());
+  return std::make_unique<cudf::table>(std::move(columns));
+}
+
+}  // namespace
+
+struct PackedTest : public cudf::test::BaseFixture {};
+
+TEST_F(PackedTest, FileRoundTrip)
+{
+  auto const table    = make_table();
+  auto const filepath = temp_env->get_temp_filepath("PackedFileRoundTrip.bin");
+  cudf::io::write_packed(table->view(), cudf::io::sink_info{filepath}, bounce_buffer_size);
+
+  auto const packed = cudf::io::read_packed(cudf::io::source_info{filepath});
+  CUDF_TEST_EXPECT_TABLES_EQUAL(cudf::unpack(packed), table->view());
+}
+
+TEST_F(PackedTest, HostBufferRoundTrip)
+{
+  auto const table = make_table();
+  std::vector<char> out_buffer;
+  cudf::io::write_packed(table->view(), cudf::io::sink_info{&out_buffer}, bounce_buffer_size);
+
+  auto const packed =
+    cudf::io::read_packed(cudf::io::source_info{out_buffer.data(), out_buffer.size()});
+  CUDF_TEST_EXPECT_TABLES_EQUAL(cudf::unpack(packed), table->view());
+}
+
+TEST_F(PackedTest, EmptyTable)
+{
+  std::vector<std::unique_ptr<cudf::column>> columns;
+  columns.emplace_back(int64s_col{}.release());
+  auto const table = cudf::table(std::move(columns));
+  std::vector<char> out_buffer;
+  cudf::io::write_packed(table.view(), cudf::io::sink_info{&out_buffer}, bounce_buffer_size);
+
+  auto const packed =
+    cudf::io::read_packed(cudf::io::source_info{out_buffer.data(), out_buffer.size()});
+  CUDF_TEST_EXPECT_TABLES_EQUAL(cudf::unpack(packed), table.view());
+}
+
+TEST_F(PackedTest, InvalidInput)
+{
+  auto const table = make_table();
+  std::vector<char> out_buffer;
+  cudf::io::write_packed(table->view(), cudf::io::sink_info{&out_buffer}, bounce_buffer_size);
+
+  // Truncated data
+  EXPECT_THROW(
+    cudf::io::read_packed(cudf::io::source_info{out_buffer.data(), out_buffer.size() - 1}),
+    cudf::logic_error);
+
+  // Corrupted data, detected by the data checksum
+  auto corrupted_buffer = out_buffer;
+  corrupted_buffer[100] ^= 0x1;
+  EXPECT_THROW(
+    cudf::io::read_packed(cudf::io::source_info{corrupted_buffer.data(), corrupted_buffer.size()}),
+    cudf::logic_error);
+
+  // Files of the first version, whose metadata preceded the data and had no header
+  auto old_version_buffer = out_buffer;
+  old_version_buffer[4]   = 1;
+  EXPECT_THROW(cudf::io::read_packed(
+                 cudf::io::source_info{old_version_buffer.data(), old_version_buffer.size()}),
+               cudf::logic_error);
+
+  // Corrupted magic number
+  out_buffer[0] = 'X';
+  EXPECT_THROW(cudf::io::read_packed(cudf::io::source_info{out_buffer.data(), out_buffer.size()}),
+               cudf::logic_error);
+}
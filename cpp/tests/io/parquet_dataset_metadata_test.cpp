@@ -0,0 +1,228 @@
+/*
+ * Copyright (c) 2023, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_wrapper.hpp>
+#include <cudf_test/cudf_gtest.hpp>
+#include <cudf_test/table_utilities.hpp>
+
+#include <cudf/concatenate.hpp>
+#include <cudf/io/parquet.hpp>
+#include <cudf/io/parquet_metadata.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_view.hpp>
+
+#include <thrust/iterator/counting_iterator.h>
+
+#include <cstdio>
+#include <string>
+#include <vector>
+
+namespace {
+// Global environment for temporary files
+auto const temp_env = static_cast<cudf::test::TempDirTestEnvironment*>(
+  ::testing::AddGlobalTestEnvironment(new cudf::test::TempDirTestEnvironment));
+
+using int32s_col  = cudf::test::fixed_width_column_wrapper<int32_t>;
+using strings_col = cudf::test::strings_column_wrapper;
+
+auto constexpr rows_per_row_group = 5000;
+
+std::unique_ptr<cudf::table> make_table(int first_row, int num_rows)
+{
+  auto const values = thrust::make_counting_iterator(first_row);
+  std::vector<std::string> names;
+  for (int r = first_row; r < first_row + num_rows; ++r) {
+    names.push_back("row_" + std::to_string(r));
+  }
+  std::vector<std::unique_ptr<cudf::column>> columns;
+  columns.emplace_back(int32s_col(values, values + num_rows).release());
+  columns.emplace_back(strings_col(names.begin(), names.end()).release());
+  return std::make_unique<cudf::table>(std::move(columns));
+}
+
+/**
+ * @brief Writes the table to a file of the dataset directory and returns the metadata blob.
+ */
+std::unique_ptr<std::vector<uint8_t>> write_file(cudf::table_view const& table,
+                                                 std::string const& filename)
+{
+  auto const options =
+    cudf::io::parquet_writer_options::builder(
+      cudf::io::sink_info{temp_env->get_temp_filepath(filename)}, table)
+      .row_group_size_rows(rows_per_row_group)
+      .column_chunks_file_paths({filename})
+      .build();
+  return cudf::io::write_parquet(options);
+}
+
+}  // namespace
+
+struct ParquetDatasetMetadataTest : public cudf::test::BaseFixture {};
+
+TEST_F(ParquetDatasetMetadataTest, AppendFiles)
+{
+  auto const table0 = make_table(0, 12000);
+  auto const table1 = make_table(12000, 3000);
+  auto const table2 = make_table(15000, 5000);
+  write_file(table0->view(), "part-0.parquet");
+  auto const blob1 = write_file(table1->view(), "part-1.parquet");
+  write_file(table2->view(), "part-2.parquet");
+
+  auto const metadata_path        = temp_env->get_temp_filepath("_metadata");
+  auto const common_metadata_path = temp_env->get_temp_filepath("_common_metadata");
+  {
+    cudf::io::parquet_dataset_metadata summary;
+    summary.append_file("part-0.parquet",
+                        cudf::io::source_info{temp_env->get_temp_filepath("part-0.parquet")});
+    summary.append_file_metadata("part-1.parquet", *blob1);
+    summary.write_metadata(cudf::io::sink_info{metadata_path});
+    summary.write_common_metadata(cudf::io::sink_info{common_metadata_path});
+  }
+
+  // Append to the existing summary
+  {
+    cudf::io::parquet_dataset_metadata summary(cudf::io::source_info{metadata_path});
+    EXPECT_EQ(summary.num_rows(), 15000);
+    ASSERT_EQ(summary.files().size(), 2);
+    summary.append_file("part-2.parquet",
+                        cudf::io::source_info{temp_env->get_temp_filepath("part-2.parquet")});
+    summary.write_metadata(cudf::io::sink_info{metadata_path});
+  }
+
+  auto const metadata = cudf::io::read_parquet_metadata(cudf::io::source_info{metadata_path});
+  EXPECT_EQ(metadata.num_rows(), 20000);
+  EXPECT_EQ(metadata.num_rowgroups(), 3 + 1 + 1);
+  EXPECT_EQ(metadata.schema().root().num_children(), 2);
+
+  auto const common_metadata =
+    cudf::io::read_parquet_metadata(cudf::io::source_info{common_metadata_path});
+  EXPECT_EQ(common_metadata.num_rows(), 0);
+  EXPECT_EQ(common_metadata.num_rowgroups(), 0);
+  EXPECT_EQ(common_metadata.schema().root().num_children(), 2);
+
+  // Plan the reads of the dataset from the summary alone
+  cudf::io::parquet_dataset_metadata const summary(cudf::io::source_info{metadata_path});
+  auto const& files = summary.files();
+  ASSERT_EQ(files.size(), 3);
+  std::vector<cudf::table_view> const expected{table0->view(), table1->view(), table2->view()};
+  std::vector<cudf::size_type> const expected_row_groups{3, 1, 1};
+  std::vector<int> const first_rows{0, 12000, 15000};
+  for (size_t i = 0; i < files.size(); ++i) {
+    EXPECT_EQ(files[i].path, "part-" + std::to_string(i) + ".parquet");
+    EXPECT_EQ(files[i].num_rowgroups, expected_row_groups[i]);
+    EXPECT_EQ(files[i].num_rows, expected[i].num_rows());
+
+    // Read the last row group of each file
+    auto const last_row_group = files[i].num_rowgroups - 1;
+    auto const options =
+      cudf::io::parquet_reader_options::builder(
+        cudf::io::source_info{temp_env->get_temp_filepath(files[i].path)})
+        .row_groups({{last_row_group}})
+        .build();
+    auto const result         = cudf::io::read_parquet(options);
+    auto const row_group_rows = last_row_group * rows_per_row_group;
+    auto const expected_rows =
+      make_table(first_rows[i] + row_group_rows, expected[i].num_rows() - row_group_rows);
+    CUDF_TEST_EXPECT_TABLES_EQUAL(result.tbl->view(), expected_rows->view());
+  }
+}
+
+TEST_F(ParquetDatasetMetadataTest, SchemaMismatch)
+{
+  auto const table = make_table(0, 100);
+  write_file(table->view(), "schema-0.parquet");
+
+  std::vector<std::unique_ptr<cudf::column>> columns;
+  columns.emplace_back(int32s_col{1, 2, 3}.release());
+  auto const other_table = cudf::table(std::move(columns));
+  write_file(other_table.view(), "schema-1.parquet");
+
+  cudf::io::parquet_dataset_metadata summary;
+  summary.append_file("schema-0.parquet",
+                      cudf::io::source_info{temp_env->get_temp_filepath("schema-0.parquet")});
+  EXPECT_THROW(summary.append_file(
+                 "schema-1.parquet",
+                 cudf::io::source_info{temp_env->get_temp_filepath("schema-1.parquet")}),
+               cudf::logic_error);
+  EXPECT_EQ(summary.files().size(), 1);
+  EXPECT_EQ(summary.num_rows(), 100);
+}
+
+TEST_F(ParquetDatasetMetadataTest, ReadDataset)
+{
+  std::vector<std::unique_ptr<cudf::table>> tables;
+  tables.push_back(make_table(0, 12000));
+  tables.push_back(make_table(12000, 3000));
+  tables.push_back(make_table(15000, 5000));
+  cudf::io::parquet_dataset_metadata summary;
+  for (size_t i = 0; i < tables.size(); ++i) {
+    auto const filename = "read-" + std::to_string(i) + ".parquet";
+    auto const blob     = write_file(tables[i]->view(), filename);
+    summary.append_file_metadata(filename, *blob);
+  }
+  auto const metadata_path = temp_env->get_temp_filepath("read_metadata");
+  summary.write_metadata(cudf::io::sink_info{metadata_path});
+  auto const source = cudf::io::source_info{metadata_path};
+
+  // Read the whole dataset through the `_metadata` file
+  {
+    auto const options = cudf::io::parquet_reader_options::builder(source).build();
+    auto const result  = cudf::io::read_parquet_dataset(options);
+    CUDF_TEST_EXPECT_TABLES_EQUAL(result.tbl->view(), make_table(0, 20000)->view());
+  }
+
+  // None of the reads below needs the second file, so it must not be opened
+  std::remove(temp_env->get_temp_filepath("read-1.parquet").c_str());
+  auto const dataset_path = temp_env->get_temp_dir();
+
+  // Rows of the last file, counted from the start of the dataset
+  {
+    auto const options =
+      cudf::io::parquet_reader_options::builder(source).skip_rows(16000).num_rows(2000).build();
+    auto const result = cudf::io::read_parquet_dataset(options);
+    CUDF_TEST_EXPECT_TABLES_EQUAL(result.tbl->view(), make_table(16000, 2000)->view());
+  }
+
+  // Row groups of the first and the last files
+  {
+    auto const options =
+      cudf::io::parquet_reader_options::builder(source).row_groups({{0, 2}, {}, {0}}).build();
+    auto const result    = cudf::io::read_parquet_dataset(summary, dataset_path, options);
+    auto const file0_rg0 = make_table(0, 5000);
+    auto const file0_rg2 = make_table(10000, 2000);
+    auto const file2_rg0 = make_table(15000, 5000);
+    auto const expected  = cudf::concatenate(
+      std::vector<cudf::table_view>{file0_rg0->view(), file0_rg2->view(), file2_rg0->view()});
+    CUDF_TEST_EXPECT_TABLES_EQUAL(result.tbl->view(), expected->view());
+  }
+
+  // Rows past the end of the dataset
+  {
+    auto const options = cudf::io::parquet_reader_options::builder(source).skip_rows(25000).build();
+    auto const result  = cudf::io::read_parquet_dataset(summary, dataset_path, options);
+    EXPECT_EQ(result.tbl->num_rows(), 0);
+    EXPECT_EQ(result.tbl->num_columns(), 2);
+  }
+
+  // Row groups must be given for each file of the dataset
+  {
+    auto const options =
+      cudf::io::parquet_reader_options::builder(source).row_groups({{0}, {0}}).build();
+    EXPECT_THROW(cudf::io::read_parquet_dataset(summary, dataset_path, options),
+                 cudf::logic_error);
+  }
+}
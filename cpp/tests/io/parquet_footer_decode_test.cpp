@@ -0,0 +1,171 @@
+/*
+ * Copyright (c) 2023, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// These tests are run twice, once with the default eager footer decoding and once with
+// LIBCUDF_PARQUET_FOOTER_DECODE=LAZY (see PARQUET_LAZY_FOOTER_DECODE_TEST in tests/CMakeLists.txt)
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_wrapper.hpp>
+#include <cudf_test/cudf_gtest.hpp>
+#include <cudf_test/table_utilities.hpp>
+
+#include <cudf/ast/expressions.hpp>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/concatenate.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/io/parquet.hpp>
+#include <cudf/scalar/scalar.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_view.hpp>
+
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+
+#include <string>
+#include <vector>
+
+namespace {
+// Global environment for temporary files
+auto const temp_env = static_cast<cudf::test::TempDirTestEnvironment*>(
+  ::testing::AddGlobalTestEnvironment(new cudf::test::TempDirTestEnvironment));
+
+using int32s_col  = cudf::test::fixed_width_column_wrapper<int32_t>;
+using strings_col = cudf::test::strings_column_wrapper;
+
+auto constexpr num_rows           = 20000;
+auto constexpr rows_per_row_group = 5000;
+
+/**
+ * @brief Creates a table with columns "a" (int), "b" (string), "c" (list<int>) and "d"
+ * (struct<x: int, y: string>).
+ */
+std::unique_ptr<cudf::table> make_table()
+{
+  auto const values = thrust::make_counting_iterator(0);
+  std::vector<std::string> names;
+  for (int r = 0; r < num_rows; ++r) {
+    names.push_back("row_" + std::to_string(r));
+  }
+
+  std::vector<std::unique_ptr<cudf::column>> columns;
+  columns.emplace_back(int32s_col(values, values + num_rows).release());
+  columns.emplace_back(strings_col(names.begin(), names.end()).release());
+
+  auto const offsets = thrust::make_transform_iterator(values, [](auto i) { return i * 2; });
+  columns.emplace_back(
+    cudf::make_lists_column(num_rows,
+                            int32s_col(offsets, offsets + num_rows + 1).release(),
+                            int32s_col(values, values + 2 * num_rows).release(),
+                            0,
+                            {}));
+
+  int32s_col x(values, values + num_rows);
+  strings_col y(names.rbegin(), names.rend());
+  columns.emplace_back(cudf::test::structs_column_wrapper({x, y}).release());
+  return std::make_unique<cudf::table>(std::move(columns));
+}
+
+/**
+ * @brief Writes the table with row group statistics and page indexes.
+ */
+std::string write_table(cudf::table_view const& table, std::string const& filename)
+{
+  cudf::io::table_input_metadata metadata(table);
+  metadata.column_metadata[0].set_name("a");
+  metadata.column_metadata[1].set_name("b");
+  metadata.column_metadata[2].set_name("c");
+  metadata.column_metadata[3].set_name("d");
+  metadata.column_metadata[3].child(0).set_name("x");
+  metadata.column_metadata[3].child(1).set_name("y");
+
+  auto const filepath = temp_env->get_temp_filepath(filename);
+  auto const options =
+    cudf::io::parquet_writer_options::builder(cudf::io::sink_info{filepath}, table)
+      .metadata(std::move(metadata))
+      .row_group_size_rows(rows_per_row_group)
+      .stats_level(cudf::io::statistics_freq::STATISTICS_COLUMN)
+      .build();
+  cudf::io::write_parquet(options);
+  return filepath;
+}
+
+}  // namespace
+
+struct ParquetFooterDecodeTest : public cudf::test::BaseFixture {};
+
+TEST_F(ParquetFooterDecodeTest, AllColumns)
+{
+  auto const table    = make_table();
+  auto const filepath = write_table(table->view(), "AllColumns.parquet");
+
+  auto const result = cudf::io::read_parquet(
+    cudf::io::parquet_reader_options::builder(cudf::io::source_info{filepath}).build());
+  CUDF_TEST_EXPECT_TABLES_EQUAL(result.tbl->view(), table->view());
+}
+
+TEST_F(ParquetFooterDecodeTest, ColumnProjection)
+{
+  auto const table    = make_table();
+  auto const filepath = write_table(table->view(), "ColumnProjection.parquet");
+
+  auto const options = cudf::io::parquet_reader_options::builder(cudf::io::source_info{filepath})
+                         .columns({"d", "b"})
+                         .build();
+  auto const result = cudf::io::read_parquet(options);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(result.tbl->view(), table->view().select({3, 1}));
+  ASSERT_EQ(result.metadata.schema_info.size(), 2);
+  EXPECT_EQ(result.metadata.schema_info[0].name, "d");
+  EXPECT_EQ(result.metadata.schema_info[1].name, "b");
+}
+
+TEST_F(ParquetFooterDecodeTest, RowGroupSelection)
+{
+  auto const table    = make_table();
+  auto const filepath = write_table(table->view(), "RowGroupSelection.parquet");
+
+  auto const options = cudf::io::parquet_reader_options::builder(cudf::io::source_info{filepath})
+                         .columns({"a", "c"})
+                         .row_groups({{1, 3}})
+                         .build();
+  auto const result = cudf::io::read_parquet(options);
+
+  auto const projected = table->view().select({0, 2});
+  auto const slices    = cudf::slice(
+    projected,
+    {rows_per_row_group, 2 * rows_per_row_group, 3 * rows_per_row_group, 4 * rows_per_row_group});
+  auto const expected = cudf::concatenate(slices);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(result.tbl->view(), expected->view());
+}
+
+TEST_F(ParquetFooterDecodeTest, Filter)
+{
+  auto const table    = make_table();
+  auto const filepath = write_table(table->view(), "Filter.parquet");
+
+  // Statistics of the selected row groups are decoded for the pruning: a < 7000
+  auto literal_value       = cudf::numeric_scalar<int32_t>(7000);
+  auto const literal       = cudf::ast::literal(literal_value);
+  auto const col_name      = cudf::ast::column_name_reference("a");
+  auto const filter        = cudf::ast::operation(cudf::ast::ast_operator::LESS, col_name, literal);
+
+  auto const options = cudf::io::parquet_reader_options::builder(cudf::io::source_info{filepath})
+                         .filter(filter)
+                         .build();
+  auto const result = cudf::io::read_parquet(options);
+
+  auto const expected = cudf::slice(table->view(), {0, 7000})[0];
+  CUDF_TEST_EXPECT_TABLES_EQUAL(result.tbl->view(), expected);
+}
@@ -29,6 +29,7 @@
 #include <cudf/fixed_point/fixed_point.hpp>
 #include <cudf/io/data_sink.hpp>
 #include <cudf/io/datasource.hpp>
+#include <cudf/io/metadata_cache.hpp>
 #include <cudf/io/parquet.hpp>
 #include <cudf/io/parquet_metadata.hpp>
 #include <cudf/stream_compaction.hpp>
@@ -43,12 +44,14 @@
 #include <src/io/parquet/compact_protocol_reader.hpp>
 #include <src/io/parquet/parquet.hpp>
 #include <src/io/parquet/parquet_gpu.hpp>
+#include <tests/io/counting_datasource.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
 
 #include <thrust/iterator/counting_iterator.h>
 
 #include <fstream>
+#include <future>
 #include <random>
 #include <type_traits>
 
@@ -1406,6 +1409,66 @@ TEST_F(ParquetWriterTest, CustomDataSink)
   CUDF_TEST_EXPECT_TABLES_EQUAL(buf_tbl.tbl->view(), expected->view());
 }
 
+class custom_test_async_host_sink : public cudf::io::data_sink {
+ public:
+  explicit custom_test_async_host_sink(std::vector<char>* buffer) : buffer_(buffer) {}
+
+  virtual ~custom_test_async_host_sink() { flush(); }
+
+  void host_write(void const* data, size_t size) override { host_write_async(data, size).get(); }
+
+  std::future<void> host_write_async(void const* data, size_t size) override
+  {
+    ++num_async_writes;
+    // Each write waits for the previous one, so that the writes are appended in order
+    last_write_ = std::async(std::launch::async, [this, previous = last_write_, data, size] {
+                    if (previous.valid()) { previous.get(); }
+                    auto const char_array = static_cast<char const*>(data);
+                    buffer_->insert(buffer_->end(), char_array, char_array + size);
+                  }).share();
+    return std::async(std::launch::deferred, [write = last_write_] { write.get(); });
+  }
+
+  void flush() override
+  {
+    if (last_write_.valid()) { last_write_.get(); }
+  }
+
+  size_t bytes_written() override
+  {
+    flush();
+    return buffer_->size();
+  }
+
+  int num_async_writes = 0;
+
+ private:
+  std::vector<char>* buffer_;
+  std::shared_future<void> last_write_;
+};
+
+TEST_F(ParquetWriterTest, AsyncHostWriteDataSink)
+{
+  std::vector<char> out_buffer;
+  custom_test_async_host_sink custom_sink(&out_buffer);
+
+  srand(31337);
+  auto expected = create_random_fixed_table<int>(5, 100000, false);
+
+  cudf::io::parquet_writer_options args =
+    cudf::io::parquet_writer_options::builder(cudf::io::sink_info{&custom_sink}, *expected);
+  cudf::io::write_parquet(args);
+  custom_sink.flush();
+
+  // Column chunks are written asynchronously
+  EXPECT_GE(custom_sink.num_async_writes, expected->num_columns());
+
+  cudf::io::parquet_reader_options in_args = cudf::io::parquet_reader_options::builder(
+    cudf::io::source_info{out_buffer.data(), out_buffer.size()});
+  auto result = cudf::io::read_parquet(in_args);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(result.tbl->view(), expected->view());
+}
+
 TEST_F(ParquetWriterTest, DeviceWriteLargeishFile)
 {
   auto filepath = temp_env->get_temp_filepath("DeviceWriteLargeishFile.parquet");
@@ -6053,6 +6116,85 @@ TEST_F(ParquetReaderTest, FilterMultiple1)
   CUDF_TEST_EXPECT_TABLES_EQUAL(expected->view(), result);
 }
 
+namespace {
+/**
+ * @brief Returns the indices of the row groups whose column chunk data was read from a source
+ */
+std::vector<size_t> row_groups_read(counting_datasource const& source,
+                                    cudf::io::parquet::FileMetaData const& fmd)
+{
+  std::vector<size_t> row_groups;
+  for (size_t rg = 0; rg < fmd.row_groups.size(); ++rg) {
+    auto const& columns = fmd.row_groups[rg].columns;
+    if (std::any_of(columns.cbegin(), columns.cend(), [&](auto const& chunk) {
+          auto const& meta = chunk.meta_data;
+          auto const start = meta.dictionary_page_offset > 0
+                               ? std::min(meta.dictionary_page_offset, meta.data_page_offset)
+                               : meta.data_page_offset;
+          return source.was_read(start, meta.total_compressed_size);
+        })) {
+      row_groups.push_back(rg);
+    }
+  }
+  return row_groups;
+}
+
+}  // namespace
+
+TEST_F(ParquetReaderTest, FilterPages)
+{
+  constexpr auto num_rows = 100'000;
+  auto sequence = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i; });
+  auto str_elements =
+    cudf::detail::make_counting_transform_iterator(0, [](auto i) { return std::to_string(i); });
+  column_wrapper<int32_t> col0(sequence, sequence + num_rows);
+  column_wrapper<cudf::string_view> col1(str_elements, str_elements + num_rows);
+  column_wrapper<double> col2(sequence, sequence + num_rows);
+  auto const written_table = table_view{{col0, col1, col2}};
+
+  auto const filepath = temp_env->get_temp_filepath("FilterPages.parquet");
+  cudf::io::write_parquet(
+    cudf::io::parquet_writer_options::builder(cudf::io::sink_info{filepath}, written_table)
+      .stats_level(cudf::io::statistics_freq::STATISTICS_COLUMN)
+      .max_page_size_rows(1000));
+
+  auto read_filtered = [&](cudf::ast::expression const& filter) {
+    // Expected result
+    auto predicate = cudf::compute_column(written_table, filter);
+    auto expected  = cudf::apply_boolean_mask(written_table, *predicate);
+
+    counting_datasource source{filepath};
+    auto const result = cudf::io::read_parquet(
+      cudf::io::parquet_reader_options::builder(cudf::io::source_info{&source}).filter(filter));
+    CUDF_TEST_EXPECT_TABLES_EQUAL(expected->view(), result.tbl->view());
+    return source.bytes_read.load();
+  };
+
+  // Point lookup: only the pages containing the value are read
+  auto const file_size   = cudf::io::datasource::create(filepath)->size();
+  auto value             = cudf::numeric_scalar<int32_t>(54'321);
+  auto literal           = cudf::ast::literal(value);
+  auto col_ref_0         = cudf::ast::column_reference(0);
+  auto point_query       = cudf::ast::operation(cudf::ast::ast_operator::EQUAL, col_ref_0, literal);
+  auto const point_bytes = read_filtered(point_query);
+  EXPECT_LT(point_bytes * 10, file_size);
+
+  // Range on the second half of the rows
+  auto half     = cudf::numeric_scalar<int32_t>(num_rows / 2);
+  auto half_lit = cudf::ast::literal(half);
+  auto range_query =
+    cudf::ast::operation(cudf::ast::ast_operator::GREATER_EQUAL, col_ref_0, half_lit);
+  auto const range_bytes = read_filtered(range_query);
+  EXPECT_GT(range_bytes, point_bytes);
+  EXPECT_LT(range_bytes, file_size);
+
+  // No rows match
+  auto none       = cudf::numeric_scalar<int32_t>(-1);
+  auto none_lit   = cudf::ast::literal(none);
+  auto none_query = cudf::ast::operation(cudf::ast::ast_operator::EQUAL, col_ref_0, none_lit);
+  read_filtered(none_query);
+}
+
 TEST_F(ParquetReaderTest, FilterMultiple2)
 {
   // multiple conditions on same column.
@@ -6205,6 +6347,139 @@ TEST_F(ParquetReaderTest, FilterSupported)
   CUDF_TEST_EXPECT_TABLES_EQUAL(expected->view(), result);
 }
 
+TEST_F(ParquetReaderTest, FilterNullLogical)
+{
+  using T                    = uint32_t;
+  auto const [src, filepath] = create_parquet_typed_with_stats<T>("FilterNullLogical.parquet");
+  auto const written_table   = src.view();
+
+  // Filtering AST - (table[0] < 50 NULL_LOGICAL_OR table[1] < 20) NULL_LOGICAL_AND table[0] != 10
+  // row groups min, max:
+  // table[0] 0-80, 81-160, 161-200.
+  // table[1] 200-121, 120-41, 40-0.
+  auto filter_col1 = cudf::ast::column_reference(0);
+  auto filter_col2 = cudf::ast::column_reference(1);
+  auto v1          = cudf::numeric_scalar<T>(50, true);
+  auto v2          = cudf::numeric_scalar<T>(20, true);
+  auto v3          = cudf::numeric_scalar<T>(10, true);
+  auto lit1        = cudf::ast::literal(v1);
+  auto lit2        = cudf::ast::literal(v2);
+  auto lit3        = cudf::ast::literal(v3);
+  auto expr_1      = cudf::ast::operation(cudf::ast::ast_operator::LESS, filter_col1, lit1);
+  auto expr_2      = cudf::ast::operation(cudf::ast::ast_operator::LESS, filter_col2, lit2);
+  auto expr_3 = cudf::ast::operation(cudf::ast::ast_operator::NULL_LOGICAL_OR, expr_1, expr_2);
+  auto expr_4 = cudf::ast::operation(cudf::ast::ast_operator::NOT_EQUAL, filter_col1, lit3);
+  auto expr_5 = cudf::ast::operation(cudf::ast::ast_operator::NULL_LOGICAL_AND, expr_3, expr_4);
+
+  // Expected result
+  auto predicate = cudf::compute_column(written_table, expr_5);
+  auto expected  = cudf::apply_boolean_mask(written_table, *predicate);
+
+  auto si                  = cudf::io::source_info(filepath);
+  auto builder             = cudf::io::parquet_reader_options::builder(si).filter(expr_5);
+  auto table_with_metadata = cudf::io::read_parquet(builder);
+  auto result              = table_with_metadata.tbl->view();
+
+  // tests
+  EXPECT_LT(expected->num_rows(), written_table.num_rows());
+  CUDF_TEST_EXPECT_TABLES_EQUAL(expected->view(), result);
+}
+
+TEST_F(ParquetReaderTest, FilterBloomFilter)
+{
+  using T                 = int64_t;
+  constexpr auto num_rows = 4000;
+  // Every row group spans the whole value range, so statistics alone cannot prune any of them
+  auto values = cudf::detail::make_counting_transform_iterator(
+    0, [](auto i) { return static_cast<T>((i * 7919) % num_rows); });
+  auto strings = cudf::detail::make_counting_transform_iterator(
+    0, [](auto i) { return std::to_string((i * 7919) % num_rows); });
+  auto col0 = cudf::test::fixed_width_column_wrapper<T>(values, values + num_rows);
+  auto col1 = cudf::test::strings_column_wrapper(strings, strings + num_rows);
+  auto const written_table = table_view{{col0, col1}};
+  auto const filepath      = temp_env->get_temp_filepath("FilterBloomFilter.parquet");
+  {
+    cudf::io::table_input_metadata expected_metadata(written_table);
+    expected_metadata.column_metadata[0].set_bloom_filter(true);
+    expected_metadata.column_metadata[1].set_bloom_filter(true);
+    const cudf::io::parquet_writer_options out_opts =
+      cudf::io::parquet_writer_options::builder(cudf::io::sink_info{filepath}, written_table)
+        .metadata(std::move(expected_metadata))
+        .row_group_size_rows(1000);
+    cudf::io::write_parquet(out_opts);
+  }
+
+  // Every column chunk has a valid Bloom filter
+  auto const source = cudf::io::datasource::create(filepath);
+  cudf::io::parquet::FileMetaData fmd;
+  read_footer(source, &fmd);
+  ASSERT_EQ(fmd.row_groups.size(), 4);
+  for (auto const& rg : fmd.row_groups) {
+    for (auto const& chunk : rg.columns) {
+      ASSERT_GT(chunk.meta_data.bloom_filter_offset, 0);
+      ASSERT_GT(chunk.meta_data.bloom_filter_length, 0);
+      auto const buffer = source->host_read(chunk.meta_data.bloom_filter_offset,
+                                            chunk.meta_data.bloom_filter_length);
+      cudf::io::parquet::CompactProtocolReader cp(buffer->data(), buffer->size());
+      cudf::io::parquet::BloomFilterHeader header;
+      ASSERT_TRUE(cp.read(&header));
+      EXPECT_TRUE(header.algorithm.isset.BLOCK);
+      EXPECT_TRUE(header.hash.isset.XXHASH);
+      EXPECT_TRUE(header.compression.isset.UNCOMPRESSED);
+      EXPECT_EQ(cp.bytecount() + header.num_bytes, chunk.meta_data.bloom_filter_length);
+    }
+  }
+
+  auto filter_col0 = cudf::ast::column_reference(0);
+  auto filter_col1 = cudf::ast::column_reference(1);
+  auto v0          = cudf::numeric_scalar<T>(1234, true);
+  auto v1          = cudf::numeric_scalar<T>(num_rows + 1, true);
+  auto v2          = cudf::string_scalar("1234");
+  auto lit0        = cudf::ast::literal(v0);
+  auto lit1        = cudf::ast::literal(v1);
+  auto lit2        = cudf::ast::literal(v2);
+
+  // Returns the row groups whose data was read
+  auto test_expr = [&](auto& expr) {
+    // Expected result
+    auto predicate = cudf::compute_column(written_table, expr);
+    auto expected  = cudf::apply_boolean_mask(written_table, *predicate);
+
+    // tests
+    counting_datasource counting_source{filepath};
+    auto si                  = cudf::io::source_info{&counting_source};
+    auto builder             = cudf::io::parquet_reader_options::builder(si).filter(expr);
+    auto table_with_metadata = cudf::io::read_parquet(builder);
+    auto result              = table_with_metadata.tbl->view();
+
+    CUDF_TEST_EXPECT_TABLES_EQUAL(expected->view(), result);
+    return row_groups_read(counting_source, fmd);
+  };
+
+  // 1234 is only present in one row group, but within the statistics of all of them, so the other
+  // row groups are pruned by their Bloom filters
+  auto const num_row_groups = fmd.row_groups.size();
+  // Filtering AST - table[0] == 1234
+  auto expr0      = cudf::ast::operation(cudf::ast::ast_operator::EQUAL, filter_col0, lit0);
+  auto const rgs0 = test_expr(expr0);
+  EXPECT_FALSE(rgs0.empty());
+  EXPECT_LT(rgs0.size(), num_row_groups);
+  // Filtering AST - table[0] == 4001, absent from every row group
+  auto expr1 = cudf::ast::operation(cudf::ast::ast_operator::EQUAL, filter_col0, lit1);
+  EXPECT_TRUE(test_expr(expr1).empty());
+  // Filtering AST - table[0] == 1234 OR table[0] == 4001
+  auto expr2 = cudf::ast::operation(cudf::ast::ast_operator::LOGICAL_OR, expr0, expr1);
+  EXPECT_EQ(test_expr(expr2), rgs0);
+  // Filtering AST - table[1] == "1234"
+  auto expr3      = cudf::ast::operation(cudf::ast::ast_operator::EQUAL, filter_col1, lit2);
+  auto const rgs3 = test_expr(expr3);
+  EXPECT_FALSE(rgs3.empty());
+  EXPECT_LT(rgs3.size(), num_row_groups);
+  // Filtering AST - table[0] == 1234 AND table[1] == "1234"
+  auto expr4 = cudf::ast::operation(cudf::ast::ast_operator::LOGICAL_AND, expr0, expr3);
+  EXPECT_LT(test_expr(expr4).size(), num_row_groups);
+}
+
 TEST_F(ParquetReaderTest, FilterSupported2)
 {
   using T                 = uint32_t;
@@ -6471,4 +6746,99 @@ TEST_F(ParquetWriterTest, TimestampMicrosINT96NoOverflow)
   CUDF_TEST_EXPECT_TABLES_EQUAL(expected, result.tbl->view());
 }
 
+TEST_F(ParquetReaderTest, MetadataCache)
+{
+  auto const original_limit = cudf::io::get_metadata_cache_size_limit();
+  cudf::io::set_metadata_cache_size_limit(1 << 20);
+  EXPECT_EQ(cudf::io::get_metadata_cache_size_limit(), 1 << 20);
+
+  auto const filepath = temp_env->get_temp_filepath("MetadataCache.parquet");
+  auto write_and_read = [&](cudf::table_view const& expected) {
+    cudf::io::write_parquet(
+      cudf::io::parquet_writer_options::builder(cudf::io::sink_info{filepath}, expected));
+    // Read twice; the second read uses the cached footer
+    for (int i = 0; i < 2; ++i) {
+      auto const result = cudf::io::read_parquet(
+        cudf::io::parquet_reader_options::builder(cudf::io::source_info{filepath}));
+      CUDF_TEST_EXPECT_TABLES_EQUAL(expected, result.tbl->view());
+    }
+  };
+
+  column_wrapper<int32_t> col0{1, 2, 3};
+  write_and_read(table_view{{col0}});
+
+  // Overwriting the file changes its size and modification time; the cached footer is not used
+  column_wrapper<int32_t> col1{4, 5, 6, 7};
+  column_wrapper<double> col2{0.5, 1.5, 2.5, 3.5};
+  write_and_read(table_view{{col1, col2}});
+
+  cudf::io::invalidate_cached_metadata(filepath);
+  write_and_read(table_view{{col2}});
+
+  cudf::io::clear_metadata_cache();
+  cudf::io::set_metadata_cache_size_limit(original_limit);
+}
+
+TEST_F(ParquetReaderTest, DeferredColumnMetadata)
+{
+  constexpr auto num_rows = 100;
+  auto sequence = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i; });
+  auto str_elements =
+    cudf::detail::make_counting_transform_iterator(0, [](auto i) { return std::to_string(i); });
+  column_wrapper<int32_t> col0(sequence, sequence + num_rows);
+  column_wrapper<cudf::string_view> col1(str_elements, str_elements + num_rows);
+  column_wrapper<double> col2(sequence, sequence + num_rows);
+  auto struct_child = column_wrapper<int64_t>(sequence, sequence + num_rows);
+  auto col3         = cudf::test::structs_column_wrapper{{struct_child}};
+
+  auto const expected = table_view{{col0, col1, col2, col3}};
+  auto const filepath = temp_env->get_temp_filepath("DeferredColumnMetadata.parquet");
+  cudf::io::write_parquet(
+    cudf::io::parquet_writer_options::builder(cudf::io::sink_info{filepath}, expected)
+      .row_group_size_rows(num_rows / 4));
+
+  auto const source = cudf::io::datasource::create(filepath);
+  cudf::io::parquet::FileMetaData fmd;
+  read_footer(source, &fmd);
+  ASSERT_TRUE(cudf::io::parquet::CompactProtocolReader().InitSchema(&fmd));
+
+  // Index the footer without decoding the column chunk metadata
+  constexpr auto ender_len = sizeof(cudf::io::parquet::file_ender_s);
+  auto const len           = source->size();
+  auto const ender_buffer  = source->host_read(len - ender_len, ender_len);
+  auto const ender = reinterpret_cast<cudf::io::parquet::file_ender_s const*>(ender_buffer->data());
+  auto const footer_buf =
+    source->host_read(len - ender->footer_len - ender_len, ender->footer_len);
+  cudf::io::parquet::FileMetaData deferred;
+  deferred.encoded_footer = std::make_shared<std::vector<uint8_t> const>(
+    footer_buf->data(), footer_buf->data() + footer_buf->size());
+  cudf::io::parquet::CompactProtocolReader cp(footer_buf->data(), footer_buf->size());
+  cp.defer_column_metadata();
+  ASSERT_TRUE(cp.read(&deferred));
+  ASSERT_TRUE(cp.InitSchema(&deferred));
+
+  ASSERT_EQ(deferred.row_groups.size(), 4);
+  ASSERT_EQ(deferred.row_groups.size(), fmd.row_groups.size());
+  for (size_t rg = 0; rg < fmd.row_groups.size(); ++rg) {
+    ASSERT_EQ(deferred.row_groups[rg].columns.size(), fmd.row_groups[rg].columns.size());
+    for (size_t c = 0; c < fmd.row_groups[rg].columns.size(); ++c) {
+      auto& chunk          = deferred.row_groups[rg].columns[c];
+      auto const& expected = fmd.row_groups[rg].columns[c];
+      EXPECT_EQ(chunk.schema_idx, expected.schema_idx);
+      EXPECT_GT(chunk.meta_data_length, 0);
+      EXPECT_TRUE(chunk.meta_data.path_in_schema.empty());
+
+      // Decode only the chunks of the string and struct child columns
+      if (c % 2 == 0) { continue; }
+      ASSERT_TRUE(cp.read_column_metadata(deferred, &chunk));
+      EXPECT_EQ(chunk.meta_data_length, 0);
+      EXPECT_EQ(chunk.meta_data.path_in_schema, expected.meta_data.path_in_schema);
+      EXPECT_EQ(chunk.meta_data.data_page_offset, expected.meta_data.data_page_offset);
+      EXPECT_EQ(chunk.meta_data.total_compressed_size, expected.meta_data.total_compressed_size);
+      EXPECT_EQ(chunk.meta_data.statistics.min_value, expected.meta_data.statistics.min_value);
+      EXPECT_EQ(chunk.meta_data.statistics.max_value, expected.meta_data.statistics.max_value);
+    }
+  }
+}
+
 CUDF_TEST_PROGRAM_MAIN()
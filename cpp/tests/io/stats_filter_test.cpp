@@ -0,0 +1,218 @@
+/*
+ * Copyright (c) 2023, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// These tests are run twice, once with the default host evaluation of small filters and once with
+// LIBCUDF_HOST_STATS_FILTER_THRESHOLD=0, so that all statistics are evaluated on the device (see
+// DEVICE_STATS_FILTER_TEST in tests/CMakeLists.txt)
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_wrapper.hpp>
+#include <cudf_test/cudf_gtest.hpp>
+#include <cudf_test/table_utilities.hpp>
+
+#include <io/utilities/stats_filter.hpp>
+
+#include <cudf/ast/expressions.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/io/orc.hpp>
+#include <cudf/io/parquet.hpp>
+#include <cudf/scalar/scalar.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/utilities/default_stream.hpp>
+
+#include <thrust/iterator/counting_iterator.h>
+
+#include <optional>
+#include <string_view>
+#include <vector>
+
+namespace {
+// Global environment for temporary files
+auto const temp_env = static_cast<cudf::test::TempDirTestEnvironment*>(
+  ::testing::AddGlobalTestEnvironment(new cudf::test::TempDirTestEnvironment));
+
+using cudf::io::detail::stats_min_max;
+using cudf::io::detail::stats_value;
+
+using int32s_col = cudf::test::fixed_width_column_wrapper<int32_t>;
+
+/**
+ * @brief Statistics of four ranges of an int32 column "a" and a string column "b"; the last range
+ * has no statistics
+ */
+std::vector<std::vector<stats_min_max>> make_stats()
+{
+  auto const str = [](char const* value) { return stats_value{std::string_view(value)}; };
+  return {{{int32_t{0}, int32_t{9}},
+           {int32_t{10}, int32_t{19}},
+           {int32_t{20}, int32_t{29}},
+           {std::nullopt, std::nullopt}},
+          {{str("aa"), str("az")},
+           {str("ba"), str("bz")},
+           {str("ca"), str("cz")},
+           {std::nullopt, std::nullopt}}};
+}
+
+std::vector<cudf::data_type> const stats_dtypes{cudf::data_type{cudf::type_id::INT32},
+                                                cudf::data_type{cudf::type_id::STRING}};
+
+}  // namespace
+
+struct StatsFilterTest : public cudf::test::BaseFixture {};
+
+TEST_F(StatsFilterTest, HostEvaluator)
+{
+  auto const stats  = make_stats();
+  auto const stream = cudf::get_default_stream();
+
+  // The statistics AST references the min of column i as 2 * i and its max as 2 * i + 1
+  auto const a_min = cudf::ast::column_reference(0);
+  auto const a_max = cudf::ast::column_reference(1);
+  auto const b_min = cudf::ast::column_reference(2);
+  auto ten         = cudf::numeric_scalar<int32_t>(10);
+  auto b           = cudf::string_scalar("bb");
+  auto const lit10 = cudf::ast::literal(ten);
+  auto const litb  = cudf::ast::literal(b);
+
+  // a_max >= 10 AND b_min <= "bb"
+  auto const ge       = cudf::ast::operation(cudf::ast::ast_operator::GREATER_EQUAL, a_max, lit10);
+  auto const le       = cudf::ast::operation(cudf::ast::ast_operator::LESS_EQUAL, b_min, litb);
+  auto const and_expr = cudf::ast::operation(cudf::ast::ast_operator::LOGICAL_AND, ge, le);
+
+  cudf::io::detail::host_stats_evaluator evaluator{stats, stats_dtypes};
+  ASSERT_EQ(evaluator.prepare(and_expr, stream), cudf::type_id::BOOL8);
+  auto const evaluate = [&](auto const& expr, cudf::size_type range) -> std::optional<bool> {
+    auto const value = evaluator.evaluate(expr, range);
+    if (not value.has_value()) { return std::nullopt; }
+    return std::get<bool>(value.value());
+  };
+  std::vector<std::optional<bool>> results;
+  for (cudf::size_type range = 0; range < 4; ++range) {
+    results.push_back(evaluate(and_expr, range));
+  }
+  EXPECT_EQ(results, (std::vector<std::optional<bool>>{false, true, false, std::nullopt}));
+
+  // NULL_LOGICAL_AND is false if either operand is false, even if the other is null
+  auto const lt       = cudf::ast::operation(cudf::ast::ast_operator::LESS, a_min, lit10);
+  auto const null_and = cudf::ast::operation(cudf::ast::ast_operator::NULL_LOGICAL_AND, lt, ge);
+  ASSERT_EQ(evaluator.prepare(null_and, stream), cudf::type_id::BOOL8);
+  EXPECT_EQ(evaluate(null_and, 2), std::optional<bool>{false});
+  EXPECT_FALSE(evaluate(null_and, 3).has_value());
+}
+
+TEST_F(StatsFilterTest, HostEvaluatorUnsupported)
+{
+  auto const stats  = make_stats();
+  auto const stream = cudf::get_default_stream();
+
+  auto const a_min = cudf::ast::column_reference(0);
+  auto ten         = cudf::numeric_scalar<int64_t>(10);
+  auto const lit10 = cudf::ast::literal(ten);
+
+  cudf::io::detail::host_stats_evaluator evaluator{stats, stats_dtypes};
+  // Operands of different types
+  auto const lt = cudf::ast::operation(cudf::ast::ast_operator::LESS, a_min, lit10);
+  EXPECT_FALSE(evaluator.prepare(lt, stream).has_value());
+  // Arithmetic operations
+  auto const add = cudf::ast::operation(cudf::ast::ast_operator::ADD, a_min, a_min);
+  EXPECT_FALSE(evaluator.prepare(add, stream).has_value());
+  // Columns without statistics
+  auto const missing = cudf::ast::column_reference(4);
+  EXPECT_FALSE(evaluator.prepare(missing, stream).has_value());
+}
+
+TEST_F(StatsFilterTest, EvaluateFilter)
+{
+  auto const stats  = make_stats();
+  auto const stream = cudf::get_default_stream();
+
+  auto const a = cudf::ast::column_reference(0);
+  auto const b = cudf::ast::column_reference(1);
+  auto v15     = cudf::numeric_scalar<int32_t>(15);
+  auto vbc     = cudf::string_scalar("bc");
+  auto vcz     = cudf::string_scalar("cz");
+  auto lit15   = cudf::ast::literal(v15);
+  auto litbc   = cudf::ast::literal(vbc);
+  auto litcz   = cudf::ast::literal(vcz);
+
+  // a < 15
+  auto const lt = cudf::ast::operation(cudf::ast::ast_operator::LESS, a, lit15);
+  EXPECT_EQ(cudf::io::detail::evaluate_stats_filter(stats, stats_dtypes, lt, 4, stream),
+            (std::vector<bool>{true, true, false, true}));
+
+  // b == "bc" OR b == "cz"
+  auto const eq_bc   = cudf::ast::operation(cudf::ast::ast_operator::EQUAL, b, litbc);
+  auto const eq_cz   = cudf::ast::operation(cudf::ast::ast_operator::EQUAL, b, litcz);
+  auto const or_expr = cudf::ast::operation(cudf::ast::ast_operator::LOGICAL_OR, eq_bc, eq_cz);
+  EXPECT_EQ(cudf::io::detail::evaluate_stats_filter(stats, stats_dtypes, or_expr, 4, stream),
+            (std::vector<bool>{false, true, true, true}));
+
+  // a < 15 AND b == "bc"
+  auto const and_expr = cudf::ast::operation(cudf::ast::ast_operator::LOGICAL_AND, lt, eq_bc);
+  EXPECT_EQ(cudf::io::detail::evaluate_stats_filter(stats, stats_dtypes, and_expr, 4, stream),
+            (std::vector<bool>{false, true, false, true}));
+}
+
+TEST_F(StatsFilterTest, ParquetRowGroups)
+{
+  constexpr auto num_rows = 20000;
+  auto const values       = thrust::make_counting_iterator(0);
+  int32s_col col0(values, values + num_rows);
+  auto const table = cudf::table_view{{col0}};
+
+  auto const filepath = temp_env->get_temp_filepath("StatsFilterRowGroups.parquet");
+  cudf::io::write_parquet(
+    cudf::io::parquet_writer_options::builder(cudf::io::sink_info{filepath}, table)
+      .row_group_size_rows(5000)
+      .build());
+
+  // table[0] >= 12000
+  auto const col    = cudf::ast::column_reference(0);
+  auto value        = cudf::numeric_scalar<int32_t>(12000);
+  auto const lit    = cudf::ast::literal(value);
+  auto const filter = cudf::ast::operation(cudf::ast::ast_operator::GREATER_EQUAL, col, lit);
+
+  auto const result = cudf::io::read_parquet(
+    cudf::io::parquet_reader_options::builder(cudf::io::source_info{filepath})
+      .filter(filter)
+      .build());
+  auto const expected = cudf::slice(table, {12000, num_rows})[0];
+  CUDF_TEST_EXPECT_TABLES_EQUAL(result.tbl->view(), expected);
+}
+
+TEST_F(StatsFilterTest, OrcStripes)
+{
+  constexpr auto num_rows = 20000;
+  auto const values       = thrust::make_counting_iterator(0);
+  int32s_col col0(values, values + num_rows);
+  auto const table = cudf::table_view{{col0}};
+
+  auto const filepath = temp_env->get_temp_filepath("StatsFilterStripes.orc");
+  cudf::io::write_orc(cudf::io::orc_writer_options::builder(cudf::io::sink_info{filepath}, table)
+                        .stripe_size_rows(5000)
+                        .row_index_stride(1000));
+
+  // table[0] < 7500
+  auto const col    = cudf::ast::column_reference(0);
+  auto value        = cudf::numeric_scalar<int32_t>(7500);
+  auto const lit    = cudf::ast::literal(value);
+  auto const filter = cudf::ast::operation(cudf::ast::ast_operator::LESS, col, lit);
+
+  auto const result = cudf::io::read_orc(
+    cudf::io::orc_reader_options::builder(cudf::io::source_info{filepath}).filter(filter));
+  auto const expected = cudf::slice(table, {0, 7500})[0];
+  CUDF_TEST_EXPECT_TABLES_EQUAL(result.tbl->view(), expected);
+}
@@ -214,7 +214,9 @@ def test_can_parse_no_schema():
 
 
 @pytest.mark.parametrize("rows", [0, 1, 10, 1000])
-@pytest.mark.parametrize("codec", ["null", "deflate", "snappy"])
+@pytest.mark.parametrize(
+    "codec", ["null", "deflate", "snappy", "bzip2", "xz", "zstandard"]
+)
 def test_avro_compression(rows, codec):
     schema = {
         "name": "root",